@@ -23,23 +23,31 @@
 #include <Win32_Interop/win32_types.h>
 #endif
 
+#include <errno.h>
 #include <fcntl.h>
 #include <netinet/in.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <strings.h>
+#include <poll.h>
+#include <sys/eventfd.h>
 #include <sys/ioctl.h>
 #include <sys/mman.h>
 #include <sys/socket.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #include <sys/types.h>
 #include <sys/un.h>
 #include <time.h>
 #include <unistd.h>
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <deque>
 #include <mutex>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
@@ -51,7 +59,10 @@
 #include "plasma/common.h"
 #include "plasma/fling.h"
 #include "plasma/io.h"
+#include "plasma/lease_table.h"
 #include "plasma/malloc.h"
+#include "plasma/notification_ring.h"
+#include "plasma/object_directory.h"
 #include "plasma/plasma.h"
 #include "plasma/protocol.h"
 
@@ -84,6 +95,15 @@ typedef struct XXH64_state_s XXH64_state_t;
 constexpr int64_t kHashingConcurrency = 8;
 constexpr int64_t kBytesInMB = 1 << 20;
 
+// Number of prefetches that can wait for the prefetch thread.
+constexpr size_t kMaxPrefetchQueueSize = 1024;
+
+// Number of objects in each page a List without a cursor asks for.
+constexpr int64_t kListPageSize = 10000;
+// A List cursor with this bit goes on in the directory of the remote region,
+// at the slot in the bits below it. The store leaves this bit alone.
+constexpr uint64_t kRemoteListCursor = uint64_t(1) << 63;
+
 // ----------------------------------------------------------------------
 // GPU support
 
@@ -116,6 +136,22 @@ std::shared_ptr<Buffer> MakeBufferFromGpuProcessHandle(GpuProcessHandle* handle)
 
 #endif
 
+namespace {
+
+// The NUMA node of the CPU the calling thread runs on, or -1.
+int CurrentNumaNode() {
+#ifdef __linux__
+  unsigned cpu;
+  unsigned node;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+    return static_cast<int>(node);
+  }
+#endif
+  return -1;
+}
+
+}  // namespace
+
 // ----------------------------------------------------------------------
 // PlasmaBuffer
 
@@ -154,20 +190,94 @@ class ARROW_NO_EXPORT PlasmaMutableBuffer : public MutableBuffer {
 // ----------------------------------------------------------------------
 // PlasmaClient::Impl
 
+/// A connection to the store. A request and its reply must not interleave with
+/// other requests on the same socket, so a connection is used by one thread at a
+/// time, under its mutex.
+struct StoreConnection {
+  explicit StoreConnection(bool pipelined = false) : fd(-1), pipelined(pipelined) {}
+
+  /// File descriptor of the Unix domain socket that connects to the store.
+  int fd;
+  /// Whether this is a PipelinedConnection.
+  const bool pipelined;
+  /// Store file descriptors that the store already sent on this connection.
+  /// The store sends each file descriptor once per connection (see the
+  /// used_fds field of Client in plasma.h).
+  std::unordered_set<int> received_fds;
+  /// Serializes the requests on this connection.
+  std::mutex mutex;
+};
+
+/// Handles the reply to a pipelined request. Called on the reader thread of the
+/// connection with the reply, or with an error and no reply if the request
+/// could not be sent or the connection broke before the reply arrived.
+using ReplyHandler = std::function<void(const Status&, const uint8_t*, size_t)>;
+
+/// The connection used by the asynchronous API. Requests are written under the
+/// connection's mutex without waiting for their replies, which a reader thread
+/// matches to their requests by request_id. Only the reader thread reads from
+/// the socket, so it also receives the file descriptors (received_fds).
+struct PipelinedConnection : public StoreConnection {
+  PipelinedConnection() : StoreConnection(/*pipelined=*/true), next_request_id(0) {}
+
+  ~PipelinedConnection() {
+    if (fd != -1) {
+      close(fd);
+    }
+  }
+
+  /// Protects the fields below. Locked after the connection's mutex and the
+  /// shard locks, and never held while writing to the socket.
+  std::mutex state_mutex;
+  /// The request_id of the last request sent.
+  uint64_t next_request_id;
+  /// Handlers of the requests that have been sent but not replied to yet.
+  std::unordered_map<uint64_t, ReplyHandler> pending_replies;
+  /// Number of outstanding gets of each object. The store keeps one reference
+  /// per object and connection, so an object must not be released on this
+  /// connection while a get of it is outstanding (see Release).
+  std::unordered_map<ObjectID, int> gets_in_flight;
+  /// Why the reader thread stopped, if it did. Later requests fail with it.
+  Status status;
+};
+
 struct ObjectInUseEntry {
   /// A count of the number of times this client has called PlasmaClient::Create
   /// or
   /// PlasmaClient::Get on this object ID minus the number of calls to
   /// PlasmaClient::Release.
   /// When this count reaches zero, we remove the entry from the ObjectsInUse
-  /// and decrement a count in the relevant ClientMmapTableEntry.
+  /// and decrement a count in the relevant ClientMmapTableEntry, unless the
+  /// object is leased.
   int count;
   /// Cached information to read the object.
   PlasmaObject object;
+  /// Base address of the mapping the object lives in, cached so that reading an
+  /// object that is already in use does not need to look at the mmap table.
+  uint8_t* base;
+  /// The connection that holds the store's reference to this object. The
+  /// object must be sealed, aborted and released on this connection.
+  StoreConnection* conn;
   /// A flag representing whether the object has been sealed.
   bool is_sealed;
+  /// For a stream this client created, the number of bytes published so far,
+  /// and -1 otherwise.
+  int64_t stream_size;
+  /// The lease the store granted with its reference, or kNoLease. A leased
+  /// entry stays in the table with a count of zero while the lease is idle, so
+  /// that the next Get does not need the store.
+  int64_t lease;
 };
 
+/// A shard of the table of objects in use. Objects are spread over the shards
+/// by ID, so that threads working on different objects rarely share a lock.
+struct alignas(64) ObjectsInUseShard {
+  std::mutex mutex;
+  std::unordered_map<ObjectID, std::unique_ptr<ObjectInUseEntry>> objects;
+};
+
+constexpr int64_t kObjectsInUseShards = 64;
+
 class ClientMmapTableEntry {
  public:
   ClientMmapTableEntry(int fd, int64_t map_size)
@@ -198,6 +308,8 @@ class ClientMmapTableEntry {
 
   uint8_t* pointer() { return pointer_; }
 
+  int64_t length() { return static_cast<int64_t>(length_); }
+
   int fd() { return fd_; }
 
  private:
@@ -220,9 +332,10 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
   Status Connect(const std::string& store_socket_name,
                  const std::string& manager_socket_name, int release_delay = 0,
-                 int num_retries = -1);
+                 int num_retries = -1, int num_connections = 1);
 
-  Status SetClientOptions(const std::string& client_name, int64_t output_memory_quota);
+  Status SetClientOptions(const std::string& client_name, int64_t output_memory_quota,
+                          int weight);
 
   Status Create(const ObjectID& object_id, int64_t data_size, const uint8_t* metadata,
                 int64_t metadata_size, std::shared_ptr<Buffer>* data, int device_num = 0,
@@ -236,31 +349,66 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
                             const std::vector<std::string>& metadata,
                             bool evict_if_full = true);
 
+  Status CreateView(const ObjectID& parent_id, int64_t offset, int64_t length,
+                    const ObjectID& object_id);
+
   Status Get(const std::vector<ObjectID>& object_ids, int64_t timeout_ms,
              std::vector<ObjectBuffer>* object_buffers);
 
   Status Get(const ObjectID* object_ids, int64_t num_objects, int64_t timeout_ms,
              ObjectBuffer* object_buffers);
 
+  arrow::Future<std::shared_ptr<Buffer>> CreateAsync(const ObjectID& object_id,
+                                                     int64_t data_size,
+                                                     const uint8_t* metadata,
+                                                     int64_t metadata_size,
+                                                     bool evict_if_full = true);
+
+  arrow::Future<std::vector<ObjectBuffer>> GetAsync(const std::vector<ObjectID>& object_ids,
+                                                    int64_t timeout_ms);
+
+  arrow::Future<> SealAsync(const ObjectID& object_id);
+
+  Status Wait(const std::vector<ObjectID>& object_ids, int64_t num_ready,
+              int64_t timeout_ms, std::vector<ObjectID>* ready_ids);
+
+  Status Prefetch(const std::vector<ObjectID>& object_ids);
+
   Status Release(const ObjectID& object_id);
 
   Status Contains(const ObjectID& object_id, bool* has_object);
 
   Status List(ObjectTable* objects);
 
+  Status List(const ObjectListFilter& filter, int64_t page_size, uint64_t* cursor,
+              ObjectTable* objects, bool* restarted);
+
   Status Abort(const ObjectID& object_id);
 
   Status Seal(const ObjectID& object_id);
 
+  Status CreateStream(const ObjectID& object_id, int64_t capacity,
+                      const uint8_t* metadata, int64_t metadata_size,
+                      std::shared_ptr<Buffer>* data, bool evict_if_full);
+
+  Status Append(const ObjectID& object_id, const uint8_t* data, int64_t size);
+
+  Status Publish(const ObjectID& object_id, int64_t stream_size);
+
+  Status WaitStream(const ObjectID& object_id, int64_t stream_size, int64_t timeout_ms,
+                    int64_t* published, bool* closed);
+
   Status Delete(const std::vector<ObjectID>& object_ids);
 
   Status Evict(int64_t num_bytes, int64_t& num_bytes_evicted);
 
+  Status GrowRegion(int64_t memory_capacity);
+
   Status Refresh(const std::vector<ObjectID>& object_ids);
 
   Status Hash(const ObjectID& object_id, uint8_t* digest);
 
-  Status Subscribe(int* fd);
+  Status Subscribe(int* fd, int64_t ring_capacity);
 
   Status GetNotification(int fd, ObjectID* object_id, int64_t* data_size,
                          int64_t* metadata_size);
@@ -277,22 +425,121 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
   bool IsInUse(const ObjectID& object_id);
 
-  int64_t store_capacity() { return store_capacity_; }
+  int64_t store_capacity() { return store_capacity_.load(); }
 
  private:
-  /// Check if store_fd has already been received from the store. If yes,
-  /// return it. Otherwise, receive it from the store (see analogous logic
-  /// in store.cc).
+  /// Lock a connection to the store, preferring one that is not in use by
+  /// another thread.
   ///
-  /// \param store_fd File descriptor to fetch from the store.
-  /// \return Client file descriptor corresponding to store_fd.
-  int GetStoreFd(int store_fd);
+  /// \param lock Out parameter, takes ownership of the connection's mutex.
+  /// \return The locked connection.
+  StoreConnection* AcquireConnection(std::unique_lock<std::mutex>* lock);
+
+  /// The connection on which objects are created. This is the first connection
+  /// if the client has a memory quota, since the store accounts the quota per
+  /// connection.
+  StoreConnection* AcquireCreateConnection(std::unique_lock<std::mutex>* lock);
+
+  ObjectsInUseShard& GetShard(const ObjectID& object_id) {
+    return objects_in_use_[object_id.hash() % kObjectsInUseShards];
+  }
+
+  /// Map the file behind store_fd if it hasn't been mapped yet, receiving its
+  /// file descriptor from the store if the store has not sent it on this
+  /// connection before (see analogous logic in store.cc). The caller must hold
+  /// the connection's mutex.
+  ///
+  /// \param conn The connection the reply referring to store_fd came in on.
+  /// \param store_fd File descriptor of the file in the store.
+  /// \param map_size Size of the file.
+  /// \return The base address of the mapping.
+  uint8_t* MapStoreFd(StoreConnection* conn, int store_fd, int64_t map_size);
 
   /// This is a helper method for marking an object as unused by this client.
+  /// The caller must hold the lock of the object's shard.
   ///
+  /// \param shard The shard containing the object.
   /// \param object_id The object ID we mark unused.
   /// \return The return status.
-  Status MarkObjectUnused(const ObjectID& object_id);
+  Status MarkObjectUnused(ObjectsInUseShard* shard, const ObjectID& object_id);
+
+  /// The pipelined connection, opened and given a reader thread on first use.
+  Status GetPipelinedConnection(PipelinedConnection** conn);
+
+  /// Send a request on the pipelined connection. The handler is registered
+  /// under a fresh request_id before the request is written, and is called
+  /// exactly once.
+  ///
+  /// \param conn The pipelined connection.
+  /// \param send Writes the request with the given request_id to the socket.
+  /// \param handler Called with the reply.
+  /// \param get_object_ids For a get, the objects it asks the store for.
+  void SendPipelinedRequest(PipelinedConnection* conn,
+                            const std::function<Status(int, uint64_t)>& send,
+                            ReplyHandler handler,
+                            const std::vector<ObjectID>& get_object_ids = {});
+
+  /// Body of the reader thread of the pipelined connection. It only uses conn,
+  /// which it keeps alive, so the client may be destroyed while it runs.
+  static void ReadPipelinedReplies(std::shared_ptr<PipelinedConnection> conn);
+
+  /// Stop the reader thread of the pipelined connection, if any.
+  void StopPipeline();
+
+  /// Body of the prefetch thread. It populates the pages of the objects that
+  /// Prefetch queued, until StopPrefetcher is called.
+  void RunPrefetcher();
+
+  /// Bring the pages of an object in the remote region into memory.
+  void PrefetchObject(const ObjectID& object_id);
+
+  /// Stop the prefetch thread, if any, dropping what is left in its queue.
+  void StopPrefetcher();
+
+  /// Account for the reply to a pipelined get: release the references the
+  /// store handed out twice, and the objects whose release was held back
+  /// while the get was outstanding.
+  ///
+  /// \param conn The pipelined connection.
+  /// \param object_ids The objects the get asked the store for.
+  /// \param duplicates Objects that ProcessGetReply found duplicated.
+  void FinishPipelinedGet(PipelinedConnection* conn,
+                          const std::vector<ObjectID>& object_ids,
+                          const std::vector<ObjectID>& duplicates);
+
+  /// Fill out the buffers of the objects this client already uses, and return
+  /// the indices of the other objects in missing.
+  void GetLocalBuffers(const ObjectID* object_ids, int64_t num_objects,
+                       int64_t timeout_ms,
+                       const std::function<std::shared_ptr<Buffer>(
+                           const ObjectID&, const std::shared_ptr<Buffer>&)>& wrap_buffer,
+                       ObjectBuffer* object_buffers, std::vector<int64_t>* missing);
+
+  /// Fill out the buffers of the missing objects that the directory of the
+  /// remote region lists, and remove them from missing.
+  void GetRemoteBuffers(const ObjectID* object_ids,
+                        const std::function<std::shared_ptr<Buffer>(
+                            const ObjectID&, const std::shared_ptr<Buffer>&)>& wrap_buffer,
+                        ObjectBuffer* object_buffers, std::vector<int64_t>* missing);
+
+  /// Ask the store for the missing objects, fill out the buffers of those it
+  /// returns, and leave the others in missing.
+  Status GetStoreBuffers(const ObjectID* object_ids, int64_t timeout_ms,
+                         const std::function<std::shared_ptr<Buffer>(
+                             const ObjectID&, const std::shared_ptr<Buffer>&)>& wrap_buffer,
+                         ObjectBuffer* object_buffers, std::vector<int64_t>* missing);
+
+  /// Fill out the buffers of the missing objects from the store's reply to a
+  /// get for them, which came in on conn.
+  ///
+  /// \param[out] duplicates Objects for which the store now holds a second
+  ///             reference for this client. The caller must release them on
+  ///             conn.
+  Status ProcessGetReply(StoreConnection* conn, const uint8_t* data, size_t size,
+                         const ObjectID* object_ids, const std::vector<int64_t>& missing,
+                         const std::function<std::shared_ptr<Buffer>(
+                             const ObjectID&, const std::shared_ptr<Buffer>&)>& wrap_buffer,
+                         ObjectBuffer* object_buffers, std::vector<ObjectID>* duplicates);
 
   /// Common helper for Get() variants
   Status GetBuffers(const ObjectID* object_ids, int64_t num_objects, int64_t timeout_ms,
@@ -300,12 +547,35 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
                         const ObjectID&, const std::shared_ptr<Buffer>&)>& wrap_buffer,
                     ObjectBuffer* object_buffers);
 
+  /// Set up the buffer of an object from the store's reply to a create for it.
+  arrow::Result<std::shared_ptr<Buffer>> ProcessCreateReply(
+      StoreConnection* conn, const uint8_t* data, size_t size, const ObjectID& object_id,
+      int64_t data_size, const uint8_t* metadata, int64_t metadata_size, int device_num);
+
+  /// Mark an object that this client created as sealed and compute its digest,
+  /// before the seal request is sent.
+  Status PrepareSeal(const ObjectID& object_id, std::string* digest);
+
   uint8_t* LookupOrMmap(int fd, int store_fd_val, int64_t map_size);
 
   uint8_t* LookupMmappedFile(int store_fd_val);
 
-  void IncrementObjectCount(const ObjectID& object_id, PlasmaObject* object,
-                            bool is_sealed);
+  /// The lease table in the header of the region mapped for store_fd_val, or
+  /// nullptr if the region has none.
+  LeaseTable* LookupLeaseTable(int store_fd_val);
+
+  /// Record that this client uses one more instance of an object that the
+  /// store returned on the locked connection conn. The caller must hold the
+  /// lock of conn. conn is null for objects found in the remote directory,
+  /// which no store holds a reference to for this client. lease is the lease
+  /// the store granted with the reference, if any.
+  ///
+  /// \return Whether the store now holds a second reference to the object for
+  ///         this client, on a connection other than the one recorded for it.
+  ///         The caller must release that reference on conn.
+  bool IncrementObjectCount(const ObjectID& object_id, PlasmaObject* object,
+                            uint8_t* base, StoreConnection* conn, bool is_sealed,
+                            int64_t lease = kNoLease);
 
   bool ComputeObjectHashParallel(XXH64_state_t* hash_state, const unsigned char* data,
                                  int64_t nbytes);
@@ -318,37 +588,130 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 #ifdef PLASMA_CUDA
   arrow::Result<std::shared_ptr<CudaContext>> GetCudaContext(int device_number);
 #endif
-  /// File descriptor of the Unix domain socket that connects to the store.
-  int store_conn_;
+  /// Connections to the store. The first connection is also used for
+  /// notifications and for requests that carry per-client state.
+  std::vector<std::unique_ptr<StoreConnection>> store_conns_;
+  /// Whether the client is connected. Release becomes a no-op after
+  /// Disconnect.
+  std::atomic<bool> connected_;
+  /// Whether SetClientOptions set a memory quota for this client.
+  std::atomic<bool> has_quota_;
+  /// Where the store is, for opening the pipelined connection later.
+  std::string store_socket_name_;
+  int num_retries_;
+  /// Connection for the asynchronous API and its reader thread, both created
+  /// on first use under pipeline_mutex_.
+  std::shared_ptr<PipelinedConnection> pipelined_conn_;
+  std::thread pipeline_reader_;
+  std::mutex pipeline_mutex_;
+  /// The objects Prefetch queued and the thread that populates their pages,
+  /// started on first use. All of them are protected by prefetch_mutex_.
+  std::deque<ObjectID> prefetch_queue_;
+  std::thread prefetcher_;
+  bool stop_prefetcher_;
+  std::mutex prefetch_mutex_;
+  std::condition_variable prefetch_cond_;
   /// Table of dlmalloc buffer files that have been memory mapped so far. This
   /// is a hash table mapping a file descriptor to a struct containing the
   /// address of the corresponding memory-mapped file.
   std::unordered_map<int, std::unique_ptr<ClientMmapTableEntry>> mmap_table_;
+  /// Protects mmap_table_.
+  std::mutex mmap_mutex_;
+  /// The directory of the objects in the remote region, if MmapRemoteMemory
+  /// mapped one that has it, and the start of the mapping of that region.
+  /// Both are set once before the client is shared between threads.
+  std::unique_ptr<ObjectDirectory> remote_directory_;
+  uint8_t* remote_base_;
+  /// The lease table of the store's region, opened under mmap_mutex_ when the
+  /// first lease arrives. Entries only carry leases after that, so whoever
+  /// finds a lease in an entry can use the table without the lock.
+  std::unique_ptr<LeaseTable> leases_;
   /// A hash table of the object IDs that are currently being used by this
-  /// client.
-  std::unordered_map<ObjectID, std::unique_ptr<ObjectInUseEntry>> objects_in_use_;
+  /// client, split into shards.
+  ObjectsInUseShard objects_in_use_[kObjectsInUseShards];
   /// The amount of memory available to the Plasma store. The client needs this
   /// information to make sure that it does not delay in releasing so much
   /// memory that the store is unable to evict enough objects to free up space.
-  int64_t store_capacity_;
+  /// GrowRegion updates it while other threads may read it.
+  std::atomic<int64_t> store_capacity_;
   /// A hash set to record the ids that users want to delete but still in use.
   std::unordered_set<ObjectID> deletion_cache_;
+  /// Protects deletion_cache_.
+  std::mutex deletion_mutex_;
   /// A queue of notification
   std::deque<std::tuple<ObjectID, int64_t, int64_t>> pending_notification_;
-  /// A mutex which protects this class.
-  std::recursive_mutex client_mutex_;
+  /// A ring of notifications in memory shared with the store, and its mapping.
+  struct NotificationRingMapping {
+    std::unique_ptr<NotificationRing> ring;
+    uint8_t* pointer;
+    int64_t size;
+  };
+  /// The rings of the subscriptions that use one, by their eventfd.
+  std::unordered_map<int, NotificationRingMapping> notification_rings_;
+  /// Protects pending_notification_ and notification_rings_.
+  std::mutex notification_mutex_;
+
+  /// Read the next notification from a ring, waiting on its eventfd while it
+  /// is empty. The wait releases lock, which holds notification_mutex_.
+  Status GetRingNotification(std::unique_lock<std::mutex>* lock, int fd,
+                             NotificationRing* ring, ObjectID* object_id,
+                             int64_t* data_size, int64_t* metadata_size);
 };
 
 PlasmaBuffer::~PlasmaBuffer() { ARROW_UNUSED(client_->Release(object_id_)); }
 
-PlasmaClient::Impl::Impl() : store_conn_(0), store_capacity_(0) {}
+PlasmaClient::Impl::Impl()
+    : connected_(false),
+      has_quota_(false),
+      num_retries_(-1),
+      stop_prefetcher_(false),
+      remote_base_(nullptr),
+      store_capacity_(0) {}
+
+PlasmaClient::Impl::~Impl() {
+  StopPrefetcher();
+  StopPipeline();
+  for (auto& entry : notification_rings_) {
+    munmap(entry.second.pointer, entry.second.size);
+  }
+}
 
-PlasmaClient::Impl::~Impl() {}
+StoreConnection* PlasmaClient::Impl::AcquireConnection(
+    std::unique_lock<std::mutex>* lock) {
+  // Threads start looking at a connection of their own, so that with as many
+  // connections as threads every thread keeps using the same connection.
+  static thread_local size_t hint =
+      std::hash<std::thread::id>()(std::this_thread::get_id());
+  const size_t num_conns = store_conns_.size();
+  for (size_t i = 0; i < num_conns; ++i) {
+    StoreConnection* conn = store_conns_[(hint + i) % num_conns].get();
+    std::unique_lock<std::mutex> conn_lock(conn->mutex, std::try_to_lock);
+    if (conn_lock.owns_lock()) {
+      hint += i;
+      *lock = std::move(conn_lock);
+      return conn;
+    }
+  }
+  StoreConnection* conn = store_conns_[hint % num_conns].get();
+  *lock = std::unique_lock<std::mutex>(conn->mutex);
+  return conn;
+}
+
+StoreConnection* PlasmaClient::Impl::AcquireCreateConnection(
+    std::unique_lock<std::mutex>* lock) {
+  if (!has_quota_) {
+    return AcquireConnection(lock);
+  }
+  StoreConnection* conn = store_conns_[0].get();
+  *lock = std::unique_lock<std::mutex>(conn->mutex);
+  return conn;
+}
 
 // If the file descriptor fd has been mmapped in this client process before,
 // return the pointer that was returned by mmap, otherwise mmap it and store the
 // pointer in a hash table.
 uint8_t* PlasmaClient::Impl::LookupOrMmap(int fd, int store_fd_val, int64_t map_size) {
+  std::lock_guard<std::mutex> guard(mmap_mutex_);
   auto entry = mmap_table_.find(store_fd_val);
   if (entry != mmap_table_.end()) {
     return entry->second->pointer();
@@ -362,62 +725,148 @@ uint8_t* PlasmaClient::Impl::LookupOrMmap(int fd, int store_fd_val, int64_t map_
 // Get a pointer to a file that we know has been memory mapped in this client
 // process before.
 uint8_t* PlasmaClient::Impl::LookupMmappedFile(int store_fd_val) {
+  std::lock_guard<std::mutex> guard(mmap_mutex_);
   auto entry = mmap_table_.find(store_fd_val);
   ARROW_CHECK(entry != mmap_table_.end());
   return entry->second->pointer();
 }
 
+LeaseTable* PlasmaClient::Impl::LookupLeaseTable(int store_fd_val) {
+  std::lock_guard<std::mutex> guard(mmap_mutex_);
+  if (!leases_) {
+    // The store grants leases in its own region only, so the first region a
+    // lease arrives for is the one that has the table.
+    auto entry = mmap_table_.find(store_fd_val);
+    ARROW_CHECK(entry != mmap_table_.end());
+    uint8_t* base = entry->second->pointer();
+    const int64_t length = entry->second->length();
+    auto directory = ObjectDirectory::Open(base, length);
+    if (directory) {
+      leases_ = LeaseTable::Open(base + directory->size(), length - directory->size());
+    }
+  }
+  return leases_.get();
+}
+
+uint8_t* PlasmaClient::Impl::MapStoreFd(StoreConnection* conn, int store_fd,
+                                        int64_t map_size) {
+  int fd = -1;
+  if (conn->received_fds.insert(store_fd).second) {
+    fd = recv_fd(conn->fd);
+    ARROW_CHECK(fd >= 0) << "recv not successful";
+  }
+  std::lock_guard<std::mutex> guard(mmap_mutex_);
+  auto entry = mmap_table_.find(store_fd);
+  if (entry != mmap_table_.end()) {
+    // Another connection received and mapped this file first.
+    if (fd >= 0) {
+      close(fd);
+    }
+    return entry->second->pointer();
+  }
+  ARROW_CHECK(fd >= 0) << "store fd " << store_fd << " was never received";
+  auto mmap_entry = new ClientMmapTableEntry(fd, map_size);
+  mmap_table_[store_fd] = std::unique_ptr<ClientMmapTableEntry>(mmap_entry);
+  return mmap_entry->pointer();
+}
+
 Status PlasmaClient::Impl::MmapRemoteMemory(const std::string& file) {
   int fd = open(file.c_str(), O_RDWR | O_SYNC);
+  if (fd < 0) {
+    return Status::IOError("failed to open remote memory ", file, ": ",
+                           strerror(errno));
+  }
   // Find remote memory file size
   struct stat stat_buf;
-  fstat(fd, &stat_buf);
+  if (fstat(fd, &stat_buf) != 0) {
+    Status s = Status::IOError("failed to stat remote memory ", file, ": ",
+                               strerror(errno));
+    close(fd);
+    return s;
+  }
+  // The remote store may grow its region up to the size in its directory, so
+  // the region is mapped at that size, which keeps it from moving.
+  int64_t map_size = stat_buf.st_size;
+  void* header = mmap(nullptr, stat_buf.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  if (header != MAP_FAILED) {
+    auto directory = ObjectDirectory::Open(static_cast<uint8_t*>(header),
+                                           stat_buf.st_size - kMmapRegionsGap);
+    if (directory) {
+      map_size = std::max(map_size, directory->max_region_size() + kMmapRegionsGap);
+    }
+    munmap(header, stat_buf.st_size);
+  }
   // Mmap remote memory with fd = -1 in accordance with PlasmaStore::ProcessGetRequest
-  LookupOrMmap(fd, -1, stat_buf.st_size);
+  remote_base_ = LookupOrMmap(fd, -1, map_size);
+  // With the directory in the header of the remote region, sealed remote
+  // objects can be found without asking either store.
+  remote_directory_ = ObjectDirectory::Open(remote_base_, map_size - kMmapRegionsGap);
   return Status::OK();
 }
 
 bool PlasmaClient::Impl::IsInUse(const ObjectID& object_id) {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+  ObjectsInUseShard& shard = GetShard(object_id);
+  std::lock_guard<std::mutex> guard(shard.mutex);
 
-  const auto elem = objects_in_use_.find(object_id);
-  return (elem != objects_in_use_.end());
+  const auto elem = shard.objects.find(object_id);
+  // An idle lease does not count as use.
+  return elem != shard.objects.end() &&
+         (elem->second->count > 0 || elem->second->lease == kNoLease);
 }
 
-int PlasmaClient::Impl::GetStoreFd(int store_fd) {
-  auto entry = mmap_table_.find(store_fd);
-  if (entry == mmap_table_.end()) {
-    int fd = recv_fd(store_conn_);
-    ARROW_CHECK(fd >= 0) << "recv not successful";
-    return fd;
-  } else {
-    return entry->second->fd();
-  }
-}
-
-void PlasmaClient::Impl::IncrementObjectCount(const ObjectID& object_id,
-                                              PlasmaObject* object, bool is_sealed) {
+bool PlasmaClient::Impl::IncrementObjectCount(const ObjectID& object_id,
+                                              PlasmaObject* object, uint8_t* base,
+                                              StoreConnection* conn, bool is_sealed,
+                                              int64_t lease) {
+  ObjectsInUseShard& shard = GetShard(object_id);
+  std::lock_guard<std::mutex> guard(shard.mutex);
   // Increment the count of the object to track the fact that it is being used.
   // The corresponding decrement should happen in PlasmaClient::Release.
-  auto elem = objects_in_use_.find(object_id);
+  auto elem = shard.objects.find(object_id);
   ObjectInUseEntry* object_entry;
-  if (elem == objects_in_use_.end()) {
+  bool duplicate = false;
+  if (elem == shard.objects.end()) {
     // Add this object ID to the hash table of object IDs in use. The
     // corresponding call to free happens in PlasmaClient::Release.
-    objects_in_use_[object_id] =
-        std::unique_ptr<ObjectInUseEntry>(new ObjectInUseEntry());
-    objects_in_use_[object_id]->object = *object;
-    objects_in_use_[object_id]->count = 0;
-    objects_in_use_[object_id]->is_sealed = is_sealed;
-    object_entry = objects_in_use_[object_id].get();
+    object_entry = new ObjectInUseEntry();
+    object_entry->object = *object;
+    object_entry->base = base;
+    object_entry->conn = conn;
+    object_entry->count = 0;
+    object_entry->is_sealed = is_sealed;
+    object_entry->stream_size = -1;
+    object_entry->lease = lease;
+    shard.objects[object_id] = std::unique_ptr<ObjectInUseEntry>(object_entry);
   } else {
     object_entry = elem->second.get();
-    ARROW_CHECK(object_entry->count > 0);
+    // The count is zero for an object whose release waits for a pipelined get,
+    // or for one whose lease is idle.
+    ARROW_CHECK(object_entry->count >= 0);
+    if (object_entry->count == 0 && object_entry->lease != kNoLease &&
+        !leases_->Acquire(object_entry->lease)) {
+      // The store took the idle lease back, along with its reference. The
+      // reference that just arrived replaces it.
+      object_entry->object = *object;
+      object_entry->base = base;
+      object_entry->conn = conn;
+      object_entry->is_sealed = is_sealed;
+      object_entry->stream_size = -1;
+      object_entry->lease = lease;
+    } else {
+      // Another thread got the object on a different connection in the
+      // meantime. The store counts a reference per connection, so this one is
+      // extra.
+      duplicate = object_entry->conn != conn;
+      if (!duplicate && object_entry->lease == kNoLease) {
+        object_entry->lease = lease;
+      }
+    }
   }
   // Increment the count of the number of instances of this object that are
   // being used by this client. The corresponding decrement should happen in
   // PlasmaClient::Release.
   object_entry->count += 1;
+  return duplicate;
 }
 
 #ifdef PLASMA_CUDA
@@ -432,37 +881,57 @@ Status PlasmaClient::Impl::Create(const ObjectID& object_id, int64_t data_size,
                                   const uint8_t* metadata, int64_t metadata_size,
                                   std::shared_ptr<Buffer>* data, int device_num,
                                   bool evict_if_full) {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+  std::unique_lock<std::mutex> lock;
+  StoreConnection* conn = AcquireCreateConnection(&lock);
 
-  ARROW_LOG(DEBUG) << "called plasma_create on conn " << store_conn_ << " with size "
+  ARROW_LOG(DEBUG) << "called plasma_create on conn " << conn->fd << " with size "
                    << data_size << " and metadata size " << metadata_size;
-  RETURN_NOT_OK(SendCreateRequest(store_conn_, object_id, evict_if_full, data_size,
+  RETURN_NOT_OK(SendCreateRequest(conn->fd, object_id, evict_if_full, data_size,
                                   metadata_size, device_num));
   std::vector<uint8_t> buffer;
-  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaCreateReply, &buffer));
+  RETURN_NOT_OK(PlasmaReceive(conn->fd, MessageType::PlasmaCreateReply, &buffer));
+  ARROW_ASSIGN_OR_RAISE(*data, ProcessCreateReply(conn, buffer.data(), buffer.size(),
+                                                  object_id, data_size, metadata,
+                                                  metadata_size, device_num));
+  return Status::OK();
+}
+
+arrow::Result<std::shared_ptr<Buffer>> PlasmaClient::Impl::ProcessCreateReply(
+    StoreConnection* conn, const uint8_t* data, size_t size, const ObjectID& object_id,
+    int64_t data_size, const uint8_t* metadata, int64_t metadata_size, int device_num) {
   ObjectID id;
   PlasmaObject object;
   int store_fd;
   int64_t mmap_size;
-  RETURN_NOT_OK(
-      ReadCreateReply(buffer.data(), buffer.size(), &id, &object, &store_fd, &mmap_size));
+  RETURN_NOT_OK(ReadCreateReply(data, size, &id, &object, &store_fd, &mmap_size));
   // If the CreateReply included an error, then the store will not send a file
   // descriptor.
+  uint8_t* base = nullptr;
+  std::shared_ptr<Buffer> buffer;
   if (device_num == 0) {
-    int fd = GetStoreFd(store_fd);
+    if (store_fd == -1) {
+      // The store placed the object in the remote region, which this client
+      // mapped before it connected.
+      if (remote_base_ == nullptr) {
+        return Status::IOError("the store created ", object_id.hex(),
+                               " in the remote region, which is not mapped");
+      }
+      base = remote_base_;
+    } else {
+      base = MapStoreFd(conn, store_fd, mmap_size);
+    }
     ARROW_CHECK(object.data_size == data_size);
     ARROW_CHECK(object.metadata_size == metadata_size);
     // The metadata should come right after the data.
     ARROW_CHECK(object.metadata_offset == object.data_offset + data_size);
-    *data = std::make_shared<PlasmaMutableBuffer>(
-        shared_from_this(), LookupOrMmap(fd, store_fd, mmap_size) + object.data_offset,
-        data_size);
+    buffer = std::make_shared<PlasmaMutableBuffer>(shared_from_this(),
+                                                   base + object.data_offset, data_size);
     // If plasma_create is being called from a transfer, then we will not copy the
     // metadata here. The metadata will be written along with the data streamed
     // from the transfer.
     if (metadata != NULL) {
       // Copy the metadata to the buffer.
-      memcpy((*data)->mutable_data() + object.data_size, metadata, metadata_size);
+      memcpy(buffer->mutable_data() + object.data_size, metadata, metadata_size);
     }
   } else {
 #ifdef PLASMA_CUDA
@@ -479,7 +948,7 @@ Status PlasmaClient::Impl::Create(const ObjectID& object_id, int64_t data_size,
       CudaBufferWriter writer(handle->ptr);
       RETURN_NOT_OK(writer.WriteAt(object.data_size, metadata, metadata_size));
     }
-    *data = MakeBufferFromGpuProcessHandle(handle);
+    buffer = MakeBufferFromGpuProcessHandle(handle);
 #else
     ARROW_LOG(FATAL) << "Arrow GPU library is not enabled.";
 #endif
@@ -488,34 +957,34 @@ Status PlasmaClient::Impl::Create(const ObjectID& object_id, int64_t data_size,
   // Increment the count of the number of instances of this object that this
   // client is using. A call to PlasmaClient::Release is required to decrement
   // this count. Cache the reference to the object.
-  IncrementObjectCount(object_id, &object, false);
+  IncrementObjectCount(object_id, &object, base, conn, false);
   // We increment the count a second time (and the corresponding decrement will
   // happen in a PlasmaClient::Release call in plasma_seal) so even if the
   // buffer returned by PlasmaClient::Create goes out of scope, the object does
   // not get released before the call to PlasmaClient::Seal happens.
-  IncrementObjectCount(object_id, &object, false);
-  return Status::OK();
+  IncrementObjectCount(object_id, &object, base, conn, false);
+  return buffer;
 }
 
 Status PlasmaClient::Impl::CreateAndSeal(const ObjectID& object_id,
                                          const std::string& data,
                                          const std::string& metadata,
                                          bool evict_if_full) {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
-
-  ARROW_LOG(DEBUG) << "called CreateAndSeal on conn " << store_conn_;
   // Compute the object hash.
-  static unsigned char digest[kDigestSize];
+  unsigned char digest[kDigestSize];
   uint64_t hash = ComputeObjectHashCPU(
       reinterpret_cast<const uint8_t*>(data.data()), data.size(),
       reinterpret_cast<const uint8_t*>(metadata.data()), metadata.size());
   memcpy(&digest[0], &hash, sizeof(hash));
 
-  RETURN_NOT_OK(SendCreateAndSealRequest(store_conn_, object_id, evict_if_full, data,
+  std::unique_lock<std::mutex> lock;
+  StoreConnection* conn = AcquireCreateConnection(&lock);
+  ARROW_LOG(DEBUG) << "called CreateAndSeal on conn " << conn->fd;
+  RETURN_NOT_OK(SendCreateAndSealRequest(conn->fd, object_id, evict_if_full, data,
                                          metadata, digest));
   std::vector<uint8_t> buffer;
   RETURN_NOT_OK(
-      PlasmaReceive(store_conn_, MessageType::PlasmaCreateAndSealReply, &buffer));
+      PlasmaReceive(conn->fd, MessageType::PlasmaCreateAndSealReply, &buffer));
   RETURN_NOT_OK(ReadCreateAndSealReply(buffer.data(), buffer.size()));
   return Status::OK();
 }
@@ -524,10 +993,6 @@ Status PlasmaClient::Impl::CreateAndSealBatch(const std::vector<ObjectID>& objec
                                               const std::vector<std::string>& data,
                                               const std::vector<std::string>& metadata,
                                               bool evict_if_full) {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
-
-  ARROW_LOG(DEBUG) << "called CreateAndSealBatch on conn " << store_conn_;
-
   std::vector<std::string> digests;
   for (size_t i = 0; i < object_ids.size(); i++) {
     // Compute the object hash.
@@ -539,112 +1004,170 @@ Status PlasmaClient::Impl::CreateAndSealBatch(const std::vector<ObjectID>& objec
     digests.push_back(digest);
   }
 
-  RETURN_NOT_OK(SendCreateAndSealBatchRequest(store_conn_, object_ids, evict_if_full,
+  std::unique_lock<std::mutex> lock;
+  StoreConnection* conn = AcquireCreateConnection(&lock);
+  ARROW_LOG(DEBUG) << "called CreateAndSealBatch on conn " << conn->fd;
+  RETURN_NOT_OK(SendCreateAndSealBatchRequest(conn->fd, object_ids, evict_if_full,
                                               data, metadata, digests));
   std::vector<uint8_t> buffer;
   RETURN_NOT_OK(
-      PlasmaReceive(store_conn_, MessageType::PlasmaCreateAndSealBatchReply, &buffer));
+      PlasmaReceive(conn->fd, MessageType::PlasmaCreateAndSealBatchReply, &buffer));
   RETURN_NOT_OK(ReadCreateAndSealBatchReply(buffer.data(), buffer.size()));
 
   return Status::OK();
 }
 
-Status PlasmaClient::Impl::GetBuffers(
+Status PlasmaClient::Impl::CreateView(const ObjectID& parent_id, int64_t offset,
+                                      int64_t length, const ObjectID& object_id) {
+  std::unique_lock<std::mutex> lock;
+  StoreConnection* conn = AcquireCreateConnection(&lock);
+  ARROW_LOG(DEBUG) << "called CreateView on conn " << conn->fd;
+  RETURN_NOT_OK(SendCreateViewRequest(conn->fd, parent_id, offset, length, object_id));
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(PlasmaReceive(conn->fd, MessageType::PlasmaCreateViewReply, &buffer));
+  return ReadCreateViewReply(buffer.data(), buffer.size());
+}
+
+void PlasmaClient::Impl::GetLocalBuffers(
     const ObjectID* object_ids, int64_t num_objects, int64_t timeout_ms,
     const std::function<std::shared_ptr<Buffer>(
         const ObjectID&, const std::shared_ptr<Buffer>&)>& wrap_buffer,
-    ObjectBuffer* object_buffers) {
-  // Fill out the info for the objects that are already in use locally.
-  bool all_present = true;
+    ObjectBuffer* object_buffers, std::vector<int64_t>* missing) {
+  // Fill out the info for the objects that are already in use locally. This
+  // only takes the lock of the object's shard, so threads reading objects the
+  // client already holds neither wait for each other nor for the store.
   for (int64_t i = 0; i < num_objects; ++i) {
-    auto object_entry = objects_in_use_.find(object_ids[i]);
-    if (object_entry == objects_in_use_.end()) {
-      // This object is not currently in use by this client, so we need to send
-      // a request to the store.
-      all_present = false;
-    } else if (!object_entry->second->is_sealed) {
-      // This client created the object but hasn't sealed it. If we call Get
-      // with no timeout, we will deadlock, because this client won't be able to
-      // call Seal.
-      ARROW_CHECK(timeout_ms != -1)
-          << "Plasma client called get on an unsealed object that it created";
-      ARROW_LOG(WARNING)
-          << "Attempting to get an object that this client created but hasn't sealed.";
-      all_present = false;
+    ObjectsInUseShard& shard = GetShard(object_ids[i]);
+    PlasmaObject object;
+    uint8_t* base;
+    {
+      std::lock_guard<std::mutex> guard(shard.mutex);
+      auto object_entry = shard.objects.find(object_ids[i]);
+      if (object_entry == shard.objects.end()) {
+        // This object is not currently in use by this client, so we need to send
+        // a request to the store.
+        missing->push_back(i);
+        continue;
+      } else if (!object_entry->second->is_sealed) {
+        // This client created the object but hasn't sealed it. If we call Get
+        // with no timeout, we will deadlock, because this client won't be able to
+        // call Seal.
+        ARROW_CHECK(timeout_ms != -1)
+            << "Plasma client called get on an unsealed object that it created";
+        ARROW_LOG(WARNING)
+            << "Attempting to get an object that this client created but hasn't sealed.";
+        missing->push_back(i);
+        continue;
+      } else if (object_entry->second->count == 0 &&
+                 object_entry->second->lease != kNoLease &&
+                 !leases_->Acquire(object_entry->second->lease)) {
+        // The store took the idle lease back, and with it the object may be
+        // gone. Ask the store again.
+        shard.objects.erase(object_entry);
+        missing->push_back(i);
+        continue;
+      }
+      // Increment the count of the number of instances of this object that this
+      // client is using. Cache the reference to the object.
+      object_entry->second->count += 1;
+      object = object_entry->second->object;
+      base = object_entry->second->base;
+    }
+    std::shared_ptr<Buffer> physical_buf;
+    // The metadata follows the data, except in streams, where it follows their
+    // capacity.
+    const int64_t metadata_start = object.metadata_offset - object.data_offset;
+
+    if (object.device_num == 0) {
+      physical_buf = std::make_shared<Buffer>(base + object.data_offset,
+                                              metadata_start + object.metadata_size);
     } else {
-      PlasmaObject* object = &object_entry->second->object;
-      std::shared_ptr<Buffer> physical_buf;
-
-      if (object->device_num == 0) {
-        uint8_t* data = LookupMmappedFile(object->store_fd);
-        physical_buf = std::make_shared<Buffer>(
-            data + object->data_offset, object->data_size + object->metadata_size);
-      } else {
 #ifdef PLASMA_CUDA
-        std::lock_guard<std::mutex> lock(gpu_mutex);
-        auto iter = gpu_object_map.find(object_ids[i]);
-        ARROW_CHECK(iter != gpu_object_map.end());
-        iter->second->client_count++;
-        physical_buf = MakeBufferFromGpuProcessHandle(iter->second);
+      std::lock_guard<std::mutex> lock(gpu_mutex);
+      auto iter = gpu_object_map.find(object_ids[i]);
+      ARROW_CHECK(iter != gpu_object_map.end());
+      iter->second->client_count++;
+      physical_buf = MakeBufferFromGpuProcessHandle(iter->second);
 #else
-        ARROW_LOG(FATAL) << "Arrow GPU library is not enabled.";
+      ARROW_LOG(FATAL) << "Arrow GPU library is not enabled.";
 #endif
-      }
-      physical_buf = wrap_buffer(object_ids[i], physical_buf);
-      object_buffers[i].data = SliceBuffer(physical_buf, 0, object->data_size);
-      object_buffers[i].metadata =
-          SliceBuffer(physical_buf, object->data_size, object->metadata_size);
-      object_buffers[i].device_num = object->device_num;
-      // Increment the count of the number of instances of this object that this
-      // client is using. Cache the reference to the object.
-      IncrementObjectCount(object_ids[i], object, true);
     }
+    physical_buf = wrap_buffer(object_ids[i], physical_buf);
+    object_buffers[i].data = SliceBuffer(physical_buf, 0, object.data_size);
+    object_buffers[i].metadata =
+        SliceBuffer(physical_buf, metadata_start, object.metadata_size);
+    object_buffers[i].device_num = object.device_num;
   }
+}
 
-  if (all_present) {
-    return Status::OK();
+void PlasmaClient::Impl::GetRemoteBuffers(
+    const ObjectID* object_ids,
+    const std::function<std::shared_ptr<Buffer>(
+        const ObjectID&, const std::shared_ptr<Buffer>&)>& wrap_buffer,
+    ObjectBuffer* object_buffers, std::vector<int64_t>* missing) {
+  if (!remote_directory_ || missing->empty()) {
+    return;
+  }
+  std::vector<int64_t> still_missing;
+  for (int64_t i : *missing) {
+    PlasmaObject object;
+    if (!remote_directory_->Lookup(object_ids[i], &object) || object.device_num != 0) {
+      still_missing.push_back(i);
+      continue;
+    }
+    object.store_fd = -1;
+    const int64_t metadata_start = object.metadata_offset - object.data_offset;
+    std::shared_ptr<Buffer> physical_buf = std::make_shared<Buffer>(
+        remote_base_ + object.data_offset, metadata_start + object.metadata_size);
+    physical_buf = wrap_buffer(object_ids[i], physical_buf);
+    object_buffers[i].data = SliceBuffer(physical_buf, 0, object.data_size);
+    object_buffers[i].metadata =
+        SliceBuffer(physical_buf, metadata_start, object.metadata_size);
+    object_buffers[i].device_num = object.device_num;
+    // The remote store keeps no reference for this client, so there is no
+    // connection to release the object on.
+    IncrementObjectCount(object_ids[i], &object, remote_base_, nullptr, true);
   }
+  *missing = std::move(still_missing);
+}
 
-  // If we get here, then the objects aren't all currently in use by this
-  // client, so we need to send a request to the plasma store.
-  RETURN_NOT_OK(SendGetRequest(store_conn_, &object_ids[0], num_objects, timeout_ms));
-  std::vector<uint8_t> buffer;
-  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaGetReply, &buffer));
-  std::vector<ObjectID> received_object_ids(num_objects);
-  std::vector<PlasmaObject> object_data(num_objects);
+Status PlasmaClient::Impl::ProcessGetReply(
+    StoreConnection* conn, const uint8_t* data, size_t size, const ObjectID* object_ids,
+    const std::vector<int64_t>& missing,
+    const std::function<std::shared_ptr<Buffer>(
+        const ObjectID&, const std::shared_ptr<Buffer>&)>& wrap_buffer,
+    ObjectBuffer* object_buffers, std::vector<ObjectID>* duplicates) {
+  const int64_t num_missing = static_cast<int64_t>(missing.size());
+  std::vector<ObjectID> received_object_ids(num_missing);
+  std::vector<PlasmaObject> object_data(num_missing);
   PlasmaObject* object;
   std::vector<int> store_fds;
   std::vector<int64_t> mmap_sizes;
-  RETURN_NOT_OK(ReadGetReply(buffer.data(), buffer.size(), received_object_ids.data(),
-                             object_data.data(), num_objects, store_fds, mmap_sizes));
+  std::vector<int64_t> leases;
+  RETURN_NOT_OK(ReadGetReply(data, size, received_object_ids.data(), object_data.data(),
+                             num_missing, store_fds, mmap_sizes, nullptr, &leases));
 
   // We mmap all of the file descriptors here so that we can avoid look them up
   // in the subsequent loop based on just the store file descriptor and without
   // having to know the relevant file descriptor received from recv_fd.
   for (size_t i = 0; i < store_fds.size(); i++) {
-    int fd = GetStoreFd(store_fds[i]);
-    LookupOrMmap(fd, store_fds[i], mmap_sizes[i]);
+    MapStoreFd(conn, store_fds[i], mmap_sizes[i]);
   }
 
-  for (int64_t i = 0; i < num_objects; ++i) {
-    DCHECK(received_object_ids[i] == object_ids[i]);
-    object = &object_data[i];
-    if (object_buffers[i].data) {
-      // If the object was already in use by the client, then the store should
-      // have returned it.
-      DCHECK_NE(object->data_size, -1);
-      // We've already filled out the information for this object, so we can
-      // just continue.
-      continue;
-    }
+  for (int64_t j = 0; j < num_missing; ++j) {
+    const int64_t i = missing[j];
+    DCHECK(received_object_ids[j] == object_ids[i]);
+    object = &object_data[j];
     // If we are here, the object was not currently in use, so we need to
     // process the reply from the object store.
     if (object->data_size != -1) {
       std::shared_ptr<Buffer> physical_buf;
+      uint8_t* base = nullptr;
+      const int64_t metadata_start = object->metadata_offset - object->data_offset;
       if (object->device_num == 0) {
-        uint8_t* data = LookupMmappedFile(object->store_fd);
-        physical_buf = std::make_shared<Buffer>(
-            data + object->data_offset, object->data_size + object->metadata_size);
+        base = LookupMmappedFile(object->store_fd);
+        physical_buf = std::make_shared<Buffer>(base + object->data_offset,
+                                                metadata_start + object->metadata_size);
       } else {
 #ifdef PLASMA_CUDA
         std::lock_guard<std::mutex> lock(gpu_mutex);
@@ -669,11 +1192,20 @@ Status PlasmaClient::Impl::GetBuffers(
       physical_buf = wrap_buffer(object_ids[i], physical_buf);
       object_buffers[i].data = SliceBuffer(physical_buf, 0, object->data_size);
       object_buffers[i].metadata =
-          SliceBuffer(physical_buf, object->data_size, object->metadata_size);
+          SliceBuffer(physical_buf, metadata_start, object->metadata_size);
       object_buffers[i].device_num = object->device_num;
+      // Without the lease table, the lease stays active until the object is
+      // released through the store, which then drops it.
+      int64_t lease = leases.empty() ? kNoLease : leases[j];
+      if (lease != kNoLease && LookupLeaseTable(object->store_fd) == nullptr) {
+        lease = kNoLease;
+      }
       // Increment the count of the number of instances of this object that this
       // client is using. Cache the reference to the object.
-      IncrementObjectCount(received_object_ids[i], object, true);
+      if (IncrementObjectCount(received_object_ids[j], object, base, conn, true,
+                               lease)) {
+        duplicates->push_back(received_object_ids[j]);
+      }
     } else {
       // The object was not retrieved.  The caller can detect this condition
       // by checking the boolean value of the metadata/data buffers.
@@ -684,10 +1216,64 @@ Status PlasmaClient::Impl::GetBuffers(
   return Status::OK();
 }
 
+Status PlasmaClient::Impl::GetStoreBuffers(
+    const ObjectID* object_ids, int64_t timeout_ms,
+    const std::function<std::shared_ptr<Buffer>(
+        const ObjectID&, const std::shared_ptr<Buffer>&)>& wrap_buffer,
+    ObjectBuffer* object_buffers, std::vector<int64_t>* missing) {
+  const int64_t num_missing = static_cast<int64_t>(missing->size());
+  std::vector<ObjectID> missing_ids(num_missing);
+  for (int64_t j = 0; j < num_missing; ++j) {
+    missing_ids[j] = object_ids[(*missing)[j]];
+  }
+  std::unique_lock<std::mutex> lock;
+  StoreConnection* conn = AcquireConnection(&lock);
+  RETURN_NOT_OK(SendGetRequest(conn->fd, missing_ids.data(), num_missing, timeout_ms));
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(PlasmaReceive(conn->fd, MessageType::PlasmaGetReply, &buffer));
+  std::vector<ObjectID> duplicates;
+  RETURN_NOT_OK(ProcessGetReply(conn, buffer.data(), buffer.size(), object_ids, *missing,
+                                wrap_buffer, object_buffers, &duplicates));
+  for (const auto& object_id : duplicates) {
+    RETURN_NOT_OK(SendReleaseRequest(conn->fd, object_id));
+  }
+  missing->erase(std::remove_if(missing->begin(), missing->end(),
+                                [&](int64_t i) { return !!object_buffers[i].data; }),
+                 missing->end());
+  return Status::OK();
+}
+
+Status PlasmaClient::Impl::GetBuffers(
+    const ObjectID* object_ids, int64_t num_objects, int64_t timeout_ms,
+    const std::function<std::shared_ptr<Buffer>(
+        const ObjectID&, const std::shared_ptr<Buffer>&)>& wrap_buffer,
+    ObjectBuffer* object_buffers) {
+  std::vector<int64_t> missing;
+  GetLocalBuffers(object_ids, num_objects, timeout_ms, wrap_buffer, object_buffers,
+                  &missing);
+  if (missing.empty()) {
+    return Status::OK();
+  }
+
+  // If we get here, then the objects aren't all currently in use by this
+  // client, so we need to send a request to the plasma store for the missing
+  // ones.
+  if (!remote_directory_) {
+    return GetStoreBuffers(object_ids, timeout_ms, wrap_buffer, object_buffers, &missing);
+  }
+  // The local store is asked first without waiting, and only the objects it
+  // does not hold are looked up in the directory of the remote region. The
+  // objects neither has are then waited for at the store.
+  RETURN_NOT_OK(GetStoreBuffers(object_ids, 0, wrap_buffer, object_buffers, &missing));
+  GetRemoteBuffers(object_ids, wrap_buffer, object_buffers, &missing);
+  if (missing.empty() || timeout_ms == 0) {
+    return Status::OK();
+  }
+  return GetStoreBuffers(object_ids, timeout_ms, wrap_buffer, object_buffers, &missing);
+}
+
 Status PlasmaClient::Impl::Get(const std::vector<ObjectID>& object_ids,
                                int64_t timeout_ms, std::vector<ObjectBuffer>* out) {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
-
   const auto wrap_buffer = [=](const ObjectID& object_id,
                                const std::shared_ptr<Buffer>& buffer) {
     return std::make_shared<PlasmaBuffer>(shared_from_this(), object_id, buffer);
@@ -699,32 +1285,314 @@ Status PlasmaClient::Impl::Get(const std::vector<ObjectID>& object_ids,
 
 Status PlasmaClient::Impl::Get(const ObjectID* object_ids, int64_t num_objects,
                                int64_t timeout_ms, ObjectBuffer* out) {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
-
   const auto wrap_buffer = [](const ObjectID& object_id,
                               const std::shared_ptr<Buffer>& buffer) { return buffer; };
   return GetBuffers(object_ids, num_objects, timeout_ms, wrap_buffer, out);
 }
 
-Status PlasmaClient::Impl::MarkObjectUnused(const ObjectID& object_id) {
-  auto object_entry = objects_in_use_.find(object_id);
-  ARROW_CHECK(object_entry != objects_in_use_.end());
+Status PlasmaClient::Impl::Wait(const std::vector<ObjectID>& object_ids,
+                                int64_t num_ready, int64_t timeout_ms,
+                                std::vector<ObjectID>* ready_ids) {
+  const std::unordered_set<ObjectID> unique_ids(object_ids.begin(), object_ids.end());
+  if (num_ready < 1 || num_ready > static_cast<int64_t>(unique_ids.size())) {
+    return Status::Invalid("Wait() called with num_ready ", num_ready, " for ",
+                           unique_ids.size(), " objects");
+  }
+  std::unique_lock<std::mutex> lock;
+  StoreConnection* conn = AcquireConnection(&lock);
+  RETURN_NOT_OK(SendWaitRequest(conn->fd, object_ids, num_ready, timeout_ms));
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(PlasmaReceive(conn->fd, MessageType::PlasmaWaitReply, &buffer));
+  ready_ids->clear();
+  return ReadWaitReply(buffer.data(), buffer.size(), ready_ids);
+}
+
+Status PlasmaClient::Impl::GetPipelinedConnection(PipelinedConnection** conn) {
+  std::lock_guard<std::mutex> guard(pipeline_mutex_);
+  if (!pipelined_conn_) {
+    if (!connected_) {
+      return Status::Invalid("PlasmaClient is not connected");
+    }
+    std::shared_ptr<PipelinedConnection> new_conn = std::make_shared<PipelinedConnection>();
+    RETURN_NOT_OK(
+        ConnectIpcSocketRetry(store_socket_name_, num_retries_, -1, &new_conn->fd));
+    pipeline_reader_ = std::thread(ReadPipelinedReplies, new_conn);
+    pipelined_conn_ = std::move(new_conn);
+  }
+  *conn = pipelined_conn_.get();
+  return Status::OK();
+}
+
+void PlasmaClient::Impl::SendPipelinedRequest(
+    PipelinedConnection* conn, const std::function<Status(int, uint64_t)>& send,
+    ReplyHandler handler, const std::vector<ObjectID>& get_object_ids) {
+  Status status;
+  {
+    std::lock_guard<std::mutex> conn_guard(conn->mutex);
+    uint64_t request_id = 0;
+    {
+      std::lock_guard<std::mutex> guard(conn->state_mutex);
+      // The handler of a get always accounts for the objects in
+      // FinishPipelinedGet, even if the request is never sent.
+      for (const auto& object_id : get_object_ids) {
+        ++conn->gets_in_flight[object_id];
+      }
+      status = conn->status;
+      if (status.ok()) {
+        request_id = ++conn->next_request_id;
+        conn->pending_replies.emplace(request_id, handler);
+      }
+    }
+    if (status.ok()) {
+      status = send(conn->fd, request_id);
+      if (!status.ok()) {
+        std::lock_guard<std::mutex> guard(conn->state_mutex);
+        if (conn->pending_replies.erase(request_id) == 0) {
+          // The reader thread saw the connection break and already called the
+          // handler.
+          return;
+        }
+      }
+    }
+  }
+  if (!status.ok()) {
+    handler(status, nullptr, 0);
+  }
+}
+
+void PlasmaClient::Impl::ReadPipelinedReplies(std::shared_ptr<PipelinedConnection> conn) {
+  Status status;
+  std::vector<uint8_t> buffer;
+  while (true) {
+    MessageType type;
+    status = ReadMessage(conn->fd, &type, &buffer);
+    if (!status.ok()) {
+      break;
+    }
+    if (type == MessageType::PlasmaAbortReply) {
+      // Abort does not wait for its reply on this connection.
+      continue;
+    }
+    uint64_t request_id;
+    status = ReadReplyRequestId(type, buffer.data(), buffer.size(), &request_id);
+    if (!status.ok()) {
+      break;
+    }
+    ReplyHandler handler;
+    {
+      std::lock_guard<std::mutex> guard(conn->state_mutex);
+      auto it = conn->pending_replies.find(request_id);
+      if (it != conn->pending_replies.end()) {
+        handler = std::move(it->second);
+        conn->pending_replies.erase(it);
+      }
+    }
+    if (!handler) {
+      status = Status::IOError("Plasma store replied to unknown request ", request_id);
+      break;
+    }
+    handler(Status::OK(), buffer.data(), buffer.size());
+  }
+
+  // Fail the outstanding requests, and the ones sent from now on.
+  std::unordered_map<uint64_t, ReplyHandler> pending;
+  {
+    std::lock_guard<std::mutex> guard(conn->state_mutex);
+    conn->status = status;
+    pending.swap(conn->pending_replies);
+  }
+  for (auto& entry : pending) {
+    entry.second(status, nullptr, 0);
+  }
+}
+
+void PlasmaClient::Impl::StopPipeline() {
+  std::lock_guard<std::mutex> guard(pipeline_mutex_);
+  if (!pipeline_reader_.joinable()) {
+    return;
+  }
+  // Wake up the reader thread. The socket itself is closed when the last
+  // reference to the connection goes away.
+  shutdown(pipelined_conn_->fd, SHUT_RDWR);
+  if (pipeline_reader_.get_id() == std::this_thread::get_id()) {
+    // The last reference to the client went away in a reply handler.
+    pipeline_reader_.detach();
+  } else {
+    pipeline_reader_.join();
+  }
+}
+
+void PlasmaClient::Impl::FinishPipelinedGet(PipelinedConnection* conn,
+                                            const std::vector<ObjectID>& object_ids,
+                                            const std::vector<ObjectID>& duplicates) {
+  std::vector<ObjectID> released;
+  {
+    std::lock_guard<std::mutex> conn_guard(conn->mutex);
+    for (const auto& object_id : duplicates) {
+      ARROW_UNUSED(SendReleaseRequest(conn->fd, object_id));
+    }
+    for (const auto& object_id : object_ids) {
+      ObjectsInUseShard& shard = GetShard(object_id);
+      std::lock_guard<std::mutex> shard_guard(shard.mutex);
+      {
+        std::lock_guard<std::mutex> guard(conn->state_mutex);
+        auto it = conn->gets_in_flight.find(object_id);
+        ARROW_CHECK(it != conn->gets_in_flight.end());
+        if (--it->second > 0) {
+          continue;
+        }
+        conn->gets_in_flight.erase(it);
+      }
+      // Release the object if Release left it to this get. Release never does
+      // that for leased objects, whose entries stay while the lease is idle.
+      auto object_entry = shard.objects.find(object_id);
+      if (object_entry != shard.objects.end() && object_entry->second->count == 0 &&
+          object_entry->second->lease == kNoLease) {
+        ARROW_CHECK(object_entry->second->conn == conn);
+        ARROW_UNUSED(MarkObjectUnused(&shard, object_id));
+        ARROW_UNUSED(SendReleaseRequest(conn->fd, object_id));
+        released.push_back(object_id);
+      }
+    }
+  }
+  for (const auto& object_id : released) {
+    bool pending_delete;
+    {
+      std::lock_guard<std::mutex> guard(deletion_mutex_);
+      pending_delete = deletion_cache_.erase(object_id) > 0;
+    }
+    if (pending_delete) {
+      ARROW_UNUSED(Delete({object_id}));
+    }
+  }
+}
+
+arrow::Future<std::shared_ptr<Buffer>> PlasmaClient::Impl::CreateAsync(
+    const ObjectID& object_id, int64_t data_size, const uint8_t* metadata,
+    int64_t metadata_size, bool evict_if_full) {
+  using BufferFuture = arrow::Future<std::shared_ptr<Buffer>>;
+  if (has_quota_) {
+    // The store charges the quota to the first connection only.
+    return BufferFuture::MakeFinished(Status::NotImplemented(
+        "Asynchronous creates are not supported for clients with a memory quota"));
+  }
+  PipelinedConnection* conn;
+  Status s = GetPipelinedConnection(&conn);
+  if (!s.ok()) {
+    return BufferFuture::MakeFinished(s);
+  }
+  // The caller's metadata may be gone by the time the reply arrives.
+  const bool has_metadata = metadata != NULL;
+  std::string metadata_copy;
+  if (has_metadata) {
+    metadata_copy.assign(reinterpret_cast<const char*>(metadata), metadata_size);
+  }
+  auto future = BufferFuture::Make();
+  auto self = shared_from_this();
+  SendPipelinedRequest(
+      conn,
+      [&](int fd, uint64_t request_id) {
+        return SendCreateRequest(fd, object_id, evict_if_full, data_size, metadata_size,
+                                 /*device_num=*/0, request_id);
+      },
+      [self, conn, future, object_id, data_size, has_metadata, metadata_copy,
+       metadata_size](const Status& status, const uint8_t* data, size_t size) mutable {
+        if (!status.ok()) {
+          future.MarkFinished(status);
+          return;
+        }
+        const uint8_t* metadata =
+            has_metadata ? reinterpret_cast<const uint8_t*>(metadata_copy.data()) : NULL;
+        future.MarkFinished(self->ProcessCreateReply(conn, data, size, object_id,
+                                                     data_size, metadata, metadata_size,
+                                                     /*device_num=*/0));
+      });
+  return future;
+}
+
+arrow::Future<std::vector<ObjectBuffer>> PlasmaClient::Impl::GetAsync(
+    const std::vector<ObjectID>& object_ids, int64_t timeout_ms) {
+  using BuffersFuture = arrow::Future<std::vector<ObjectBuffer>>;
+  auto self = shared_from_this();
+  const auto wrap_buffer = [self](const ObjectID& object_id,
+                                  const std::shared_ptr<Buffer>& buffer) {
+    return std::make_shared<PlasmaBuffer>(self, object_id, buffer);
+  };
+  auto buffers = std::make_shared<std::vector<ObjectBuffer>>(object_ids.size());
+  std::vector<int64_t> missing;
+  GetLocalBuffers(object_ids.data(), object_ids.size(), timeout_ms, wrap_buffer,
+                  buffers->data(), &missing);
+  if (missing.empty()) {
+    return BuffersFuture::MakeFinished(std::move(*buffers));
+  }
+  PipelinedConnection* conn;
+  Status s = GetPipelinedConnection(&conn);
+  if (!s.ok()) {
+    return BuffersFuture::MakeFinished(s);
+  }
+
+  std::vector<ObjectID> missing_ids(missing.size());
+  for (size_t j = 0; j < missing.size(); ++j) {
+    missing_ids[j] = object_ids[missing[j]];
+  }
+  auto future = BuffersFuture::Make();
+  SendPipelinedRequest(
+      conn,
+      [&](int fd, uint64_t request_id) {
+        return SendGetRequest(fd, missing_ids.data(), missing_ids.size(), timeout_ms,
+                              request_id);
+      },
+      [self, conn, future, object_ids, missing, missing_ids, wrap_buffer, buffers](
+          const Status& status, const uint8_t* data, size_t size) mutable {
+        std::vector<ObjectID> duplicates;
+        Status s = status;
+        if (s.ok()) {
+          s = self->ProcessGetReply(conn, data, size, object_ids.data(), missing,
+                                    wrap_buffer, buffers->data(), &duplicates);
+        }
+        if (s.ok()) {
+          // Only the objects the local store does not hold are looked up in
+          // the directory of the remote region.
+          std::vector<int64_t> still_missing;
+          for (int64_t i : missing) {
+            if (!(*buffers)[i].data) {
+              still_missing.push_back(i);
+            }
+          }
+          self->GetRemoteBuffers(object_ids.data(), wrap_buffer, buffers->data(),
+                                 &still_missing);
+        }
+        self->FinishPipelinedGet(conn, missing_ids, duplicates);
+        if (s.ok()) {
+          future.MarkFinished(std::move(*buffers));
+        } else {
+          future.MarkFinished(s);
+        }
+      },
+      missing_ids);
+  return future;
+}
+
+Status PlasmaClient::Impl::MarkObjectUnused(ObjectsInUseShard* shard,
+                                            const ObjectID& object_id) {
+  auto object_entry = shard->objects.find(object_id);
+  ARROW_CHECK(object_entry != shard->objects.end());
   ARROW_CHECK(object_entry->second->count == 0);
 
   // Remove the entry from the hash table of objects currently in use.
-  objects_in_use_.erase(object_id);
+  shard->objects.erase(object_entry);
   return Status::OK();
 }
 
 Status PlasmaClient::Impl::Release(const ObjectID& object_id) {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
-
   // If the client is already disconnected, ignore release requests.
-  if (store_conn_ < 0) {
+  if (!connected_) {
     return Status::OK();
   }
-  auto object_entry = objects_in_use_.find(object_id);
-  ARROW_CHECK(object_entry != objects_in_use_.end());
+  ObjectsInUseShard& shard = GetShard(object_id);
+  std::unique_lock<std::mutex> shard_lock(shard.mutex);
+  auto object_entry = shard.objects.find(object_id);
+  ARROW_CHECK(object_entry != shard.objects.end());
 
 #ifdef PLASMA_CUDA
   if (object_entry->second->object.device_num != 0) {
@@ -738,35 +1606,175 @@ Status PlasmaClient::Impl::Release(const ObjectID& object_id) {
   }
 #endif
 
+  if (object_entry->second->count > 1) {
+    // Other instances are still in use, the store does not need to know.
+    object_entry->second->count -= 1;
+    return Status::OK();
+  }
+
+  if (object_entry->second->lease != kNoLease) {
+    bool pending_delete;
+    {
+      std::lock_guard<std::mutex> guard(deletion_mutex_);
+      pending_delete = deletion_cache_.count(object_id) > 0;
+    }
+    if (!pending_delete) {
+      // Keep the object under an idle lease. The store takes the lease back
+      // when it needs the memory.
+      object_entry->second->count -= 1;
+      leases_->Release(object_entry->second->lease);
+      return Status::OK();
+    }
+    // The object is to be deleted, so give it back to the store, which drops
+    // the lease with the reference.
+    object_entry->second->lease = kNoLease;
+  }
+
+  // This may be the last instance. Connections are locked before shards, so
+  // drop the shard lock to lock the object's connection. The entry stays in
+  // the table meanwhile since this call still holds one of its instances.
+  StoreConnection* conn = object_entry->second->conn;
+  if (conn == nullptr) {
+    // The object came from the remote directory, no store needs to know.
+    object_entry->second->count -= 1;
+    return MarkObjectUnused(&shard, object_id);
+  }
+  shard_lock.unlock();
+  std::unique_lock<std::mutex> conn_lock(conn->mutex);
+  shard_lock.lock();
+  object_entry = shard.objects.find(object_id);
+  ARROW_CHECK(object_entry != shard.objects.end());
+
   object_entry->second->count -= 1;
   ARROW_CHECK(object_entry->second->count >= 0);
   // Check if the client is no longer using this object.
   if (object_entry->second->count == 0) {
+    if (conn->pipelined) {
+      auto pipelined_conn = static_cast<PipelinedConnection*>(conn);
+      std::lock_guard<std::mutex> guard(pipelined_conn->state_mutex);
+      if (pipelined_conn->gets_in_flight.count(object_id) > 0) {
+        // The store may have handed out the reference of an outstanding get
+        // already, and releasing it now would drop that one too. Keep the entry
+        // around; FinishPipelinedGet releases it if the get doesn't use it.
+        return Status::OK();
+      }
+    }
     // Tell the store that the client no longer needs the object.
-    RETURN_NOT_OK(MarkObjectUnused(object_id));
-    RETURN_NOT_OK(SendReleaseRequest(store_conn_, object_id));
-    auto iter = deletion_cache_.find(object_id);
-    if (iter != deletion_cache_.end()) {
-      deletion_cache_.erase(object_id);
+    RETURN_NOT_OK(MarkObjectUnused(&shard, object_id));
+    shard_lock.unlock();
+    RETURN_NOT_OK(SendReleaseRequest(conn->fd, object_id));
+    conn_lock.unlock();
+    bool pending_delete;
+    {
+      std::lock_guard<std::mutex> guard(deletion_mutex_);
+      pending_delete = deletion_cache_.erase(object_id) > 0;
+    }
+    if (pending_delete) {
       RETURN_NOT_OK(Delete({object_id}));
     }
   }
   return Status::OK();
 }
 
+Status PlasmaClient::Impl::Prefetch(const std::vector<ObjectID>& object_ids) {
+  if (!remote_directory_ || object_ids.empty()) {
+    // Only the objects in the remote region are slow to touch the first time.
+    return Status::OK();
+  }
+  {
+    std::lock_guard<std::mutex> guard(prefetch_mutex_);
+    if (stop_prefetcher_) {
+      return Status::OK();
+    }
+    if (!prefetcher_.joinable()) {
+      prefetcher_ = std::thread(&PlasmaClient::Impl::RunPrefetcher, this);
+    }
+    for (const auto& object_id : object_ids) {
+      // A reader that is far behind its prefetches would only evict the pages
+      // it is about to read, so the oldest prefetches give way.
+      if (prefetch_queue_.size() == kMaxPrefetchQueueSize) {
+        prefetch_queue_.pop_front();
+      }
+      prefetch_queue_.push_back(object_id);
+    }
+  }
+  prefetch_cond_.notify_one();
+  return Status::OK();
+}
+
+void PlasmaClient::Impl::RunPrefetcher() {
+  std::unique_lock<std::mutex> lock(prefetch_mutex_);
+  while (true) {
+    prefetch_cond_.wait(lock,
+                        [this] { return stop_prefetcher_ || !prefetch_queue_.empty(); });
+    if (stop_prefetcher_) {
+      return;
+    }
+    ObjectID object_id = prefetch_queue_.front();
+    prefetch_queue_.pop_front();
+    lock.unlock();
+    PrefetchObject(object_id);
+    lock.lock();
+  }
+}
+
+void PlasmaClient::Impl::PrefetchObject(const ObjectID& object_id) {
+  // The directory lives in the remote region too, so the lookup is done here
+  // rather than in Prefetch.
+  PlasmaObject object;
+  if (!remote_directory_->Lookup(object_id, &object) || object.device_num != 0) {
+    return;
+  }
+  static const uintptr_t page_size = sysconf(_SC_PAGESIZE);
+  uintptr_t start = reinterpret_cast<uintptr_t>(remote_base_ + object.data_offset);
+  uintptr_t end = reinterpret_cast<uintptr_t>(remote_base_ + object.metadata_offset +
+                                              object.metadata_size);
+  start &= ~(page_size - 1);
+  void* address = reinterpret_cast<void*>(start);
+  size_t length = end - start;
+#ifdef MADV_POPULATE_READ
+  // Fault the pages in, so that reading them later does not even take a minor
+  // fault.
+  if (madvise(address, length, MADV_POPULATE_READ) == 0) {
+    return;
+  }
+#endif
+  // Older kernels only read the pages ahead, which is what matters for remote
+  // memory backed by a file.
+  if (madvise(address, length, MADV_WILLNEED) != 0) {
+    // Read the pages one by one instead, e.g. for device memory.
+    volatile uint8_t sink = 0;
+    for (uintptr_t page = start; page < end; page += page_size) {
+      sink ^= *reinterpret_cast<const uint8_t*>(page);
+    }
+  }
+}
+
+void PlasmaClient::Impl::StopPrefetcher() {
+  {
+    std::lock_guard<std::mutex> guard(prefetch_mutex_);
+    stop_prefetcher_ = true;
+    prefetch_queue_.clear();
+  }
+  prefetch_cond_.notify_one();
+  if (prefetcher_.joinable()) {
+    prefetcher_.join();
+  }
+}
+
 // This method is used to query whether the plasma store contains an object.
 Status PlasmaClient::Impl::Contains(const ObjectID& object_id, bool* has_object) {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
-
   // Check if we already have a reference to the object.
-  if (objects_in_use_.count(object_id) > 0) {
+  if (IsInUse(object_id)) {
     *has_object = 1;
   } else {
     // If we don't already have a reference to the object, check with the store
     // to see if we have the object.
-    RETURN_NOT_OK(SendContainsRequest(store_conn_, object_id));
+    std::unique_lock<std::mutex> lock;
+    StoreConnection* conn = AcquireConnection(&lock);
+    RETURN_NOT_OK(SendContainsRequest(conn->fd, object_id));
     std::vector<uint8_t> buffer;
-    RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaContainsReply, &buffer));
+    RETURN_NOT_OK(PlasmaReceive(conn->fd, MessageType::PlasmaContainsReply, &buffer));
     ObjectID object_id2;
     DCHECK_GT(buffer.size(), 0);
     RETURN_NOT_OK(
@@ -776,11 +1784,75 @@ Status PlasmaClient::Impl::Contains(const ObjectID& object_id, bool* has_object)
 }
 
 Status PlasmaClient::Impl::List(ObjectTable* objects) {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
-  RETURN_NOT_OK(SendListRequest(store_conn_));
-  std::vector<uint8_t> buffer;
-  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaListReply, &buffer));
-  return ReadListReply(buffer.data(), buffer.size(), objects);
+  // Pages keep each reply, and the time the store spends on it, small. A
+  // listing that starts over only adds objects that are in objects already.
+  uint64_t cursor = 0;
+  do {
+    RETURN_NOT_OK(List(ObjectListFilter(), kListPageSize, &cursor, objects, nullptr));
+  } while (cursor != 0);
+  return Status::OK();
+}
+
+Status PlasmaClient::Impl::List(const ObjectListFilter& filter, int64_t page_size,
+                                uint64_t* cursor, ObjectTable* objects,
+                                bool* restarted) {
+  if (restarted != nullptr) {
+    *restarted = false;
+  }
+  int64_t num_listed = 0;
+  if ((*cursor & kRemoteListCursor) == 0) {
+    std::unique_lock<std::mutex> lock;
+    StoreConnection* conn = AcquireConnection(&lock);
+    RETURN_NOT_OK(SendListRequest(conn->fd, filter, page_size, *cursor));
+    std::vector<uint8_t> buffer;
+    RETURN_NOT_OK(PlasmaReceive(conn->fd, MessageType::PlasmaListReply, &buffer));
+    const size_t num_objects = objects->size();
+    RETURN_NOT_OK(
+        ReadListReply(buffer.data(), buffer.size(), objects, cursor, restarted));
+    num_listed = objects->size() - num_objects;
+    if (*cursor != 0 || !filter.include_remote) {
+      return Status::OK();
+    }
+    *cursor = kRemoteListCursor;
+  }
+
+  // The remote store is not asked, since the directory in its region has its
+  // sealed objects. It knows neither their age nor who created them.
+  const int sealed = 1 << static_cast<int>(ObjectState::PLASMA_SEALED);
+  if (!remote_directory_ || filter.min_age != 0 || filter.max_age != -1 ||
+      !filter.owner.empty() || (filter.state_mask != 0 && !(filter.state_mask & sealed))) {
+    *cursor = 0;
+    return Status::OK();
+  }
+  const int64_t max_objects =
+      page_size > 0 ? page_size - num_listed : remote_directory_->capacity();
+  if (max_objects <= 0) {
+    return Status::OK();
+  }
+  std::vector<std::pair<ObjectID, PlasmaObject>> found;
+  const int64_t slot = remote_directory_->Scan(
+      static_cast<int64_t>(*cursor & ~kRemoteListCursor), max_objects, &found);
+  for (const auto& object : found) {
+    const int64_t size = object.second.data_size + object.second.metadata_size;
+    if (size < filter.min_size || (filter.max_size != -1 && size > filter.max_size)) {
+      continue;
+    }
+    auto entry = std::unique_ptr<ObjectTableEntry>(new ObjectTableEntry());
+    entry->fd = -1;
+    entry->device_num = object.second.device_num;
+    entry->offset = object.second.data_offset;
+    entry->data_size = object.second.data_size;
+    entry->metadata_size = object.second.metadata_size;
+    entry->create_time = 0;
+    entry->construct_duration = 0;
+    entry->state = ObjectState::PLASMA_SEALED;
+    // An object in both regions is listed as the local one.
+    objects->emplace(object.first, std::move(entry));
+  }
+  *cursor = slot == remote_directory_->capacity()
+                ? 0
+                : kRemoteListCursor | static_cast<uint64_t>(slot);
+  return Status::OK();
 }
 
 static void ComputeBlockHash(const unsigned char* data, int64_t nbytes, uint64_t* hash) {
@@ -853,33 +1925,48 @@ uint64_t PlasmaClient::Impl::ComputeObjectHashCPU(const uint8_t* data, int64_t d
   return XXH64_digest(&hash_state);
 }
 
-Status PlasmaClient::Impl::Seal(const ObjectID& object_id) {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
-
+Status PlasmaClient::Impl::PrepareSeal(const ObjectID& object_id, std::string* digest) {
   // Make sure this client has a reference to the object before sending the
   // request to Plasma.
-  auto object_entry = objects_in_use_.find(object_id);
+  {
+    ObjectsInUseShard& shard = GetShard(object_id);
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    auto object_entry = shard.objects.find(object_id);
+
+    if (object_entry == shard.objects.end()) {
+      return MakePlasmaError(PlasmaErrorCode::PlasmaObjectNotFound,
+                             "Seal() called on an object without a reference to it");
+    }
+    if (object_entry->second->is_sealed) {
+      return MakePlasmaError(PlasmaErrorCode::PlasmaObjectAlreadySealed,
+                             "Seal() called on an already sealed object");
+    }
 
-  if (object_entry == objects_in_use_.end()) {
-    return MakePlasmaError(PlasmaErrorCode::PlasmaObjectNotFound,
-                           "Seal() called on an object without a reference to it");
-  }
-  if (object_entry->second->is_sealed) {
-    return MakePlasmaError(PlasmaErrorCode::PlasmaObjectAlreadySealed,
-                           "Seal() called on an already sealed object");
+    object_entry->second->is_sealed = true;
+    if (object_entry->second->stream_size != -1) {
+      // The store seals the stream at what was published, so only hash that.
+      object_entry->second->object.data_size = object_entry->second->stream_size;
+    }
   }
+  digest->resize(kDigestSize);
+  return Hash(object_id, reinterpret_cast<uint8_t*>(&(*digest)[0]));
+}
 
-  object_entry->second->is_sealed = true;
-  /// Send the seal request to Plasma.
-  std::vector<uint8_t> digest(kDigestSize);
-  RETURN_NOT_OK(Hash(object_id, &digest[0]));
-  RETURN_NOT_OK(
-      SendSealRequest(store_conn_, object_id, std::string(digest.begin(), digest.end())));
-  std::vector<uint8_t> buffer;
-  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaSealReply, &buffer));
-  ObjectID sealed_id;
-  RETURN_NOT_OK(ReadSealReply(buffer.data(), buffer.size(), &sealed_id));
-  ARROW_CHECK(sealed_id == object_id);
+Status PlasmaClient::Impl::Seal(const ObjectID& object_id) {
+  std::string digest;
+  RETURN_NOT_OK(PrepareSeal(object_id, &digest));
+  /// Send the seal request to Plasma. The store does not care which
+  /// connection an object is sealed on.
+  {
+    std::unique_lock<std::mutex> lock;
+    StoreConnection* conn = AcquireConnection(&lock);
+    RETURN_NOT_OK(SendSealRequest(conn->fd, object_id, digest));
+    std::vector<uint8_t> buffer;
+    RETURN_NOT_OK(PlasmaReceive(conn->fd, MessageType::PlasmaSealReply, &buffer));
+    ObjectID sealed_id;
+    RETURN_NOT_OK(ReadSealReply(buffer.data(), buffer.size(), &sealed_id));
+    ARROW_CHECK(sealed_id == object_id);
+  }
   // We call PlasmaClient::Release to decrement the number of instances of this
   // object
   // that are currently being used by this client. The corresponding increment
@@ -888,10 +1975,146 @@ Status PlasmaClient::Impl::Seal(const ObjectID& object_id) {
   return Release(object_id);
 }
 
+Status PlasmaClient::Impl::CreateStream(const ObjectID& object_id, int64_t capacity,
+                                        const uint8_t* metadata, int64_t metadata_size,
+                                        std::shared_ptr<Buffer>* data,
+                                        bool evict_if_full) {
+  {
+    std::unique_lock<std::mutex> lock;
+    StoreConnection* conn = AcquireCreateConnection(&lock);
+    ARROW_LOG(DEBUG) << "called CreateStream on conn " << conn->fd << " with capacity "
+                     << capacity << " and metadata size " << metadata_size;
+    RETURN_NOT_OK(SendCreateStreamRequest(conn->fd, object_id, evict_if_full, capacity,
+                                          metadata_size));
+    std::vector<uint8_t> buffer;
+    RETURN_NOT_OK(PlasmaReceive(conn->fd, MessageType::PlasmaCreateReply, &buffer));
+    ARROW_ASSIGN_OR_RAISE(*data, ProcessCreateReply(conn, buffer.data(), buffer.size(),
+                                                    object_id, capacity, metadata,
+                                                    metadata_size, /*device_num=*/0));
+  }
+  ObjectsInUseShard& shard = GetShard(object_id);
+  std::lock_guard<std::mutex> guard(shard.mutex);
+  shard.objects[object_id]->stream_size = 0;
+  return Status::OK();
+}
+
+Status PlasmaClient::Impl::Append(const ObjectID& object_id, const uint8_t* data,
+                                  int64_t size) {
+  uint8_t* end;
+  int64_t stream_size;
+  {
+    ObjectsInUseShard& shard = GetShard(object_id);
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    auto object_entry = shard.objects.find(object_id);
+    if (object_entry == shard.objects.end() || object_entry->second->is_sealed ||
+        object_entry->second->stream_size == -1) {
+      return Status::Invalid("Append() called on ", object_id.hex(),
+                             ", which is not an open stream created by this client");
+    }
+    const ObjectInUseEntry& entry = *object_entry->second;
+    if (size > entry.object.data_size - entry.stream_size) {
+      return Status::CapacityError("Appending ", size, " bytes to stream ",
+                                   object_id.hex(), " exceeds its capacity of ",
+                                   entry.object.data_size);
+    }
+    end = entry.base + entry.object.data_offset + entry.stream_size;
+    stream_size = entry.stream_size + size;
+  }
+  memcpy(end, data, size);
+  return Publish(object_id, stream_size);
+}
+
+Status PlasmaClient::Impl::Publish(const ObjectID& object_id, int64_t stream_size) {
+  StoreConnection* conn;
+  {
+    ObjectsInUseShard& shard = GetShard(object_id);
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    auto object_entry = shard.objects.find(object_id);
+    if (object_entry == shard.objects.end() || object_entry->second->is_sealed ||
+        object_entry->second->stream_size == -1) {
+      return Status::Invalid("Publish() called on ", object_id.hex(),
+                             ", which is not an open stream created by this client");
+    }
+    ObjectInUseEntry* entry = object_entry->second.get();
+    if (stream_size < entry->stream_size || stream_size > entry->object.data_size) {
+      return Status::Invalid("Cannot publish ", stream_size, " bytes of stream ",
+                             object_id.hex(), ", which has ", entry->stream_size,
+                             " bytes published and a capacity of ",
+                             entry->object.data_size);
+    }
+    entry->stream_size = stream_size;
+    // The store only takes publications from the connection the stream was
+    // created on.
+    conn = entry->conn;
+  }
+  std::lock_guard<std::mutex> guard(conn->mutex);
+  return SendPublishRequest(conn->fd, object_id, stream_size);
+}
+
+Status PlasmaClient::Impl::WaitStream(const ObjectID& object_id, int64_t stream_size,
+                                      int64_t timeout_ms, int64_t* published,
+                                      bool* closed) {
+  std::unique_lock<std::mutex> lock;
+  StoreConnection* conn = AcquireConnection(&lock);
+  RETURN_NOT_OK(SendWaitStreamRequest(conn->fd, object_id, stream_size, timeout_ms));
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(PlasmaReceive(conn->fd, MessageType::PlasmaWaitStreamReply, &buffer));
+  ObjectID id;
+  RETURN_NOT_OK(ReadWaitStreamReply(buffer.data(), buffer.size(), &id, published, closed));
+  DCHECK(id == object_id);
+  return Status::OK();
+}
+
+arrow::Future<> PlasmaClient::Impl::SealAsync(const ObjectID& object_id) {
+  // The digest is computed on the calling thread.
+  std::string digest;
+  Status s = PrepareSeal(object_id, &digest);
+  PipelinedConnection* conn;
+  if (s.ok()) {
+    s = GetPipelinedConnection(&conn);
+  }
+  if (!s.ok()) {
+    return arrow::Future<>::MakeFinished(s);
+  }
+  auto future = arrow::Future<>::Make();
+  auto self = shared_from_this();
+  SendPipelinedRequest(
+      conn,
+      [&](int fd, uint64_t request_id) {
+        return SendSealRequest(fd, object_id, digest, request_id);
+      },
+      [self, future, object_id](const Status& status, const uint8_t* data,
+                                size_t size) mutable {
+        ObjectID sealed_id;
+        Status s = status;
+        if (s.ok()) {
+          s = ReadSealReply(data, size, &sealed_id);
+        }
+        if (s.ok()) {
+          ARROW_CHECK(sealed_id == object_id);
+          // Drop the reference that Create took for the seal, see Seal.
+          s = self->Release(object_id);
+        }
+        future.MarkFinished(s);
+      });
+  return future;
+}
+
 Status PlasmaClient::Impl::Abort(const ObjectID& object_id) {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
-  auto object_entry = objects_in_use_.find(object_id);
-  ARROW_CHECK(object_entry != objects_in_use_.end())
+  ObjectsInUseShard& shard = GetShard(object_id);
+  StoreConnection* conn;
+  {
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    auto object_entry = shard.objects.find(object_id);
+    ARROW_CHECK(object_entry != shard.objects.end())
+        << "Plasma client called abort on an object without a reference to it";
+    conn = object_entry->second->conn;
+  }
+  // Connections are locked before shards.
+  std::lock_guard<std::mutex> conn_guard(conn->mutex);
+  std::unique_lock<std::mutex> shard_lock(shard.mutex);
+  auto object_entry = shard.objects.find(object_id);
+  ARROW_CHECK(object_entry != shard.objects.end())
       << "Plasma client called abort on an object without a reference to it";
   ARROW_CHECK(!object_entry->second->is_sealed)
       << "Plasma client called abort on a sealed object";
@@ -915,34 +2138,50 @@ Status PlasmaClient::Impl::Abort(const ObjectID& object_id) {
 #endif
 
   // Send the abort request.
-  RETURN_NOT_OK(SendAbortRequest(store_conn_, object_id));
+  RETURN_NOT_OK(SendAbortRequest(conn->fd, object_id));
   // Decrease the reference count to zero, then remove the object.
   object_entry->second->count--;
-  RETURN_NOT_OK(MarkObjectUnused(object_id));
+  RETURN_NOT_OK(MarkObjectUnused(&shard, object_id));
+  shard_lock.unlock();
 
+  if (conn->pipelined) {
+    // The reader thread of the connection drops the reply.
+    return Status::OK();
+  }
   std::vector<uint8_t> buffer;
   ObjectID id;
   MessageType type;
-  RETURN_NOT_OK(ReadMessage(store_conn_, &type, &buffer));
+  RETURN_NOT_OK(ReadMessage(conn->fd, &type, &buffer));
   return ReadAbortReply(buffer.data(), buffer.size(), &id);
 }
 
 Status PlasmaClient::Impl::Delete(const std::vector<ObjectID>& object_ids) {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
-
   std::vector<ObjectID> not_in_use_ids;
   for (auto& object_id : object_ids) {
     // If the object is in used, skip it.
-    if (objects_in_use_.count(object_id) == 0) {
+    ObjectsInUseShard& shard = GetShard(object_id);
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    auto object_entry = shard.objects.find(object_id);
+    if (object_entry != shard.objects.end() && object_entry->second->count == 0 &&
+        object_entry->second->lease != kNoLease) {
+      // The object is only kept under an idle lease, which the store takes
+      // back when it deletes the object.
+      shard.objects.erase(object_entry);
+      object_entry = shard.objects.end();
+    }
+    if (object_entry == shard.objects.end()) {
       not_in_use_ids.push_back(object_id);
     } else {
+      std::lock_guard<std::mutex> deletion_guard(deletion_mutex_);
       deletion_cache_.emplace(object_id);
     }
   }
   if (not_in_use_ids.size() > 0) {
-    RETURN_NOT_OK(SendDeleteRequest(store_conn_, not_in_use_ids));
+    std::unique_lock<std::mutex> lock;
+    StoreConnection* conn = AcquireConnection(&lock);
+    RETURN_NOT_OK(SendDeleteRequest(conn->fd, not_in_use_ids));
     std::vector<uint8_t> buffer;
-    RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaDeleteReply, &buffer));
+    RETURN_NOT_OK(PlasmaReceive(conn->fd, MessageType::PlasmaDeleteReply, &buffer));
     DCHECK_GT(buffer.size(), 0);
     std::vector<PlasmaError> error_codes;
     not_in_use_ids.clear();
@@ -953,30 +2192,45 @@ Status PlasmaClient::Impl::Delete(const std::vector<ObjectID>& object_ids) {
 }
 
 Status PlasmaClient::Impl::Evict(int64_t num_bytes, int64_t& num_bytes_evicted) {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+  std::unique_lock<std::mutex> lock;
+  StoreConnection* conn = AcquireConnection(&lock);
 
   // Send a request to the store to evict objects.
-  RETURN_NOT_OK(SendEvictRequest(store_conn_, num_bytes));
+  RETURN_NOT_OK(SendEvictRequest(conn->fd, num_bytes));
   // Wait for a response with the number of bytes actually evicted.
   std::vector<uint8_t> buffer;
   MessageType type;
-  RETURN_NOT_OK(ReadMessage(store_conn_, &type, &buffer));
+  RETURN_NOT_OK(ReadMessage(conn->fd, &type, &buffer));
   return ReadEvictReply(buffer.data(), buffer.size(), num_bytes_evicted);
 }
 
+Status PlasmaClient::Impl::GrowRegion(int64_t memory_capacity) {
+  std::unique_lock<std::mutex> lock;
+  StoreConnection* conn = AcquireConnection(&lock);
+
+  RETURN_NOT_OK(SendGrowRegionRequest(conn->fd, memory_capacity));
+  std::vector<uint8_t> buffer;
+  MessageType type;
+  RETURN_NOT_OK(ReadMessage(conn->fd, &type, &buffer));
+  int64_t new_capacity;
+  Status status = ReadGrowRegionReply(buffer.data(), buffer.size(), &new_capacity);
+  // The reply has the size of the region even if it could not grow.
+  store_capacity_.store(new_capacity);
+  return status;
+}
+
 Status PlasmaClient::Impl::Refresh(const std::vector<ObjectID>& object_ids) {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+  std::unique_lock<std::mutex> lock;
+  StoreConnection* conn = AcquireConnection(&lock);
 
-  RETURN_NOT_OK(SendRefreshLRURequest(store_conn_, object_ids));
+  RETURN_NOT_OK(SendRefreshLRURequest(conn->fd, object_ids));
   std::vector<uint8_t> buffer;
   MessageType type;
-  RETURN_NOT_OK(ReadMessage(store_conn_, &type, &buffer));
+  RETURN_NOT_OK(ReadMessage(conn->fd, &type, &buffer));
   return ReadRefreshLRUReply(buffer.data(), buffer.size());
 }
 
 Status PlasmaClient::Impl::Hash(const ObjectID& object_id, uint8_t* digest) {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
-
   // Get the plasma object data. We pass in a timeout of 0 to indicate that
   // the operation should timeout immediately.
   std::vector<ObjectBuffer> object_buffers;
@@ -991,8 +2245,51 @@ Status PlasmaClient::Impl::Hash(const ObjectID& object_id, uint8_t* digest) {
   return Status::OK();
 }
 
-Status PlasmaClient::Impl::Subscribe(int* fd) {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+Status PlasmaClient::Impl::Subscribe(int* fd, int64_t ring_capacity) {
+  StoreConnection* conn = store_conns_[0].get();
+  std::lock_guard<std::mutex> guard(conn->mutex);
+
+  if (ring_capacity > 0) {
+    // The ring is sealed against shrinking, which the store checks before it
+    // maps it.
+    int ring_fd = memfd_create("plasma-notifications", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (ring_fd < 0) {
+      return Status::IOError("memfd_create failed: ", strerror(errno));
+    }
+    const int64_t size = NotificationRing::RequiredSize(ring_capacity);
+    void* pointer = MAP_FAILED;
+    if (ftruncate(ring_fd, size) == 0 &&
+        fcntl(ring_fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW) == 0) {
+      pointer = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, ring_fd, 0);
+    }
+    if (pointer == MAP_FAILED) {
+      Status status = Status::IOError("failed to map a notification ring: ",
+                                      strerror(errno));
+      close(ring_fd);
+      return status;
+    }
+    auto ring = NotificationRing::Create(static_cast<uint8_t*>(pointer), ring_capacity);
+    int wakeup_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    ARROW_CHECK(wakeup_fd >= 0) << "eventfd failed: " << strerror(errno);
+    Status status = SendSubscribeRequest(conn->fd, true);
+    if (status.ok()) {
+      ARROW_CHECK(send_fd(conn->fd, ring_fd) >= 0);
+      ARROW_CHECK(send_fd(conn->fd, wakeup_fd) >= 0);
+    }
+    close(ring_fd);
+    if (!status.ok()) {
+      close(wakeup_fd);
+      munmap(pointer, size);
+      return status;
+    }
+    std::lock_guard<std::mutex> notification_guard(notification_mutex_);
+    NotificationRingMapping& mapping = notification_rings_[wakeup_fd];
+    mapping.ring = std::move(ring);
+    mapping.pointer = static_cast<uint8_t*>(pointer);
+    mapping.size = size;
+    *fd = wakeup_fd;
+    return Status::OK();
+  }
 
   int sock[2];
   // Create a non-blocking socket pair. This will only be used to send
@@ -1002,10 +2299,10 @@ Status PlasmaClient::Impl::Subscribe(int* fd) {
   int flags = fcntl(sock[1], F_GETFL, 0);
   ARROW_CHECK(fcntl(sock[1], F_SETFL, flags | O_NONBLOCK) == 0);
   // Tell the Plasma store about the subscription.
-  RETURN_NOT_OK(SendSubscribeRequest(store_conn_));
+  RETURN_NOT_OK(SendSubscribeRequest(conn->fd));
   // Send the file descriptor that the Plasma store should use to push
   // notifications about sealed objects to this client.
-  ARROW_CHECK(send_fd(store_conn_, sock[1]) >= 0);
+  ARROW_CHECK(send_fd(conn->fd, sock[1]) >= 0);
   close(sock[1]);
   // Return the file descriptor that the client should use to read notifications
   // about sealed objects.
@@ -1015,7 +2312,13 @@ Status PlasmaClient::Impl::Subscribe(int* fd) {
 
 Status PlasmaClient::Impl::GetNotification(int fd, ObjectID* object_id,
                                            int64_t* data_size, int64_t* metadata_size) {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+  std::unique_lock<std::mutex> lock(notification_mutex_);
+
+  auto ring = notification_rings_.find(fd);
+  if (ring != notification_rings_.end()) {
+    return GetRingNotification(&lock, fd, ring->second.ring.get(), object_id, data_size,
+                               metadata_size);
+  }
 
   if (pending_notification_.empty()) {
     auto message = ReadMessageAsync(fd);
@@ -1043,11 +2346,51 @@ Status PlasmaClient::Impl::GetNotification(int fd, ObjectID* object_id,
   return Status::OK();
 }
 
+namespace {
+
+/// Reset the eventfd of a notification ring, and set it again if the ring
+/// still holds notifications, so that the eventfd is readable whenever there
+/// are notifications to read, also for callers that poll it.
+void ResetRingWakeup(int fd, const NotificationRing& ring) {
+  uint64_t count;
+  ARROW_UNUSED(read(fd, &count, sizeof(count)));
+  if (!ring.Empty()) {
+    count = 1;
+    ARROW_UNUSED(write(fd, &count, sizeof(count)));
+  }
+}
+
+}  // namespace
+
+Status PlasmaClient::Impl::GetRingNotification(std::unique_lock<std::mutex>* lock,
+                                               int fd, NotificationRing* ring,
+                                               ObjectID* object_id, int64_t* data_size,
+                                               int64_t* metadata_size) {
+  while (!ring->Pop(object_id, data_size, metadata_size)) {
+    // The store only writes the eventfd when it publishes into a ring that was
+    // read up to the end. Other subscriptions are read while this one waits;
+    // the ring stays mapped until the client is destroyed.
+    lock->unlock();
+    struct pollfd pfd = {fd, POLLIN, 0};
+    const int result = poll(&pfd, 1, -1);
+    const int poll_errno = errno;
+    lock->lock();
+    if (result < 0 && poll_errno != EINTR) {
+      return Status::IOError("Failed to wait for object notifications: ",
+                             strerror(poll_errno));
+    }
+    ResetRingWakeup(fd, *ring);
+  }
+  if (ring->Empty()) {
+    ResetRingWakeup(fd, *ring);
+  }
+  return Status::OK();
+}
+
 Status PlasmaClient::Impl::DecodeNotifications(const uint8_t* buffer,
                                                std::vector<ObjectID>* object_ids,
                                                std::vector<int64_t>* data_sizes,
                                                std::vector<int64_t>* metadata_sizes) {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
   auto object_info = flatbuffers::GetRoot<fb::PlasmaNotification>(buffer);
 
   for (size_t i = 0; i < object_info->object_info()->size(); ++i) {
@@ -1068,55 +2411,89 @@ Status PlasmaClient::Impl::DecodeNotifications(const uint8_t* buffer,
 
 Status PlasmaClient::Impl::Connect(const std::string& store_socket_name,
                                    const std::string& manager_socket_name,
-                                   int release_delay, int num_retries) {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
-
-  RETURN_NOT_OK(ConnectIpcSocketRetry(store_socket_name, num_retries, -1, &store_conn_));
+                                   int release_delay, int num_retries,
+                                   int num_connections) {
   if (manager_socket_name != "") {
     return Status::NotImplemented("plasma manager is no longer supported");
   }
+  if (num_connections < 1) {
+    return Status::Invalid("PlasmaClient needs at least one connection to the store");
+  }
   if (release_delay != 0) {
     ARROW_LOG(WARNING) << "The release_delay parameter in PlasmaClient::Connect "
                        << "is deprecated";
   }
-  // Send a ConnectRequest to the store to get its memory capacity.
-  RETURN_NOT_OK(SendConnectRequest(store_conn_));
-  std::vector<uint8_t> buffer;
-  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaConnectReply, &buffer));
-  RETURN_NOT_OK(ReadConnectReply(buffer.data(), buffer.size(), &store_capacity_));
+  store_socket_name_ = store_socket_name;
+  num_retries_ = num_retries;
+  for (int i = 0; i < num_connections; ++i) {
+    std::unique_ptr<StoreConnection> conn(new StoreConnection());
+    RETURN_NOT_OK(
+        ConnectIpcSocketRetry(store_socket_name, num_retries, -1, &conn->fd));
+    store_conns_.push_back(std::move(conn));
+  }
+  // Send a ConnectRequest to the store to get its memory capacity. Every
+  // connection sends one, since the store places the objects created through
+  // it near the NUMA node of the client.
+  const int numa_node = CurrentNumaNode();
+  for (const auto& conn : store_conns_) {
+    RETURN_NOT_OK(SendConnectRequest(conn->fd, numa_node, remote_base_ != nullptr));
+    std::vector<uint8_t> buffer;
+    RETURN_NOT_OK(PlasmaReceive(conn->fd, MessageType::PlasmaConnectReply, &buffer));
+    int64_t store_capacity;
+    RETURN_NOT_OK(ReadConnectReply(buffer.data(), buffer.size(), &store_capacity));
+    store_capacity_.store(store_capacity);
+  }
+  connected_ = true;
   return Status::OK();
 }
 
 Status PlasmaClient::Impl::SetClientOptions(const std::string& client_name,
-                                            int64_t output_memory_quota) {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
-  RETURN_NOT_OK(SendSetOptionsRequest(store_conn_, client_name, output_memory_quota));
-  std::vector<uint8_t> buffer;
-  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaSetOptionsReply, &buffer));
-  return ReadSetOptionsReply(buffer.data(), buffer.size());
+                                            int64_t output_memory_quota, int weight) {
+  const bool sets_quota = output_memory_quota != 0 || weight == 0;
+  // The quota covers the objects of the first connection, but every
+  // connection is scheduled on its own and gets the weight.
+  const size_t num_conns = weight == 0 ? 1 : store_conns_.size();
+  for (size_t i = 0; i < num_conns; i++) {
+    StoreConnection* conn = store_conns_[i].get();
+    std::lock_guard<std::mutex> guard(conn->mutex);
+    RETURN_NOT_OK(SendSetOptionsRequest(
+        conn->fd, client_name, i == 0 ? output_memory_quota : 0, weight));
+    std::vector<uint8_t> buffer;
+    RETURN_NOT_OK(PlasmaReceive(conn->fd, MessageType::PlasmaSetOptionsReply, &buffer));
+    RETURN_NOT_OK(ReadSetOptionsReply(buffer.data(), buffer.size()));
+  }
+  if (sets_quota) {
+    has_quota_ = true;
+  }
+  return Status::OK();
 }
 
 Status PlasmaClient::Impl::Disconnect() {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
-
   // NOTE: We purposefully do not finish sending release calls for objects in
   // use, so that we don't duplicate PlasmaClient::Release calls (when handling
   // a SIGTERM, for example).
+  connected_ = false;
+  StopPrefetcher();
+  StopPipeline();
 
   // Close the connections to Plasma. The Plasma store will release the objects
   // that were in use by us when handling the SIGPIPE.
-  close(store_conn_);
-  store_conn_ = -1;
+  for (auto& conn : store_conns_) {
+    std::lock_guard<std::mutex> guard(conn->mutex);
+    close(conn->fd);
+    conn->fd = -1;
+  }
   return Status::OK();
 }
 
 std::string PlasmaClient::Impl::DebugString() {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
-  if (!SendGetDebugStringRequest(store_conn_).ok()) {
+  std::unique_lock<std::mutex> lock;
+  StoreConnection* conn = AcquireConnection(&lock);
+  if (!SendGetDebugStringRequest(conn->fd).ok()) {
     return "error sending request";
   }
   std::vector<uint8_t> buffer;
-  if (!PlasmaReceive(store_conn_, MessageType::PlasmaGetDebugStringReply, &buffer).ok()) {
+  if (!PlasmaReceive(conn->fd, MessageType::PlasmaGetDebugStringReply, &buffer).ok()) {
     return "error receiving reply";
   }
   std::string debug_string;
@@ -1135,14 +2512,14 @@ PlasmaClient::~PlasmaClient() {}
 
 Status PlasmaClient::Connect(const std::string& store_socket_name,
                              const std::string& manager_socket_name, int release_delay,
-                             int num_retries) {
+                             int num_retries, int num_connections) {
   return impl_->Connect(store_socket_name, manager_socket_name, release_delay,
-                        num_retries);
+                        num_retries, num_connections);
 }
 
 Status PlasmaClient::SetClientOptions(const std::string& client_name,
-                                      int64_t output_memory_quota) {
-  return impl_->SetClientOptions(client_name, output_memory_quota);
+                                      int64_t output_memory_quota, int weight) {
+  return impl_->SetClientOptions(client_name, output_memory_quota, weight);
 }
 
 Status PlasmaClient::Create(const ObjectID& object_id, int64_t data_size,
@@ -1165,6 +2542,11 @@ Status PlasmaClient::CreateAndSealBatch(const std::vector<ObjectID>& object_ids,
   return impl_->CreateAndSealBatch(object_ids, data, metadata, evict_if_full);
 }
 
+Status PlasmaClient::CreateView(const ObjectID& parent_id, int64_t offset,
+                                int64_t length, const ObjectID& object_id) {
+  return impl_->CreateView(parent_id, offset, length, object_id);
+}
+
 Status PlasmaClient::Get(const std::vector<ObjectID>& object_ids, int64_t timeout_ms,
                          std::vector<ObjectBuffer>* object_buffers) {
   return impl_->Get(object_ids, timeout_ms, object_buffers);
@@ -1175,6 +2557,31 @@ Status PlasmaClient::Get(const ObjectID* object_ids, int64_t num_objects,
   return impl_->Get(object_ids, num_objects, timeout_ms, object_buffers);
 }
 
+arrow::Future<std::shared_ptr<Buffer>> PlasmaClient::CreateAsync(
+    const ObjectID& object_id, int64_t data_size, const uint8_t* metadata,
+    int64_t metadata_size, bool evict_if_full) {
+  return impl_->CreateAsync(object_id, data_size, metadata, metadata_size,
+                            evict_if_full);
+}
+
+arrow::Future<std::vector<ObjectBuffer>> PlasmaClient::GetAsync(
+    const std::vector<ObjectID>& object_ids, int64_t timeout_ms) {
+  return impl_->GetAsync(object_ids, timeout_ms);
+}
+
+arrow::Future<> PlasmaClient::SealAsync(const ObjectID& object_id) {
+  return impl_->SealAsync(object_id);
+}
+
+Status PlasmaClient::Wait(const std::vector<ObjectID>& object_ids, int64_t num_ready,
+                          int64_t timeout_ms, std::vector<ObjectID>* ready_ids) {
+  return impl_->Wait(object_ids, num_ready, timeout_ms, ready_ids);
+}
+
+Status PlasmaClient::Prefetch(const std::vector<ObjectID>& object_ids) {
+  return impl_->Prefetch(object_ids);
+}
+
 Status PlasmaClient::Release(const ObjectID& object_id) {
   return impl_->Release(object_id);
 }
@@ -1185,10 +2592,36 @@ Status PlasmaClient::Contains(const ObjectID& object_id, bool* has_object) {
 
 Status PlasmaClient::List(ObjectTable* objects) { return impl_->List(objects); }
 
+Status PlasmaClient::List(const ObjectListFilter& filter, int64_t page_size,
+                          uint64_t* cursor, ObjectTable* objects, bool* restarted) {
+  return impl_->List(filter, page_size, cursor, objects, restarted);
+}
+
 Status PlasmaClient::Abort(const ObjectID& object_id) { return impl_->Abort(object_id); }
 
 Status PlasmaClient::Seal(const ObjectID& object_id) { return impl_->Seal(object_id); }
 
+Status PlasmaClient::CreateStream(const ObjectID& object_id, int64_t capacity,
+                                  const uint8_t* metadata, int64_t metadata_size,
+                                  std::shared_ptr<Buffer>* data, bool evict_if_full) {
+  return impl_->CreateStream(object_id, capacity, metadata, metadata_size, data,
+                             evict_if_full);
+}
+
+Status PlasmaClient::Append(const ObjectID& object_id, const uint8_t* data,
+                            int64_t size) {
+  return impl_->Append(object_id, data, size);
+}
+
+Status PlasmaClient::Publish(const ObjectID& object_id, int64_t stream_size) {
+  return impl_->Publish(object_id, stream_size);
+}
+
+Status PlasmaClient::WaitStream(const ObjectID& object_id, int64_t stream_size,
+                                int64_t timeout_ms, int64_t* published, bool* closed) {
+  return impl_->WaitStream(object_id, stream_size, timeout_ms, published, closed);
+}
+
 Status PlasmaClient::Delete(const ObjectID& object_id) {
   return impl_->Delete(std::vector<ObjectID>{object_id});
 }
@@ -1201,6 +2634,10 @@ Status PlasmaClient::Evict(int64_t num_bytes, int64_t& num_bytes_evicted) {
   return impl_->Evict(num_bytes, num_bytes_evicted);
 }
 
+Status PlasmaClient::GrowRegion(int64_t memory_capacity) {
+  return impl_->GrowRegion(memory_capacity);
+}
+
 Status PlasmaClient::Refresh(const std::vector<ObjectID>& object_ids) {
   return impl_->Refresh(object_ids);
 }
@@ -1209,7 +2646,9 @@ Status PlasmaClient::Hash(const ObjectID& object_id, uint8_t* digest) {
   return impl_->Hash(object_id, digest);
 }
 
-Status PlasmaClient::Subscribe(int* fd) { return impl_->Subscribe(fd); }
+Status PlasmaClient::Subscribe(int* fd, int64_t ring_capacity) {
+  return impl_->Subscribe(fd, ring_capacity);
+}
 
 Status PlasmaClient::GetNotification(int fd, ObjectID* object_id, int64_t* data_size,
                                      int64_t* metadata_size) {
@@ -24,6 +24,7 @@
 
 #include "arrow/buffer.h"
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 #include "plasma/common.h"
@@ -59,17 +60,26 @@ class ARROW_EXPORT PlasmaClient {
   ///        will return failure if this is not "".
   /// \param release_delay Deprecated (not used).
   /// \param num_retries number of attempts to connect to IPC socket, default 50
+  /// \param num_connections Number of connections to open to the store. Threads
+  ///        sharing this client use different connections for their requests
+  ///        when there are several, instead of waiting for each other. If the
+  ///        client sets a memory quota, objects are always created on the first
+  ///        connection, since the store accounts quotas per connection.
   /// \return The return status.
   Status Connect(const std::string& store_socket_name,
                  const std::string& manager_socket_name = "", int release_delay = 0,
-                 int num_retries = -1);
+                 int num_retries = -1, int num_connections = 1);
 
   /// Set runtime options for this client.
   ///
   /// \param client_name The name of the client, used in debug messages.
   /// \param output_memory_quota The memory quota in bytes for objects created by
-  ///        this client.
-  Status SetClientOptions(const std::string& client_name, int64_t output_memory_quota);
+  ///        this client. With a weight, 0 sets no quota.
+  /// \param weight The share of the store this client gets relative to other
+  ///        clients, when the store schedules requests (see the -q switch of
+  ///        the store). 0 keeps the current weight, 1 by default.
+  Status SetClientOptions(const std::string& client_name, int64_t output_memory_quota,
+                          int weight = 0);
 
   /// Create an object in the Plasma Store. Any metadata for this object must be
   /// be passed in when the object is created.
@@ -126,6 +136,18 @@ class ARROW_EXPORT PlasmaClient {
                             const std::vector<std::string>& metadata,
                             bool evict_if_full = true);
 
+  /// Create a sealed object whose data is a range of the data of another
+  /// sealed object, without copying it. The view has no metadata. The parent
+  /// stays in the store until the view is deleted or evicted.
+  ///
+  /// \param parent_id The ID of the sealed object in the local store.
+  /// \param offset Where the view starts in the data of the parent.
+  /// \param length The number of bytes in the view.
+  /// \param object_id The ID of the view.
+  /// \return The return status.
+  Status CreateView(const ObjectID& parent_id, int64_t offset, int64_t length,
+                    const ObjectID& object_id);
+
   /// Get some objects from the Plasma Store. This function will block until the
   /// objects have all been created and sealed in the Plasma Store or the
   /// timeout expires.
@@ -158,6 +180,73 @@ class ARROW_EXPORT PlasmaClient {
   Status Get(const ObjectID* object_ids, int64_t num_objects, int64_t timeout_ms,
              ObjectBuffer* object_buffers);
 
+  /// Asynchronous variant of Create() for objects on the host.
+  ///
+  /// The asynchronous calls are pipelined on a connection of their own: they
+  /// return as soon as the request is sent, several of them can be outstanding
+  /// at once, and they complete in whatever order the store replies, on a
+  /// background thread that reads the replies. The metadata is copied before
+  /// the call returns. Clients with a memory quota cannot use this call.
+  ///
+  /// \param object_id The ID to use for the newly created object.
+  /// \param data_size The size in bytes of the object's data.
+  /// \param metadata The object's metadata, or NULL if there is none.
+  /// \param metadata_size The size in bytes of the metadata.
+  /// \param evict_if_full Whether to evict other objects to make space for
+  ///        this object.
+  /// \return A future of the object's buffer, see Create().
+  arrow::Future<std::shared_ptr<Buffer>> CreateAsync(const ObjectID& object_id,
+                                                     int64_t data_size,
+                                                     const uint8_t* metadata,
+                                                     int64_t metadata_size,
+                                                     bool evict_if_full = true);
+
+  /// Asynchronous variant of Get(), see CreateAsync() for how asynchronous calls
+  /// are carried out. Objects this client already holds are returned right away
+  /// in a finished future. Objects are released when their buffers go out of
+  /// scope.
+  ///
+  /// \param object_ids The IDs of the objects to get.
+  /// \param timeout_ms The amount of time in milliseconds the store waits for
+  ///        the objects. If this value is -1, then no timeout is set.
+  /// \return A future of the object results, see Get().
+  arrow::Future<std::vector<ObjectBuffer>> GetAsync(const std::vector<ObjectID>& object_ids,
+                                                    int64_t timeout_ms);
+
+  /// Asynchronous variant of Seal(), see CreateAsync() for how asynchronous
+  /// calls are carried out. The object's digest is computed before the call
+  /// returns.
+  ///
+  /// \param object_id The ID of the object to seal.
+  /// \return A future that finishes when the object is sealed.
+  arrow::Future<> SealAsync(const ObjectID& object_id);
+
+  /// Wait until some of a list of objects are sealed, in the local store or in
+  /// the remote one. Unlike Get(), this does not wait for all of the objects,
+  /// and it does not map or reference the objects that are ready.
+  ///
+  /// \param object_ids The IDs of the objects to wait for.
+  /// \param num_ready The number of objects to wait for. It must be between 1
+  ///        and the number of different IDs in object_ids.
+  /// \param timeout_ms The amount of time in milliseconds to wait. If this
+  ///        value is -1, then no timeout is set.
+  /// \param[out] ready_ids The IDs of the objects that are ready, in the order
+  ///        of object_ids. There are fewer than num_ready of them if the wait
+  ///        timed out, and there can be more.
+  /// \return The return status.
+  Status Wait(const std::vector<ObjectID>& object_ids, int64_t num_ready,
+              int64_t timeout_ms, std::vector<ObjectID>* ready_ids);
+
+  /// Start bringing the pages of objects in the remote region into memory, so
+  /// that reading them after a later Get() does not stall on every page. This
+  /// returns right away; a background thread looks the objects up in the
+  /// directory of the remote region and populates their pages. Objects that
+  /// are not in the remote region are left alone.
+  ///
+  /// \param object_ids The IDs of the objects that will be read soon.
+  /// \return The return status.
+  Status Prefetch(const std::vector<ObjectID>& object_ids);
+
   /// Tell Plasma that the client no longer needs the object. This should be
   /// called after Get() or Create() when the client is done with the object.
   /// After this call, the buffer returned by Get() is no longer valid.
@@ -178,7 +267,8 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Contains(const ObjectID& object_id, bool* has_object);
 
-  /// List all the objects in the object store.
+  /// List all the objects in the object store. The store sends them in pages,
+  /// so that a large store is not blocked while it lists them.
   ///
   /// This API is experimental and might change in the future.
   ///
@@ -193,6 +283,26 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status List(ObjectTable* objects);
 
+  /// List one page of the objects that match a filter. The store looks at a
+  /// bounded part of its table for each page, so a page may have fewer
+  /// objects than page_size, or none, before the listing is complete.
+  ///
+  /// This API is experimental and might change in the future.
+  ///
+  /// \param filter Which objects to list.
+  /// \param page_size The most objects in the page, or 0 for all of them.
+  /// \param[in,out] cursor 0 to start a listing. Set to where the next page
+  ///                 starts, or to 0 once the listing is complete.
+  /// \param[out] objects The objects of the page are added to it, with the
+  ///             fields the List above fills. Objects in the region of the
+  ///             remote store have an fd of -1.
+  /// \param[out] restarted Set to whether the listing started over because
+  ///             the table of the store was rehashed, so that objects of
+  ///             earlier pages may come again. May be null.
+  /// \return The return status.
+  Status List(const ObjectListFilter& filter, int64_t page_size, uint64_t* cursor,
+              ObjectTable* objects, bool* restarted = nullptr);
+
   /// Abort an unsealed object in the object store. If the abort succeeds, then
   /// it will be as if the object was never created at all. The unsealed object
   /// must have only a single reference (the one that would have been removed by
@@ -210,6 +320,65 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Seal(const ObjectID& object_id);
 
+  /// Create a stream object in the Plasma Store. A stream is written by
+  /// appending to it, and other clients can Get() it and read what has been
+  /// published before it is sealed. Until then, the data buffer Get() returns
+  /// spans the capacity of the stream, and readers learn how much of it they
+  /// may read from WaitStream(). Once sealed, the stream reads like an object
+  /// of the size that was published. Streams are not visible to the remote
+  /// store before they are sealed.
+  ///
+  /// Like an object from Create(), the stream must be released and either
+  /// sealed or aborted. If the writer disconnects or aborts the stream while
+  /// readers hold it, the stream is sealed where the writer left off instead.
+  ///
+  /// \param object_id The ID to use for the newly created stream.
+  /// \param capacity The number of data bytes to reserve for the stream.
+  /// \param metadata The stream's metadata, or NULL if there is none.
+  /// \param metadata_size The size in bytes of the metadata.
+  /// \param data The whole capacity of the stream will be written here.
+  /// \param evict_if_full Whether to evict other objects to make space for
+  ///        this stream.
+  /// \return The return status.
+  Status CreateStream(const ObjectID& object_id, int64_t capacity,
+                      const uint8_t* metadata, int64_t metadata_size,
+                      std::shared_ptr<Buffer>* data, bool evict_if_full = true);
+
+  /// Copy data to the end of a stream this client created and publish it.
+  /// Appends to a stream must not run concurrently.
+  ///
+  /// \param object_id The ID of the stream.
+  /// \param data The data to append.
+  /// \param size The size of the data in bytes.
+  /// \return The return status. Appending more than the capacity of the stream
+  ///         fails without writing anything.
+  Status Append(const ObjectID& object_id, const uint8_t* data, int64_t size);
+
+  /// Let readers read the first stream_size bytes of a stream this client
+  /// created, for writers that fill the buffer returned by CreateStream()
+  /// themselves.
+  ///
+  /// \param object_id The ID of the stream.
+  /// \param stream_size The number of data bytes that are ready. This cannot
+  ///        be less than what was published before.
+  /// \return The return status.
+  Status Publish(const ObjectID& object_id, int64_t stream_size);
+
+  /// Wait until more than stream_size bytes of a stream are published or until
+  /// it is sealed. Waiting for an object that is not a stream returns when it
+  /// is sealed, with its size.
+  ///
+  /// \param object_id The ID of the stream.
+  /// \param stream_size The number of bytes the caller has read already.
+  /// \param timeout_ms The amount of time in milliseconds to wait. If this
+  ///        value is -1, then no timeout is set.
+  /// \param[out] published The number of bytes published so far.
+  /// \param[out] closed Whether the stream is sealed, so that it will not grow
+  ///        anymore.
+  /// \return The return status. The stream must exist in the local store.
+  Status WaitStream(const ObjectID& object_id, int64_t stream_size, int64_t timeout_ms,
+                    int64_t* published, bool* closed);
+
   /// Delete an object from the object store. This currently assumes that the
   /// object is present, has been sealed and not used by another client. Otherwise,
   /// it is a no operation.
@@ -238,6 +407,16 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Evict(int64_t num_bytes, int64_t& num_bytes_evicted);
 
+  /// Grow the memory of the store while it runs, up to the size it was
+  /// started to allow with -g. Clients map the region at that size already,
+  /// so objects in the new memory need no new mapping.
+  ///
+  /// \param memory_capacity The new size of the region in bytes. A size the
+  ///        region already has leaves it as it is.
+  /// \return The return status. It is an out of memory error if the region
+  ///         can not grow that far.
+  Status GrowRegion(int64_t memory_capacity);
+
   /// Bump objects up in the LRU cache, i.e. treat them as recently accessed.
   /// Objects that do not exist in the store will be ignored.
   ///
@@ -257,11 +436,19 @@ class ARROW_EXPORT PlasmaClient {
   /// Whenever an object is sealed, a message will be written to the client
   /// socket that is returned by this method.
   ///
+  /// With a ring capacity, the store writes the notifications into a ring of
+  /// that many entries in shared memory instead, and only writes to the
+  /// returned eventfd to wake the client up when the client had read all of
+  /// them. Read the notifications with GetNotification; the eventfd is
+  /// readable whenever there are some.
+  ///
   /// \param fd Out parameter for the file descriptor the client should use to
   /// read notifications
   ///         from the object store about sealed objects.
+  /// \param ring_capacity The number of notifications the ring holds, or 0 to
+  /// receive them on a socket.
   /// \return The return status.
-  Status Subscribe(int* fd);
+  Status Subscribe(int* fd, int64_t ring_capacity = 0);
 
   /// Receive next object notification for this client if Subscribe has been called.
   ///
@@ -283,6 +470,13 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Disconnect();
 
+  /// Map the shared memory region of the remote store. If the remote store
+  /// publishes a directory of its objects in the region, Get resolves sealed
+  /// remote objects through it without a round trip to either store. Call
+  /// this before the client is used from several threads.
+  ///
+  /// \param file The file backing the remote region.
+  /// \return The return status.
   Status MmapRemoteMemory(const std::string& file);
 
   /// Get the current debug string from the plasma store server.
@@ -300,7 +494,12 @@ class ARROW_EXPORT PlasmaClient {
   friend class PlasmaMutableBuffer;
   FRIEND_TEST(TestPlasmaStore, GetTest);
   FRIEND_TEST(TestPlasmaStore, LegacyGetTest);
+  FRIEND_TEST(TestPlasmaStore, LocalObjectIsNotReadFromRemoteRegion);
   FRIEND_TEST(TestPlasmaStore, AbortTest);
+  FRIEND_TEST(TestPlasmaStore, AsyncTest);
+  FRIEND_TEST(TestPlasmaStore, WaitTest);
+  FRIEND_TEST(TestPlasmaStore, MultiThreadedCreateGetReleaseTest);
+  FRIEND_TEST(TestPlasmaStore, ReleaseDuringPendingGetTest);
 
   bool IsInUse(const ObjectID& object_id);
 
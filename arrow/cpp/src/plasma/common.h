@@ -88,6 +88,9 @@ enum class ObjectState : int {
   PLASMA_SEALED = 2,
   /// Object is evicted to external store.
   PLASMA_EVICTED = 3,
+  /// Object is sealed and kept compressed in the local Plasma Store. A get
+  /// decompresses it back into a sealed object.
+  PLASMA_COMPRESSED = 4,
 };
 
 namespace internal {
@@ -117,8 +120,17 @@ struct ObjectTableEntry {
   int64_t data_size;
   /// Size of the object metadata in bytes.
   int64_t metadata_size;
+  /// For a stream object, the number of data bytes published to its readers so
+  /// far, and -1 for other objects. The data_size of a stream is its capacity.
+  int64_t stream_size;
+  /// For a compressed object, the size of the compressed bytes at pointer +
+  /// offset.
+  int64_t compressed_size;
   /// Number of clients currently using this object.
   int ref_count;
+  /// The store's index of the name of the client that created this object, or
+  /// -1 if it is not known.
+  int32_t owner;
   /// Unix epoch of when this object was created.
   int64_t create_time;
   /// How long creation of this object took.
@@ -140,6 +152,26 @@ struct ObjectTableEntry {
 /// Mapping from ObjectIDs to information about the object.
 typedef std::unordered_map<ObjectID, std::unique_ptr<ObjectTableEntry>> ObjectTable;
 
+/// Which objects a List with a cursor returns. The default returns all of them.
+struct ObjectListFilter {
+  /// Bits of 1 << ObjectState for the states to list, or 0 for any state.
+  int state_mask = 0;
+  /// Bounds of data_size + metadata_size in bytes. A max_size of -1 has no
+  /// upper bound.
+  int64_t min_size = 0;
+  int64_t max_size = -1;
+  /// Bounds of the number of seconds since the objects were created. A
+  /// max_age of -1 has no upper bound.
+  int64_t min_age = 0;
+  int64_t max_age = -1;
+  /// The name the creating client set with SetClientOptions, or empty for any.
+  std::string owner;
+  /// Whether to go on with the sealed objects in the region of the remote
+  /// store after the local ones, for clients that mapped it. Their age and
+  /// owner are not known, so they are left out when those are filtered on.
+  bool include_remote = false;
+};
+
 /// Globally accessible reference to plasma store configuration.
 /// TODO(pcm): This can be avoided with some refactoring of existing code
 /// by making it possible to pass a context object through dlmalloc.
@@ -52,6 +52,12 @@ void LRUCache::AdjustCapacity(int64_t delta) {
   ARROW_CHECK(used_capacity_ >= 0) << DebugString();
 }
 
+void LRUCache::Grow(int64_t delta) {
+  ARROW_CHECK(delta >= 0);
+  original_capacity_ += delta;
+  capacity_ += delta;
+}
+
 int64_t LRUCache::Capacity() const { return capacity_; }
 
 int64_t LRUCache::OriginalCapacity() const { return original_capacity_; }
@@ -165,8 +171,10 @@ void EvictionPolicy::RefreshObjects(const std::vector<ObjectID>& object_ids) {
   }
 }
 
+void EvictionPolicy::AddCapacity(int64_t delta) { cache_.Grow(delta); }
+
 int64_t EvictionPolicy::GetObjectSize(const ObjectID& object_id) const {
-  auto entry = store_info_->objects[object_id].get();
+  auto entry = GetObjectTableEntry(store_info_, object_id);
   return entry->data_size + entry->metadata_size;
 }
 
@@ -62,6 +62,10 @@ class LRUCache {
 
   void AdjustCapacity(int64_t delta);
 
+  /// Raise both the original and the current capacity, when the memory the
+  /// cache manages grows.
+  void Grow(int64_t delta);
+
   void Foreach(std::function<void(const ObjectID&)>);
 
   std::string DebugString() const;
@@ -78,7 +82,7 @@ class LRUCache {
   /// The name of this cache, used for debugging purposes only.
   const std::string name_;
   /// The original (max) capacity of this cache in bytes.
-  const int64_t original_capacity_;
+  int64_t original_capacity_;
   /// The current capacity, which must be <= the original capacity.
   int64_t capacity_;
   /// The number of bytes used of the available capacity.
@@ -190,6 +194,11 @@ class EvictionPolicy {
 
   virtual void RefreshObjects(const std::vector<ObjectID>& object_ids);
 
+  /// This method will be called when the memory of the store grows.
+  ///
+  /// \param delta The number of bytes the store gained.
+  void AddCapacity(int64_t delta);
+
   /// Returns debugging information for this eviction policy.
   virtual std::string DebugString() const;
 
@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/fair_queue.h"
+
+#include <algorithm>
+
+namespace plasma {
+
+FairQueue::FairQueue(int64_t quantum) : quantum_(quantum), num_waited_(0) {}
+
+void FairQueue::Push(int fd, int weight, int64_t cost) {
+  Flow& flow = flows_[fd];
+  flow.weight = weight;
+  flow.cost = cost;
+  flow.waited = false;
+  if (flow.in_turn) {
+    round_.push_front(fd);
+  } else {
+    round_.push_back(fd);
+  }
+}
+
+int FairQueue::Pop(const std::function<bool(int fd)>& skip) {
+  bool any_eligible = true;
+  while (any_eligible && !round_.empty()) {
+    any_eligible = false;
+    for (size_t i = 0, n = round_.size(); i < n; i++) {
+      int fd = round_.front();
+      round_.pop_front();
+      Flow& flow = flows_[fd];
+      if (skip(fd)) {
+        flow.in_turn = false;
+        round_.push_back(fd);
+        continue;
+      }
+      any_eligible = true;
+      if (!flow.in_turn) {
+        flow.in_turn = true;
+        flow.deficit += flow.weight * quantum_;
+      }
+      if (flow.deficit < flow.cost) {
+        // The client keeps what it has for its next turn.
+        flow.in_turn = false;
+        if (!flow.waited) {
+          flow.waited = true;
+          num_waited_ += 1;
+        }
+        round_.push_back(fd);
+        continue;
+      }
+      flow.deficit -= flow.cost;
+      return fd;
+    }
+  }
+  return -1;
+}
+
+void FairQueue::Done(int fd, bool more) {
+  if (more) {
+    return;
+  }
+  auto it = flows_.find(fd);
+  if (it != flows_.end()) {
+    it->second.deficit = 0;
+    it->second.in_turn = false;
+  }
+}
+
+void FairQueue::Remove(int fd) {
+  flows_.erase(fd);
+  round_.erase(std::remove(round_.begin(), round_.end(), fd), round_.end());
+}
+
+}  // namespace plasma
@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <unordered_map>
+
+#include "arrow/util/visibility.h"
+
+namespace plasma {
+
+/// Deficit round robin over the clients that have a request queued, named by
+/// their file descriptors.
+///
+/// When its turn comes, a client gets its weight times the quantum to spend,
+/// and is served as long as that pays for its next request. What it does not
+/// spend is kept for its next turn while it has requests waiting, and dropped
+/// once it has none, so that an idle client does not save up.
+///
+/// The queue holds one request of a client at a time. The others wait in the
+/// socket of the client, and the store tells Done whether there are any.
+class ARROW_EXPORT FairQueue {
+ public:
+  /// \param quantum The bytes a client of weight 1 may spend in each turn.
+  explicit FairQueue(int64_t quantum);
+
+  /// Queue the next request of a client. If the client is in its turn, it is
+  /// served next if it can pay.
+  ///
+  /// \param fd The client.
+  /// \param weight The share of the client relative to the others.
+  /// \param cost The bytes the request costs.
+  void Push(int fd, int weight, int64_t cost);
+
+  /// Take the client whose request is served next, in as many rounds as it
+  /// takes for one to pay for its request.
+  ///
+  /// \param skip Clients for which this returns true pass their turn without
+  ///        getting anything to spend.
+  /// \return The client, or -1 if every client is skipped.
+  int Pop(const std::function<bool(int fd)>& skip);
+
+  /// Tell the queue that the request of fd was served.
+  ///
+  /// \param more Whether the client has another request waiting, which it
+  ///        pushes right away. Otherwise the client ends its turn and loses
+  ///        what it saved up.
+  void Done(int fd, bool more);
+
+  /// Forget a client that disconnected.
+  void Remove(int fd);
+
+  bool empty() const { return round_.empty(); }
+
+  /// The number of requests that were not served in the first round they
+  /// could have been.
+  int64_t num_waited() const { return num_waited_; }
+
+ private:
+  struct Flow {
+    int weight = 1;
+    int64_t cost = 0;
+    int64_t deficit = 0;
+    /// Whether the client is in its turn, which it keeps while it can pay.
+    bool in_turn = false;
+    bool waited = false;
+  };
+
+  const int64_t quantum_;
+  std::unordered_map<int, Flow> flows_;
+  /// The clients with a request queued, the one in its turn first.
+  std::deque<int> round_;
+  int64_t num_waited_;
+};
+
+}  // namespace plasma
@@ -0,0 +1,157 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/flat_object_table.h"
+
+#include <cstring>
+
+#include "arrow/util/logging.h"
+
+namespace plasma {
+
+constexpr int64_t FlatObjectTable::kGroupWidth;
+constexpr int8_t FlatObjectTable::kEmpty;
+constexpr int8_t FlatObjectTable::kDeleted;
+constexpr int8_t FlatObjectTable::kSentinel;
+
+FlatObjectTable::FlatObjectTable()
+    : capacity_(0), group_mask_(0), size_(0), deleted_(0), generation_(0) {}
+
+FlatObjectTable::~FlatObjectTable() { clear(); }
+
+std::pair<FlatObjectTable::iterator, bool> FlatObjectTable::emplace(
+    const ObjectID& object_id) {
+  const uint64_t hash = object_id.hash();
+  int64_t index = FindIndex(object_id, hash);
+  if (index != capacity_) {
+    return {iterator(this, index), false};
+  }
+  if (size_ + deleted_ + 1 > MaxLoad(capacity_)) {
+    // If most of the used slots are tombstones, compact in place instead of growing.
+    if (capacity_ > 0 && deleted_ >= size_) {
+      Rehash(capacity_);
+    } else {
+      Rehash(capacity_ == 0 ? kGroupWidth : 2 * capacity_);
+    }
+  }
+  index = FindFreeIndex(hash);
+  if (ctrl_[index] == kDeleted) {
+    --deleted_;
+  }
+  ctrl_[index] = H2(hash);
+  Slot& slot = slots_[index];
+  slot.hash = hash;
+  new (slot.value()) value_type(std::piecewise_construct,
+                                std::forward_as_tuple(object_id), std::forward_as_tuple());
+  ++size_;
+  return {iterator(this, index), true};
+}
+
+int64_t FlatObjectTable::erase(const ObjectID& object_id) {
+  int64_t index = FindIndex(object_id, object_id.hash());
+  if (index == capacity_) {
+    return 0;
+  }
+  EraseAt(index);
+  return 1;
+}
+
+void FlatObjectTable::erase(iterator it) {
+  ARROW_CHECK(it.index() < capacity_ && IsFull(ctrl_[it.index()]));
+  EraseAt(it.index());
+}
+
+void FlatObjectTable::clear() {
+  for (int64_t i = 0; i < capacity_; ++i) {
+    if (IsFull(ctrl_[i])) {
+      slots_[i].value()->~value_type();
+    }
+  }
+  if (capacity_ > 0) {
+    std::memset(ctrl_.get(), kEmpty, capacity_);
+  }
+  size_ = 0;
+  deleted_ = 0;
+}
+
+void FlatObjectTable::reserve(int64_t num_entries) {
+  int64_t capacity = capacity_ == 0 ? kGroupWidth : capacity_;
+  while (MaxLoad(capacity) < num_entries) {
+    capacity *= 2;
+  }
+  if (capacity > capacity_) {
+    Rehash(capacity);
+  }
+}
+
+int64_t FlatObjectTable::FindFreeIndex(uint64_t hash) const {
+  int64_t group = H1(hash) & group_mask_;
+  for (int64_t probe = 1;; ++probe) {
+    Group g(ctrl_.get() + group * kGroupWidth);
+    uint32_t match = g.MatchEmptyOrDeleted();
+    if (match != 0) {
+      return group * kGroupWidth + LowestBit(match);
+    }
+    group = (group + probe) & group_mask_;
+  }
+}
+
+void FlatObjectTable::EraseAt(int64_t index) {
+  slots_[index].value()->~value_type();
+  --size_;
+  // Probes stop at the first group that has an empty slot, so if this group
+  // still has one, no probe sequence can run past it and the slot can be
+  // marked empty instead of leaving a tombstone.
+  const int64_t group = index / kGroupWidth;
+  if (Group(ctrl_.get() + group * kGroupWidth).MatchEmpty() != 0) {
+    ctrl_[index] = kEmpty;
+  } else {
+    ctrl_[index] = kDeleted;
+    ++deleted_;
+  }
+}
+
+void FlatObjectTable::Rehash(int64_t new_capacity) {
+  ARROW_CHECK(new_capacity >= kGroupWidth && (new_capacity & (new_capacity - 1)) == 0);
+  ARROW_CHECK(MaxLoad(new_capacity) > size_);
+
+  std::unique_ptr<int8_t[]> old_ctrl = std::move(ctrl_);
+  std::unique_ptr<Slot[]> old_slots = std::move(slots_);
+  const int64_t old_capacity = capacity_;
+
+  ctrl_.reset(new int8_t[new_capacity]);
+  std::memset(ctrl_.get(), kEmpty, new_capacity);
+  slots_.reset(new Slot[new_capacity]);
+  capacity_ = new_capacity;
+  group_mask_ = new_capacity / kGroupWidth - 1;
+  deleted_ = 0;
+  ++generation_;
+
+  for (int64_t i = 0; i < old_capacity; ++i) {
+    if (!IsFull(old_ctrl[i])) {
+      continue;
+    }
+    Slot& old_slot = old_slots[i];
+    const int64_t index = FindFreeIndex(old_slot.hash);
+    ctrl_[index] = H2(old_slot.hash);
+    slots_[index].hash = old_slot.hash;
+    new (slots_[index].value()) value_type(std::move(*old_slot.value()));
+    old_slot.value()->~value_type();
+  }
+}
+
+}  // namespace plasma
@@ -0,0 +1,275 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "arrow/util/macros.h"
+#include "plasma/common.h"
+
+namespace plasma {
+
+/// An open-addressing hash table mapping object IDs to their ObjectTableEntry.
+///
+/// Slots are organized in groups of kGroupWidth. A separate array holds one
+/// control byte per slot: either a sentinel (empty or deleted) or the low 7 bits
+/// of the hash of the ID stored in the slot. A lookup compares the tag against a
+/// whole group of control bytes at once (with SSE2 when available) and only
+/// touches the slots whose tag matches. Slots store the entry inline next to the
+/// memoized 64-bit hash, so a successful lookup usually costs one miss on the
+/// control bytes and one on the slot.
+///
+/// Erasing leaves the other entries in place, but inserting may rehash the table
+/// and move every entry. Pointers into the table are therefore only valid until
+/// the next insertion.
+class ARROW_EXPORT FlatObjectTable {
+ public:
+  using key_type = ObjectID;
+  using mapped_type = ObjectTableEntry;
+  using value_type = std::pair<const ObjectID, ObjectTableEntry>;
+
+  static constexpr int64_t kGroupWidth = 16;
+
+ private:
+  struct Slot {
+    uint64_t hash;
+    alignas(value_type) unsigned char storage[sizeof(value_type)];
+
+    value_type* value() { return reinterpret_cast<value_type*>(storage); }
+    const value_type* value() const {
+      return reinterpret_cast<const value_type*>(storage);
+    }
+  };
+
+  template <typename Table, typename Value>
+  class IteratorBase {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value*;
+    using reference = Value&;
+
+    IteratorBase() : table_(nullptr), index_(0) {}
+    IteratorBase(Table* table, int64_t index) : table_(table), index_(index) {
+      SkipEmpty();
+    }
+
+    reference operator*() const { return *table_->slots_[index_].value(); }
+    pointer operator->() const { return table_->slots_[index_].value(); }
+
+    IteratorBase& operator++() {
+      ++index_;
+      SkipEmpty();
+      return *this;
+    }
+    IteratorBase operator++(int) {
+      IteratorBase result = *this;
+      ++*this;
+      return result;
+    }
+
+    bool operator==(const IteratorBase& other) const { return index_ == other.index_; }
+    bool operator!=(const IteratorBase& other) const { return index_ != other.index_; }
+
+    /// The slot index this iterator points at, or the table capacity at the end.
+    int64_t index() const { return index_; }
+
+   private:
+    void SkipEmpty() {
+      while (index_ < table_->capacity_ && !IsFull(table_->ctrl_[index_])) {
+        ++index_;
+      }
+    }
+
+    Table* table_;
+    int64_t index_;
+  };
+
+ public:
+  using iterator = IteratorBase<FlatObjectTable, value_type>;
+  using const_iterator = IteratorBase<const FlatObjectTable, const value_type>;
+
+  FlatObjectTable();
+  ~FlatObjectTable();
+
+  iterator begin() { return iterator(this, 0); }
+  iterator end() { return iterator(this, capacity_); }
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, capacity_); }
+
+  /// Iterate starting from a given slot index. Slot indices are stable as long
+  /// as the table is not rehashed, which makes them usable as scan cursors.
+  iterator begin_at(int64_t index) {
+    return iterator(this, std::min(std::max<int64_t>(index, 0), capacity_));
+  }
+  const_iterator begin_at(int64_t index) const {
+    return const_iterator(this, std::min(std::max<int64_t>(index, 0), capacity_));
+  }
+
+  iterator find(const ObjectID& object_id) {
+    return iterator(this, FindIndex(object_id, object_id.hash()));
+  }
+  const_iterator find(const ObjectID& object_id) const {
+    return const_iterator(this, FindIndex(object_id, object_id.hash()));
+  }
+
+  int64_t count(const ObjectID& object_id) const {
+    return FindIndex(object_id, object_id.hash()) != capacity_ ? 1 : 0;
+  }
+
+  /// Insert a default-constructed entry for object_id if there is none.
+  ///
+  /// \return An iterator to the entry for object_id and whether it was inserted.
+  std::pair<iterator, bool> emplace(const ObjectID& object_id);
+
+  /// Remove the entry for object_id if there is one.
+  ///
+  /// \return The number of removed entries.
+  int64_t erase(const ObjectID& object_id);
+
+  /// Remove the entry pointed at by an iterator.
+  void erase(iterator it);
+
+  void clear();
+
+  /// Make room for at least num_entries entries without rehashing.
+  void reserve(int64_t num_entries);
+
+  int64_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  int64_t capacity() const { return capacity_; }
+
+  /// The number of times the table was rehashed. A scan cursor taken at
+  /// another generation may skip or repeat entries.
+  int64_t generation() const { return generation_; }
+
+ private:
+  static constexpr int8_t kEmpty = -128;
+  static constexpr int8_t kDeleted = -2;
+  static constexpr int8_t kSentinel = -1;
+
+  static bool IsFull(int8_t ctrl) { return ctrl >= 0; }
+  static int64_t H1(uint64_t hash) { return static_cast<int64_t>(hash >> 7); }
+  static int8_t H2(uint64_t hash) { return static_cast<int8_t>(hash & 0x7F); }
+  static int64_t MaxLoad(int64_t capacity) { return capacity - capacity / 8; }
+
+  /// A bitmask over the control bytes of one group.
+  class Group {
+   public:
+    explicit Group(const int8_t* ctrl) {
+#if defined(__SSE2__)
+      ctrl_ = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+#else
+      ctrl_ = ctrl;
+#endif
+    }
+
+    uint32_t Match(int8_t tag) const {
+#if defined(__SSE2__)
+      return static_cast<uint32_t>(
+          _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(tag), ctrl_)));
+#else
+      uint32_t mask = 0;
+      for (int i = 0; i < kGroupWidth; ++i) {
+        mask |= static_cast<uint32_t>(ctrl_[i] == tag) << i;
+      }
+      return mask;
+#endif
+    }
+
+    uint32_t MatchEmpty() const { return Match(kEmpty); }
+
+    uint32_t MatchEmptyOrDeleted() const {
+#if defined(__SSE2__)
+      return static_cast<uint32_t>(
+          _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(kSentinel), ctrl_)));
+#else
+      uint32_t mask = 0;
+      for (int i = 0; i < kGroupWidth; ++i) {
+        mask |= static_cast<uint32_t>(ctrl_[i] < kSentinel) << i;
+      }
+      return mask;
+#endif
+    }
+
+   private:
+#if defined(__SSE2__)
+    __m128i ctrl_;
+#else
+    const int8_t* ctrl_;
+#endif
+  };
+
+  static int LowestBit(uint32_t mask) { return __builtin_ctz(mask); }
+
+  int64_t FindIndex(const ObjectID& object_id, uint64_t hash) const {
+    if (ARROW_PREDICT_FALSE(capacity_ == 0)) {
+      return capacity_;
+    }
+    const int8_t tag = H2(hash);
+    int64_t group = H1(hash) & group_mask_;
+    // Triangular probing visits every group when the group count is a power of 2.
+    for (int64_t probe = 1;; ++probe) {
+      const int8_t* ctrl = ctrl_.get() + group * kGroupWidth;
+      Group g(ctrl);
+      for (uint32_t match = g.Match(tag); match != 0; match &= match - 1) {
+        int64_t index = group * kGroupWidth + LowestBit(match);
+        const Slot& slot = slots_[index];
+        if (slot.hash == hash && slot.value()->first == object_id) {
+          return index;
+        }
+      }
+      if (ARROW_PREDICT_TRUE(g.MatchEmpty() != 0)) {
+        return capacity_;
+      }
+      group = (group + probe) & group_mask_;
+    }
+  }
+
+  /// Find a free (empty or deleted) slot for an ID with the given hash.
+  int64_t FindFreeIndex(uint64_t hash) const;
+
+  void EraseAt(int64_t index);
+
+  void Rehash(int64_t new_capacity);
+
+  std::unique_ptr<int8_t[]> ctrl_;
+  std::unique_ptr<Slot[]> slots_;
+  /// Number of slots, zero or a power of two multiple of kGroupWidth.
+  int64_t capacity_;
+  int64_t group_mask_;
+  int64_t size_;
+  int64_t deleted_;
+  int64_t generation_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(FlatObjectTable);
+};
+
+}  // namespace plasma
@@ -0,0 +1,155 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/lease_table.h"
+
+#include "arrow/util/logging.h"
+
+namespace plasma {
+
+namespace {
+
+constexpr uint64_t kLeaseTableMagic = 0x5345534145534c50;  // "PLSEASES"
+
+// The low two bits of a slot hold the state of its lease, the others the
+// generation of the slot.
+constexpr uint64_t kStateMask = 3;
+constexpr uint64_t kFree = 0;
+constexpr uint64_t kActive = 1;
+constexpr uint64_t kIdle = 2;
+constexpr uint64_t kRevoked = 3;
+
+// A lease carries the generation in its upper half, truncated so that the
+// lease stays positive.
+constexpr int kGenerationShift = 32;
+constexpr uint64_t kGenerationMask = 0x7fffffff;
+
+uint64_t State(uint64_t word) { return word & kStateMask; }
+uint64_t Generation(uint64_t word) { return word >> 2; }
+
+int64_t SlotIndex(int64_t lease) { return lease & 0xffffffff; }
+uint64_t LeaseGeneration(int64_t lease) {
+  return static_cast<uint64_t>(lease) >> kGenerationShift;
+}
+
+}  // namespace
+
+struct alignas(64) LeaseTable::Header {
+  std::atomic<uint64_t> magic;
+  int64_t capacity;
+};
+
+// Slots get a cache line each, so that clients using different objects do not
+// contend.
+struct alignas(64) LeaseTable::Slot {
+  std::atomic<uint64_t> word;
+
+  bool Matches(uint64_t value, int64_t lease) const {
+    return (Generation(value) & kGenerationMask) == LeaseGeneration(lease);
+  }
+};
+
+int64_t LeaseTable::RequiredSize(int64_t capacity) {
+  return static_cast<int64_t>(sizeof(Header)) +
+         capacity * static_cast<int64_t>(sizeof(Slot));
+}
+
+LeaseTable::LeaseTable(Slot* slots, int64_t capacity)
+    : slots_(slots), capacity_(capacity) {}
+
+std::unique_ptr<LeaseTable> LeaseTable::Create(uint8_t* region, int64_t capacity) {
+  ARROW_CHECK(capacity > 0 && capacity <= (int64_t(1) << kGenerationShift));
+  ARROW_CHECK(reinterpret_cast<uintptr_t>(region) % alignof(Header) == 0);
+  auto header = new (region) Header();
+  header->magic.store(0, std::memory_order_relaxed);
+  header->capacity = capacity;
+  auto slots = reinterpret_cast<Slot*>(region + sizeof(Header));
+  std::unique_ptr<LeaseTable> table(new LeaseTable(slots, capacity));
+  table->free_slots_.reserve(capacity);
+  for (int64_t i = capacity - 1; i >= 0; --i) {
+    new (&slots[i]) Slot();
+    slots[i].word.store(kFree, std::memory_order_relaxed);
+    table->free_slots_.push_back(i);
+  }
+  header->magic.store(kLeaseTableMagic, std::memory_order_release);
+  return table;
+}
+
+std::unique_ptr<LeaseTable> LeaseTable::Open(uint8_t* region, int64_t region_size) {
+  if (region_size < static_cast<int64_t>(sizeof(Header))) {
+    return nullptr;
+  }
+  auto header = reinterpret_cast<Header*>(region);
+  if (header->magic.load(std::memory_order_acquire) != kLeaseTableMagic) {
+    return nullptr;
+  }
+  const int64_t capacity = header->capacity;
+  if (capacity <= 0 || RequiredSize(capacity) > region_size) {
+    return nullptr;
+  }
+  auto slots = reinterpret_cast<Slot*>(region + sizeof(Header));
+  return std::unique_ptr<LeaseTable>(new LeaseTable(slots, capacity));
+}
+
+int64_t LeaseTable::Grant() {
+  if (free_slots_.empty()) {
+    return kNoLease;
+  }
+  const int64_t index = free_slots_.back();
+  free_slots_.pop_back();
+  Slot& slot = slots_[index];
+  const uint64_t generation = Generation(slot.word.load(std::memory_order_relaxed)) + 1;
+  slot.word.store((generation << 2) | kActive, std::memory_order_release);
+  return static_cast<int64_t>((generation & kGenerationMask) << kGenerationShift) | index;
+}
+
+bool LeaseTable::Revoke(int64_t lease) {
+  Slot& slot = slots_[SlotIndex(lease)];
+  uint64_t word = slot.word.load(std::memory_order_acquire);
+  if (!slot.Matches(word, lease) || State(word) != kIdle) {
+    return false;
+  }
+  // Fails if the client marked the lease active in the meantime.
+  return slot.word.compare_exchange_strong(word, (word & ~kStateMask) | kRevoked,
+                                           std::memory_order_acq_rel);
+}
+
+void LeaseTable::Free(int64_t lease) {
+  const int64_t index = SlotIndex(lease);
+  Slot& slot = slots_[index];
+  const uint64_t word = slot.word.load(std::memory_order_relaxed);
+  ARROW_CHECK(slot.Matches(word, lease) && State(word) != kFree);
+  slot.word.store(word & ~kStateMask, std::memory_order_release);
+  free_slots_.push_back(index);
+}
+
+bool LeaseTable::Acquire(int64_t lease) {
+  Slot& slot = slots_[SlotIndex(lease)];
+  uint64_t word = slot.word.load(std::memory_order_acquire);
+  if (!slot.Matches(word, lease) || State(word) != kIdle) {
+    return false;
+  }
+  return slot.word.compare_exchange_strong(word, (word & ~kStateMask) | kActive,
+                                           std::memory_order_acq_rel);
+}
+
+void LeaseTable::Release(int64_t lease) {
+  // Only the client changes an active lease, so this needs no compare.
+  slots_[SlotIndex(lease)].word.fetch_add(kIdle - kActive, std::memory_order_release);
+}
+
+}  // namespace plasma
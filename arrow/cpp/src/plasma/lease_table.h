@@ -0,0 +1,101 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace plasma {
+
+/// Value of a lease that does not exist.
+constexpr int64_t kNoLease = -1;
+
+/// Leases on sealed objects, kept in the header of the store's shared memory
+/// region after the object directory.
+///
+/// The store grants a client a lease together with its reference to an object.
+/// While the lease lasts, the client marks it active or idle with atomic
+/// operations, instead of sending a release and a new get for each use. The
+/// store keeps its reference to the object, and only takes back leases that
+/// are idle, when it needs the memory or the object is deleted. A client whose
+/// lease was taken back has to ask the store again.
+///
+/// A lease is named by a slot index and the generation of the slot, so that a
+/// client holding on to an old lease can not touch the slot once the store
+/// hands it out again.
+class ARROW_EXPORT LeaseTable {
+ public:
+  /// Number of bytes a table with the given number of slots occupies.
+  static int64_t RequiredSize(int64_t capacity);
+
+  /// Format an empty table. Only the store, which formats the table, may call
+  /// the methods that grant and take back leases.
+  ///
+  /// \param region Where the table starts, aligned to a cache line.
+  /// \param capacity The number of slots.
+  static std::unique_ptr<LeaseTable> Create(uint8_t* region, int64_t capacity);
+
+  /// Attach to a table another process formatted.
+  ///
+  /// \return The table, or nullptr if there is none at region.
+  static std::unique_ptr<LeaseTable> Open(uint8_t* region, int64_t region_size);
+
+  /// Grant a new lease, which starts out active.
+  ///
+  /// \return The lease, or kNoLease if all slots are taken.
+  int64_t Grant();
+
+  /// Take back a lease if it is idle.
+  ///
+  /// \return False if the client is using the object under the lease.
+  bool Revoke(int64_t lease);
+
+  /// Make the slot of a lease available again. The lease must be revoked, or
+  /// its client must have given it up through the store.
+  void Free(int64_t lease);
+
+  /// Mark an idle lease active before using the object again.
+  ///
+  /// \return False if the store took the lease back.
+  bool Acquire(int64_t lease);
+
+  /// Mark an active lease idle once the object is not used anymore.
+  void Release(int64_t lease);
+
+  int64_t capacity() const { return capacity_; }
+
+ private:
+  struct Header;
+  struct Slot;
+
+  LeaseTable(Slot* slots, int64_t capacity);
+
+  Slot* slots_;
+  int64_t capacity_;
+  /// Slots that are not leased out. Only the store uses this.
+  std::vector<int64_t> free_slots_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(LeaseTable);
+};
+
+}  // namespace plasma
@@ -65,9 +65,34 @@ class JByteArrayGetter {
     *out = bp;
   }
 
-  ~JByteArrayGetter() { _env->ReleaseByteArrayElements(_a, bp, 0); }
+  // The array is only read, so it is not copied back.
+  ~JByteArrayGetter() { _env->ReleaseByteArrayElements(_a, bp, JNI_ABORT); }
 };
 
+// The object IDs of a batch, packed one after the other in a single array so
+// that they cross JNI in one copy.
+inline std::vector<plasma::ObjectID> packed_object_ids(JNIEnv* env, jbyteArray a) {
+  std::vector<plasma::ObjectID> oids(env->GetArrayLength(a) / OBJECT_ID_SIZE);
+  env->GetByteArrayRegion(a, 0, static_cast<jsize>(oids.size()) * OBJECT_ID_SIZE,
+                          reinterpret_cast<jbyte*>(oids.data()));
+  return oids;
+}
+
+inline void throw_create_exception(JNIEnv* env, const arrow::Status& status,
+                                   const plasma::ObjectID& oid) {
+  if (plasma::IsPlasmaObjectExists(status)) {
+    jclass exceptionClass =
+        env->FindClass("org/apache/arrow/plasma/exceptions/DuplicateObjectException");
+    env->ThrowNew(exceptionClass, oid.hex().c_str());
+  } else if (plasma::IsPlasmaStoreFull(status)) {
+    jclass exceptionClass =
+        env->FindClass("org/apache/arrow/plasma/exceptions/PlasmaOutOfMemoryException");
+    env->ThrowNew(exceptionClass, "");
+  } else {
+    throw_exception_if_not_OK(env, status);
+  }
+}
+
 JNIEXPORT jlong JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_connect(
     JNIEnv* env, jclass cls, jstring store_socket_name, jstring manager_socket_name,
     jint release_delay) {
@@ -82,6 +107,28 @@ JNIEXPORT jlong JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_connect(
   return reinterpret_cast<int64_t>(client);
 }
 
+JNIEXPORT jlong JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_connectWithRemoteMemory(
+    JNIEnv* env, jclass cls, jstring store_socket_name, jstring manager_socket_name,
+    jint release_delay, jstring remote_memory_file) {
+  const char* s_name = env->GetStringUTFChars(store_socket_name, nullptr);
+  const char* m_name = env->GetStringUTFChars(manager_socket_name, nullptr);
+  const char* r_name = env->GetStringUTFChars(remote_memory_file, nullptr);
+
+  // The region is mapped before connecting, so that the store knows it may
+  // place the objects of this client there.
+  plasma::PlasmaClient* client = new plasma::PlasmaClient();
+  arrow::Status s = client->MmapRemoteMemory(r_name);
+  if (s.ok()) {
+    s = client->Connect(s_name, m_name, release_delay);
+  }
+  throw_exception_if_not_OK(env, s);
+
+  env->ReleaseStringUTFChars(store_socket_name, s_name);
+  env->ReleaseStringUTFChars(manager_socket_name, m_name);
+  env->ReleaseStringUTFChars(remote_memory_file, r_name);
+  return reinterpret_cast<int64_t>(client);
+}
+
 JNIEXPORT void JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_disconnect(
     JNIEnv* env, jclass cls, jlong conn) {
   plasma::PlasmaClient* client = reinterpret_cast<plasma::PlasmaClient*>(conn);
@@ -111,21 +158,75 @@ JNIEXPORT jobject JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_create(
 
   std::shared_ptr<Buffer> data;
   Status s = client->Create(oid, size, md, md_size, &data);
-  if (plasma::IsPlasmaObjectExists(s)) {
-    jclass exceptionClass =
-        env->FindClass("org/apache/arrow/plasma/exceptions/DuplicateObjectException");
-    env->ThrowNew(exceptionClass, oid.hex().c_str());
+  if (!s.ok()) {
+    throw_create_exception(env, s, oid);
     return nullptr;
   }
-  if (plasma::IsPlasmaStoreFull(s)) {
-    jclass exceptionClass =
-        env->FindClass("org/apache/arrow/plasma/exceptions/PlasmaOutOfMemoryException");
-    env->ThrowNew(exceptionClass, "");
+
+  return env->NewDirectByteBuffer(data->mutable_data(), size);
+}
+
+JNIEXPORT jobjectArray JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_createBatch(
+    JNIEnv* env, jclass cls, jlong conn, jbyteArray object_ids, jintArray sizes,
+    jobjectArray metadata) {
+  plasma::PlasmaClient* client = reinterpret_cast<plasma::PlasmaClient*>(conn);
+  std::vector<plasma::ObjectID> oids = packed_object_ids(env, object_ids);
+  const jsize num_oids = static_cast<jsize>(oids.size());
+  std::vector<jint> data_sizes(num_oids);
+  env->GetIntArrayRegion(sizes, 0, num_oids, data_sizes.data());
+
+  // The creates are pipelined: all of them are sent before the first reply is
+  // read. Each metadata array is copied once, into the scratch buffer that
+  // CreateAsync copies out of before it returns.
+  std::vector<arrow::Future<std::shared_ptr<Buffer>>> futures;
+  futures.reserve(num_oids);
+  std::vector<uint8_t> md;
+  for (jsize i = 0; i < num_oids; ++i) {
+    jbyteArray md_array = nullptr;
+    if (metadata != nullptr) {
+      md_array = reinterpret_cast<jbyteArray>(env->GetObjectArrayElement(metadata, i));
+    }
+    jsize md_size = md_array == nullptr ? 0 : env->GetArrayLength(md_array);
+    md.resize(md_size);
+    if (md_size > 0) {
+      env->GetByteArrayRegion(md_array, 0, md_size, reinterpret_cast<jbyte*>(md.data()));
+    }
+    if (md_array != nullptr) {
+      env->DeleteLocalRef(md_array);
+    }
+    futures.push_back(client->CreateAsync(oids[i], data_sizes[i],
+                                          md_size > 0 ? md.data() : nullptr, md_size));
+  }
+
+  // Either all of the objects are created or none is.
+  arrow::Status first_error;
+  jsize failed = -1;
+  for (jsize i = 0; i < num_oids; ++i) {
+    const arrow::Status& s = futures[i].status();
+    if (!s.ok() && failed == -1) {
+      first_error = s;
+      failed = i;
+    }
+  }
+  if (failed != -1) {
+    for (jsize i = 0; i < num_oids; ++i) {
+      if (futures[i].status().ok()) {
+        ARROW_UNUSED(client->Abort(oids[i]));
+      }
+    }
+    throw_create_exception(env, first_error, oids[failed]);
     return nullptr;
   }
-  throw_exception_if_not_OK(env, s);
 
-  return env->NewDirectByteBuffer(data->mutable_data(), size);
+  jclass clsByteBuffer = env->FindClass("java/nio/ByteBuffer");
+  jobjectArray ret = env->NewObjectArray(num_oids, clsByteBuffer, nullptr);
+  for (jsize i = 0; i < num_oids; ++i) {
+    const std::shared_ptr<Buffer>& data = futures[i].result().ValueOrDie();
+    jobject dataBuf = env->NewDirectByteBuffer(data->mutable_data(), data_sizes[i]);
+    env->SetObjectArrayElement(ret, i, dataBuf);
+    env->DeleteLocalRef(dataBuf);
+  }
+  return ret;
 }
 
 JNIEXPORT jbyteArray JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_hash(
@@ -156,6 +257,40 @@ JNIEXPORT void JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_seal(
   throw_exception_if_not_OK(env, client->Seal(oid));
 }
 
+JNIEXPORT void JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_sealBatch(
+    JNIEnv* env, jclass cls, jlong conn, jbyteArray object_ids) {
+  plasma::PlasmaClient* client = reinterpret_cast<plasma::PlasmaClient*>(conn);
+  std::vector<plasma::ObjectID> oids = packed_object_ids(env, object_ids);
+
+  std::vector<arrow::Future<>> futures;
+  futures.reserve(oids.size());
+  for (const auto& oid : oids) {
+    futures.push_back(client->SealAsync(oid));
+  }
+  arrow::Status status;
+  for (auto& future : futures) {
+    if (status.ok()) {
+      status = future.status();
+    } else {
+      future.Wait();
+    }
+  }
+  throw_exception_if_not_OK(env, status);
+}
+
+JNIEXPORT void JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_releaseBatch(
+    JNIEnv* env, jclass cls, jlong conn, jbyteArray object_ids) {
+  plasma::PlasmaClient* client = reinterpret_cast<plasma::PlasmaClient*>(conn);
+  arrow::Status status;
+  for (const auto& oid : packed_object_ids(env, object_ids)) {
+    arrow::Status s = client->Release(oid);
+    if (status.ok()) {
+      status = s;
+    }
+  }
+  throw_exception_if_not_OK(env, status);
+}
+
 JNIEXPORT void JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_release(
     JNIEnv* env, jclass cls, jlong conn, jbyteArray object_id) {
   plasma::PlasmaClient* client = reinterpret_cast<plasma::PlasmaClient*>(conn);
@@ -219,6 +354,40 @@ JNIEXPORT jobjectArray JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_get(
   return ret;
 }
 
+JNIEXPORT jobjectArray JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_getBatch(
+    JNIEnv* env, jclass cls, jlong conn, jbyteArray object_ids, jint timeout_ms) {
+  plasma::PlasmaClient* client = reinterpret_cast<plasma::PlasmaClient*>(conn);
+  std::vector<plasma::ObjectID> oids = packed_object_ids(env, object_ids);
+  const jsize num_oids = static_cast<jsize>(oids.size());
+  std::vector<plasma::ObjectBuffer> obufs(num_oids);
+  arrow::Status s = client->Get(oids.data(), num_oids, timeout_ms, obufs.data());
+  if (!s.ok()) {
+    throw_exception_if_not_OK(env, s);
+    return nullptr;
+  }
+
+  // The data and metadata of each object, one after the other, over the
+  // memory they are mapped at, which is the remote region for remote objects.
+  jclass clsByteBuffer = env->FindClass("java/nio/ByteBuffer");
+  jobjectArray ret = env->NewObjectArray(2 * num_oids, clsByteBuffer, nullptr);
+  for (jsize i = 0; i < num_oids; ++i) {
+    if (!obufs[i].data || obufs[i].data->size() == -1) {
+      continue;
+    }
+    jobject dataBuf = env->NewDirectByteBuffer(
+        const_cast<uint8_t*>(obufs[i].data->data()), obufs[i].data->size());
+    env->SetObjectArrayElement(ret, 2 * i, dataBuf);
+    env->DeleteLocalRef(dataBuf);
+    if (obufs[i].metadata && obufs[i].metadata->size() > 0) {
+      jobject metadataBuf = env->NewDirectByteBuffer(
+          const_cast<uint8_t*>(obufs[i].metadata->data()), obufs[i].metadata->size());
+      env->SetObjectArrayElement(ret, 2 * i + 1, metadataBuf);
+      env->DeleteLocalRef(metadataBuf);
+    }
+  }
+  return ret;
+}
+
 JNIEXPORT jboolean JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_contains(
     JNIEnv* env, jclass cls, jlong conn, jbyteArray object_id) {
   plasma::PlasmaClient* client = reinterpret_cast<plasma::PlasmaClient*>(conn);
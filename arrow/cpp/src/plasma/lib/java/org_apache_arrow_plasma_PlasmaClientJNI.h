@@ -32,6 +32,14 @@ extern "C" {
 JNIEXPORT jlong JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_connect(
     JNIEnv*, jclass, jstring, jstring, jint);
 
+/*
+ * Class:     org_apache_arrow_plasma_PlasmaClientJNI
+ * Method:    connectWithRemoteMemory
+ * Signature: (Ljava/lang/String;Ljava/lang/String;ILjava/lang/String;)J
+ */
+JNIEXPORT jlong JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_connectWithRemoteMemory(
+    JNIEnv*, jclass, jstring, jstring, jint, jstring);
+
 /*
  * Class:     org_apache_arrow_plasma_PlasmaClientJNI
  * Method:    disconnect
@@ -49,6 +57,14 @@ JNIEXPORT void JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_disconnect(J
 JNIEXPORT jobject JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_create(
     JNIEnv*, jclass, jlong, jbyteArray, jint, jbyteArray);
 
+/*
+ * Class:     org_apache_arrow_plasma_PlasmaClientJNI
+ * Method:    createBatch
+ * Signature: (J[B[I[[B)[Ljava/nio/ByteBuffer;
+ */
+JNIEXPORT jobjectArray JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_createBatch(
+    JNIEnv*, jclass, jlong, jbyteArray, jintArray, jobjectArray);
+
 /*
  * Class:     org_apache_arrow_plasma_PlasmaClientJNI
  * Method:    hash
@@ -66,6 +82,14 @@ JNIEXPORT void JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_seal(JNIEnv*
                                                                          jlong,
                                                                          jbyteArray);
 
+/*
+ * Class:     org_apache_arrow_plasma_PlasmaClientJNI
+ * Method:    sealBatch
+ * Signature: (J[B)V
+ */
+JNIEXPORT void JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_sealBatch(
+    JNIEnv*, jclass, jlong, jbyteArray);
+
 /*
  * Class:     org_apache_arrow_plasma_PlasmaClientJNI
  * Method:    release
@@ -75,6 +99,14 @@ JNIEXPORT void JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_release(JNIE
                                                                             jclass, jlong,
                                                                             jbyteArray);
 
+/*
+ * Class:     org_apache_arrow_plasma_PlasmaClientJNI
+ * Method:    releaseBatch
+ * Signature: (J[B)V
+ */
+JNIEXPORT void JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_releaseBatch(
+    JNIEnv*, jclass, jlong, jbyteArray);
+
 /*
  * Class:     org_apache_arrow_plasma_PlasmaClientJNI
  * Method:    delete
@@ -92,6 +124,14 @@ JNIEXPORT void JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_delete(JNIEn
 JNIEXPORT jobjectArray JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_get(
     JNIEnv*, jclass, jlong, jobjectArray, jint);
 
+/*
+ * Class:     org_apache_arrow_plasma_PlasmaClientJNI
+ * Method:    getBatch
+ * Signature: (J[BI)[Ljava/nio/ByteBuffer;
+ */
+JNIEXPORT jobjectArray JNICALL Java_org_apache_arrow_plasma_PlasmaClientJNI_getBatch(
+    JNIEnv*, jclass, jlong, jbyteArray, jint);
+
 /*
  * Class:     org_apache_arrow_plasma_PlasmaClientJNI
  * Method:    contains
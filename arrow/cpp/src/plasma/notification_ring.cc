@@ -0,0 +1,150 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/notification_ring.h"
+
+#include <atomic>
+#include <cstring>
+#include <new>
+
+#include "arrow/util/logging.h"
+
+namespace plasma {
+
+namespace {
+
+constexpr uint64_t kNotificationRingMagic = 0x474e49524946544e;  // "NTFIRING"
+
+}  // namespace
+
+// The head and the tail get a cache line each, since they are written by
+// different processes.
+struct alignas(64) NotificationRing::Header {
+  std::atomic<uint64_t> magic;
+  int64_t capacity;
+  alignas(64) std::atomic<uint64_t> tail;
+  alignas(64) std::atomic<uint64_t> head;
+};
+
+struct NotificationRing::Entry {
+  uint8_t object_id[kUniqueIDSize];
+  int64_t data_size;
+  int64_t metadata_size;
+};
+
+int64_t NotificationRing::RequiredSize(int64_t capacity) {
+  return static_cast<int64_t>(sizeof(Header)) +
+         capacity * static_cast<int64_t>(sizeof(Entry));
+}
+
+NotificationRing::NotificationRing(Header* header, Entry* entries, int64_t capacity)
+    : header_(header),
+      entries_(entries),
+      capacity_(capacity),
+      pending_tail_(header->tail.load(std::memory_order_acquire)),
+      published_tail_(pending_tail_),
+      head_(header->head.load(std::memory_order_acquire)),
+      cached_tail_(pending_tail_) {}
+
+std::unique_ptr<NotificationRing> NotificationRing::Create(uint8_t* region,
+                                                           int64_t capacity) {
+  ARROW_CHECK(capacity > 0);
+  ARROW_CHECK(reinterpret_cast<uintptr_t>(region) % alignof(Header) == 0);
+  auto header = new (region) Header();
+  header->magic.store(0, std::memory_order_relaxed);
+  header->capacity = capacity;
+  header->tail.store(0, std::memory_order_relaxed);
+  header->head.store(0, std::memory_order_relaxed);
+  auto entries = reinterpret_cast<Entry*>(region + sizeof(Header));
+  header->magic.store(kNotificationRingMagic, std::memory_order_release);
+  return std::unique_ptr<NotificationRing>(
+      new NotificationRing(header, entries, capacity));
+}
+
+std::unique_ptr<NotificationRing> NotificationRing::Open(uint8_t* region,
+                                                         int64_t region_size) {
+  if (region_size < static_cast<int64_t>(sizeof(Header))) {
+    return nullptr;
+  }
+  auto header = reinterpret_cast<Header*>(region);
+  if (header->magic.load(std::memory_order_acquire) != kNotificationRingMagic) {
+    return nullptr;
+  }
+  // The capacity is read once, so that the other process can not make the
+  // entries overrun the region by changing it later.
+  const int64_t capacity = header->capacity;
+  if (capacity <= 0 ||
+      capacity > (region_size - static_cast<int64_t>(sizeof(Header))) /
+                     static_cast<int64_t>(sizeof(Entry))) {
+    return nullptr;
+  }
+  auto entries = reinterpret_cast<Entry*>(region + sizeof(Header));
+  return std::unique_ptr<NotificationRing>(
+      new NotificationRing(header, entries, capacity));
+}
+
+bool NotificationRing::Push(const ObjectID& object_id, int64_t data_size,
+                            int64_t metadata_size) {
+  const uint64_t head = header_->head.load(std::memory_order_acquire);
+  // A head past the tail wraps around to a huge difference, so it is full too.
+  if (pending_tail_ - head >= static_cast<uint64_t>(capacity_)) {
+    return false;
+  }
+  Entry& entry = entries_[pending_tail_ % capacity_];
+  std::memcpy(entry.object_id, object_id.data(), kUniqueIDSize);
+  entry.data_size = data_size;
+  entry.metadata_size = metadata_size;
+  pending_tail_ += 1;
+  return true;
+}
+
+bool NotificationRing::Publish() {
+  if (pending_tail_ == published_tail_) {
+    return false;
+  }
+  const uint64_t previous_tail = published_tail_;
+  published_tail_ = pending_tail_;
+  // The store of the tail and the load of the head are sequentially
+  // consistent, like the store of the head and the load of the tail in Pop, so
+  // that either the subscriber sees the new tail or the store sees that the
+  // subscriber caught up and wakes it.
+  header_->tail.store(published_tail_, std::memory_order_seq_cst);
+  return header_->head.load(std::memory_order_seq_cst) == previous_tail;
+}
+
+bool NotificationRing::Pop(ObjectID* object_id, int64_t* data_size,
+                           int64_t* metadata_size) {
+  if (head_ == cached_tail_) {
+    cached_tail_ = header_->tail.load(std::memory_order_seq_cst);
+    if (head_ == cached_tail_) {
+      return false;
+    }
+  }
+  const Entry& entry = entries_[head_ % capacity_];
+  std::memcpy(object_id->mutable_data(), entry.object_id, kUniqueIDSize);
+  *data_size = entry.data_size;
+  *metadata_size = entry.metadata_size;
+  head_ += 1;
+  header_->head.store(head_, std::memory_order_seq_cst);
+  return true;
+}
+
+bool NotificationRing::Empty() const {
+  return head_ == header_->tail.load(std::memory_order_seq_cst);
+}
+
+}  // namespace plasma
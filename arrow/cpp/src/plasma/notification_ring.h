@@ -0,0 +1,101 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+#include "plasma/common.h"
+
+namespace plasma {
+
+/// A ring of object notifications in memory shared between the store and one
+/// subscriber, which replaces the notification socket for subscribers that
+/// ask for it.
+///
+/// The store is the only producer and the subscriber the only consumer, so the
+/// ring needs no locks: the store writes entries and then moves the tail, the
+/// subscriber reads entries and then moves the head. The store makes the
+/// entries of a batch visible at once with Publish, which also tells whether
+/// the subscriber had read everything before, so that the store only has to
+/// wake it up when it may be waiting.
+///
+/// The subscriber formats the ring and the store attaches to it, so the store
+/// never trusts the head: a head that does not make sense makes the ring full.
+class ARROW_EXPORT NotificationRing {
+ public:
+  /// Number of bytes a ring with the given number of entries occupies.
+  static int64_t RequiredSize(int64_t capacity);
+
+  /// Format an empty ring.
+  ///
+  /// \param region Where the ring starts, aligned to a cache line.
+  /// \param capacity The number of entries.
+  static std::unique_ptr<NotificationRing> Create(uint8_t* region, int64_t capacity);
+
+  /// Attach to a ring another process formatted.
+  ///
+  /// \return The ring, or nullptr if there is none at region.
+  static std::unique_ptr<NotificationRing> Open(uint8_t* region, int64_t region_size);
+
+  /// Write a notification, which stays invisible to the subscriber until the
+  /// next Publish. Only the store may call this. A deletion has sizes of -1.
+  ///
+  /// \return False if the ring is full.
+  bool Push(const ObjectID& object_id, int64_t data_size, int64_t metadata_size);
+
+  /// Make the notifications written since the last call visible. Only the
+  /// store may call this.
+  ///
+  /// \return True if the subscriber had read all notifications before, and
+  /// may be waiting for a wakeup.
+  bool Publish();
+
+  /// Read the next notification. Only the subscriber may call this.
+  ///
+  /// \return False if there is none.
+  bool Pop(ObjectID* object_id, int64_t* data_size, int64_t* metadata_size);
+
+  /// Whether the subscriber has read all published notifications.
+  bool Empty() const;
+
+  int64_t capacity() const { return capacity_; }
+
+ private:
+  struct Header;
+  struct Entry;
+
+  NotificationRing(Header* header, Entry* entries, int64_t capacity);
+
+  Header* header_;
+  Entry* entries_;
+  int64_t capacity_;
+  /// The end of the entries the store wrote, of which those before the
+  /// published tail are visible.
+  uint64_t pending_tail_;
+  uint64_t published_tail_;
+  /// The subscriber's head, and the last tail it saw.
+  uint64_t head_;
+  uint64_t cached_tail_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(NotificationRing);
+};
+
+}  // namespace plasma
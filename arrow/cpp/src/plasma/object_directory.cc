@@ -0,0 +1,446 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/object_directory.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "arrow/util/logging.h"
+
+namespace plasma {
+
+// The directory is shared between processes, so its atomics must not fall
+// back to locks that live in one process only.
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2,
+              "the object directory needs lock-free atomics");
+
+namespace {
+
+constexpr uint64_t kDirectoryMagic = 0x5249444d53414c50;  // "PLASMDIR"
+constexpr uint32_t kDirectoryFormat = 3;
+
+constexpr int64_t kIdWords = (kUniqueIDSize + 7) / 8;
+
+constexpr uint32_t kSlotEmpty = 0;
+constexpr uint32_t kSlotSealed = 1;
+constexpr uint32_t kSlotRemoved = 2;
+
+// A reader gives up on a slot that stays locked this long, which only happens
+// if the store died in the middle of an update.
+constexpr int kMaxReadAttempts = 1 << 20;
+
+// The writer keeps the directory at most this full, and each object within
+// kMaxProbeLength slots of its hash, so that a lookup of a missing object,
+// which may read another machine's memory, ends after a bounded number of
+// slots.
+constexpr int64_t kMaxLoadNumerator = 7;
+constexpr int64_t kMaxLoadDenominator = 8;
+constexpr int64_t kMaxProbeLength = 128;
+
+constexpr int64_t kBytesPerSlot = 16 * 1024;
+constexpr int64_t kMinCapacity = 1024;
+constexpr int64_t kMaxCapacity = 1 << 20;
+
+void IdToWords(const ObjectID& object_id, uint64_t* words) {
+  std::memset(words, 0, kIdWords * sizeof(uint64_t));
+  std::memcpy(words, object_id.data(), kUniqueIDSize);
+}
+
+}  // namespace
+
+struct alignas(64) ObjectDirectory::Header {
+  std::atomic<uint64_t> magic;
+  uint32_t format;
+  uint32_t slot_size;
+  int64_t capacity;
+  std::atomic<int64_t> max_region_size;
+};
+
+struct alignas(64) ObjectDirectory::Slot {
+  std::atomic<uint64_t> sequence;
+  std::atomic<uint32_t> state;
+  std::atomic<int32_t> device_num;
+  std::atomic<uint64_t> id[kIdWords];
+  std::atomic<int64_t> data_offset;
+  std::atomic<int64_t> metadata_offset;
+  std::atomic<int64_t> data_size;
+  std::atomic<int64_t> metadata_size;
+  std::atomic<uint64_t> version;
+  std::atomic<uint64_t> digest;
+
+  bool HasId(const uint64_t* words) const {
+    for (int64_t i = 0; i < kIdWords; ++i) {
+      if (id[i].load(std::memory_order_relaxed) != words[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Only the writer calls these.
+  void BeginWrite() {
+    sequence.store(sequence.load(std::memory_order_relaxed) + 1,
+                   std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+  }
+  void EndWrite() {
+    sequence.store(sequence.load(std::memory_order_relaxed) + 1,
+                   std::memory_order_release);
+  }
+};
+
+int64_t ObjectDirectory::RequiredSize(int64_t capacity) {
+  return static_cast<int64_t>(sizeof(Header)) +
+         capacity * static_cast<int64_t>(sizeof(Slot));
+}
+
+int64_t ObjectDirectory::CapacityForRegion(int64_t region_size) {
+  const int64_t wanted =
+      std::min(std::max(region_size / kBytesPerSlot, kMinCapacity), kMaxCapacity);
+  int64_t capacity = kMinCapacity;
+  while (capacity < wanted) {
+    capacity *= 2;
+  }
+  return capacity;
+}
+
+ObjectDirectory::ObjectDirectory(Header* header, Slot* slots, int64_t capacity)
+    : header_(header),
+      slots_(slots),
+      capacity_(capacity),
+      max_probe_length_(std::min(capacity, kMaxProbeLength)),
+      max_used_slots_(capacity / kMaxLoadDenominator * kMaxLoadNumerator),
+      num_used_slots_(0),
+      last_version_(0) {}
+
+std::unique_ptr<ObjectDirectory> ObjectDirectory::Create(uint8_t* region,
+                                                         int64_t capacity) {
+  ARROW_CHECK(capacity > 0 && (capacity & (capacity - 1)) == 0)
+      << "directory capacity " << capacity << " is not a power of two";
+  ARROW_CHECK(reinterpret_cast<uintptr_t>(region) % alignof(Header) == 0);
+  auto header = new (region) Header();
+  header->magic.store(0, std::memory_order_relaxed);
+  header->format = kDirectoryFormat;
+  header->slot_size = sizeof(Slot);
+  header->capacity = capacity;
+  header->max_region_size.store(0, std::memory_order_relaxed);
+  auto slots = reinterpret_cast<Slot*>(region + sizeof(Header));
+  for (int64_t i = 0; i < capacity; ++i) {
+    auto slot = new (&slots[i]) Slot();
+    slot->sequence.store(0, std::memory_order_relaxed);
+    slot->state.store(kSlotEmpty, std::memory_order_relaxed);
+    slot->version.store(0, std::memory_order_relaxed);
+    slot->digest.store(0, std::memory_order_relaxed);
+  }
+  // Readers only trust the directory once the magic number is there.
+  header->magic.store(kDirectoryMagic, std::memory_order_release);
+  return std::unique_ptr<ObjectDirectory>(new ObjectDirectory(header, slots, capacity));
+}
+
+std::unique_ptr<ObjectDirectory> ObjectDirectory::Open(uint8_t* region,
+                                                       int64_t region_size) {
+  if (region_size < static_cast<int64_t>(sizeof(Header))) {
+    return nullptr;
+  }
+  auto header = reinterpret_cast<Header*>(region);
+  if (header->magic.load(std::memory_order_acquire) != kDirectoryMagic ||
+      header->format != kDirectoryFormat || header->slot_size != sizeof(Slot)) {
+    return nullptr;
+  }
+  const int64_t capacity = header->capacity;
+  if (capacity <= 0 || (capacity & (capacity - 1)) != 0 ||
+      RequiredSize(capacity) > region_size) {
+    return nullptr;
+  }
+  auto slots = reinterpret_cast<Slot*>(region + sizeof(Header));
+  return std::unique_ptr<ObjectDirectory>(new ObjectDirectory(header, slots, capacity));
+}
+
+std::unique_ptr<ObjectDirectory> ObjectDirectory::Recover(
+    uint8_t* region, int64_t capacity, std::vector<RecoveredObject>* objects) {
+  auto directory = Open(region, RequiredSize(capacity));
+  if (directory == nullptr || directory->capacity_ != capacity) {
+    return nullptr;
+  }
+  objects->clear();
+  for (int64_t i = 0; i < capacity; ++i) {
+    Slot& slot = directory->slots_[i];
+    directory->last_version_ =
+        std::max(directory->last_version_, slot.version.load(std::memory_order_relaxed));
+    const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+    if (sequence & 1) {
+      // The previous store died while writing the slot. Marking it removed
+      // rather than empty keeps the probe sequences through it intact.
+      slot.state.store(kSlotRemoved, std::memory_order_relaxed);
+      slot.sequence.store(sequence + 1, std::memory_order_release);
+      directory->num_used_slots_ += 1;
+      continue;
+    }
+    const uint32_t state = slot.state.load(std::memory_order_relaxed);
+    if (state != kSlotEmpty) {
+      directory->num_used_slots_ += 1;
+    }
+    if (state != kSlotSealed) {
+      continue;
+    }
+    RecoveredObject recovered;
+    uint64_t words[kIdWords];
+    for (int64_t j = 0; j < kIdWords; ++j) {
+      words[j] = slot.id[j].load(std::memory_order_relaxed);
+    }
+    recovered.object_id = ObjectID::from_binary(
+        std::string(reinterpret_cast<const char*>(words), kUniqueIDSize));
+    recovered.object = {};
+    recovered.object.data_offset = slot.data_offset.load(std::memory_order_relaxed);
+    recovered.object.metadata_offset =
+        slot.metadata_offset.load(std::memory_order_relaxed);
+    recovered.object.data_size = slot.data_size.load(std::memory_order_relaxed);
+    recovered.object.metadata_size = slot.metadata_size.load(std::memory_order_relaxed);
+    recovered.object.device_num = slot.device_num.load(std::memory_order_relaxed);
+    const uint64_t digest = slot.digest.load(std::memory_order_relaxed);
+    std::memcpy(recovered.digest, &digest, kDigestSize);
+    objects->push_back(recovered);
+  }
+  return directory;
+}
+
+int64_t ObjectDirectory::FindSlot(const ObjectID& object_id, uint64_t hash) const {
+  uint64_t words[kIdWords];
+  IdToWords(object_id, words);
+  for (int64_t i = 0; i < max_probe_length_; ++i) {
+    const int64_t index = static_cast<int64_t>((hash + i) & (capacity_ - 1));
+    const uint32_t state = slots_[index].state.load(std::memory_order_relaxed);
+    if (state == kSlotEmpty) {
+      return -1;
+    }
+    if (state == kSlotSealed && slots_[index].HasId(words)) {
+      return index;
+    }
+  }
+  return -1;
+}
+
+bool ObjectDirectory::Publish(const ObjectID& object_id, const PlasmaObject& object,
+                              const unsigned char* digest) {
+  const uint64_t hash = object_id.hash();
+  int64_t index = FindSlot(object_id, hash);
+  if (index == -1) {
+    // The object is not in the directory, so the first free slot along its
+    // probe sequence is as good as any. Only taking an empty slot makes the
+    // directory fuller, a removed one is in the probe sequences already.
+    for (int64_t i = 0; i < max_probe_length_; ++i) {
+      const int64_t candidate = static_cast<int64_t>((hash + i) & (capacity_ - 1));
+      const uint32_t state = slots_[candidate].state.load(std::memory_order_relaxed);
+      if (state == kSlotRemoved) {
+        index = candidate;
+        break;
+      }
+      if (state == kSlotEmpty) {
+        if (num_used_slots_ >= max_used_slots_) {
+          return false;
+        }
+        num_used_slots_ += 1;
+        index = candidate;
+        break;
+      }
+    }
+    if (index == -1) {
+      return false;
+    }
+  }
+  uint64_t words[kIdWords];
+  IdToWords(object_id, words);
+  Slot& slot = slots_[index];
+  slot.BeginWrite();
+  for (int64_t i = 0; i < kIdWords; ++i) {
+    slot.id[i].store(words[i], std::memory_order_relaxed);
+  }
+  slot.data_offset.store(object.data_offset, std::memory_order_relaxed);
+  slot.metadata_offset.store(object.metadata_offset, std::memory_order_relaxed);
+  slot.data_size.store(object.data_size, std::memory_order_relaxed);
+  slot.metadata_size.store(object.metadata_size, std::memory_order_relaxed);
+  slot.device_num.store(object.device_num, std::memory_order_relaxed);
+  uint64_t digest_word = 0;
+  if (digest != nullptr) {
+    std::memcpy(&digest_word, digest, kDigestSize);
+  }
+  slot.digest.store(digest_word, std::memory_order_relaxed);
+  // Versions count across slots, since Remove moves objects between them.
+  slot.version.store(++last_version_, std::memory_order_relaxed);
+  slot.state.store(kSlotSealed, std::memory_order_relaxed);
+  slot.EndWrite();
+  return true;
+}
+
+void ObjectDirectory::Remove(const ObjectID& object_id) {
+  int64_t hole = FindSlot(object_id, object_id.hash());
+  if (hole == -1) {
+    return;
+  }
+  const int64_t mask = capacity_ - 1;
+  // Instead of leaving a removed slot behind, move the objects after it whose
+  // probe sequences pass through it back into it, and then do the same for
+  // the slot they left. The slot left last ends no probe sequence and becomes
+  // empty. A reader that looks for a moved object while this happens may miss
+  // it, and asks the store instead.
+  for (int64_t index = (hole + 1) & mask; index != hole; index = (index + 1) & mask) {
+    Slot& slot = slots_[index];
+    const uint32_t state = slot.state.load(std::memory_order_relaxed);
+    if (state == kSlotEmpty) {
+      break;
+    }
+    if (state != kSlotSealed) {
+      continue;
+    }
+    uint64_t words[kIdWords];
+    for (int64_t i = 0; i < kIdWords; ++i) {
+      words[i] = slot.id[i].load(std::memory_order_relaxed);
+    }
+    // The object may move to the hole if the hole is between its hash and
+    // where it is now.
+    const int64_t home = static_cast<int64_t>(
+        ObjectID::from_binary(std::string(reinterpret_cast<const char*>(words),
+                                          kUniqueIDSize))
+            .hash() &
+        mask);
+    if (((index - home) & mask) < ((hole - home) & mask)) {
+      continue;
+    }
+    Slot& target = slots_[hole];
+    target.BeginWrite();
+    for (int64_t i = 0; i < kIdWords; ++i) {
+      target.id[i].store(words[i], std::memory_order_relaxed);
+    }
+    target.data_offset.store(slot.data_offset.load(std::memory_order_relaxed),
+                             std::memory_order_relaxed);
+    target.metadata_offset.store(slot.metadata_offset.load(std::memory_order_relaxed),
+                                 std::memory_order_relaxed);
+    target.data_size.store(slot.data_size.load(std::memory_order_relaxed),
+                           std::memory_order_relaxed);
+    target.metadata_size.store(slot.metadata_size.load(std::memory_order_relaxed),
+                               std::memory_order_relaxed);
+    target.device_num.store(slot.device_num.load(std::memory_order_relaxed),
+                            std::memory_order_relaxed);
+    target.digest.store(slot.digest.load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+    target.version.store(slot.version.load(std::memory_order_relaxed),
+                         std::memory_order_relaxed);
+    target.state.store(kSlotSealed, std::memory_order_relaxed);
+    target.EndWrite();
+    hole = index;
+  }
+  Slot& slot = slots_[hole];
+  slot.BeginWrite();
+  slot.state.store(kSlotEmpty, std::memory_order_relaxed);
+  slot.EndWrite();
+  num_used_slots_ -= 1;
+}
+
+bool ObjectDirectory::Lookup(const ObjectID& object_id, PlasmaObject* object,
+                             uint64_t* version) const {
+  const uint64_t hash = object_id.hash();
+  uint64_t words[kIdWords];
+  IdToWords(object_id, words);
+  for (int64_t i = 0; i < max_probe_length_; ++i) {
+    const Slot& slot = slots_[(hash + i) & (capacity_ - 1)];
+    for (int attempt = 0;; ++attempt) {
+      if (attempt == kMaxReadAttempts) {
+        return false;
+      }
+      const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+      if (sequence & 1) {
+        continue;
+      }
+      const uint32_t state = slot.state.load(std::memory_order_relaxed);
+      const bool match = state == kSlotSealed && slot.HasId(words);
+      PlasmaObject found;
+      uint64_t found_version = 0;
+      if (match) {
+        found.data_offset = slot.data_offset.load(std::memory_order_relaxed);
+        found.metadata_offset = slot.metadata_offset.load(std::memory_order_relaxed);
+        found.data_size = slot.data_size.load(std::memory_order_relaxed);
+        found.metadata_size = slot.metadata_size.load(std::memory_order_relaxed);
+        found.device_num = slot.device_num.load(std::memory_order_relaxed);
+        found_version = slot.version.load(std::memory_order_relaxed);
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.sequence.load(std::memory_order_relaxed) != sequence) {
+        continue;
+      }
+      if (state == kSlotEmpty) {
+        return false;
+      }
+      if (match) {
+        object->data_offset = found.data_offset;
+        object->metadata_offset = found.metadata_offset;
+        object->data_size = found.data_size;
+        object->metadata_size = found.metadata_size;
+        object->device_num = found.device_num;
+        if (version != nullptr) {
+          *version = found_version;
+        }
+        return true;
+      }
+      break;
+    }
+  }
+  return false;
+}
+
+int64_t ObjectDirectory::Scan(int64_t begin, int64_t max_objects,
+                              std::vector<std::pair<ObjectID, PlasmaObject>>* objects) const {
+  int64_t num_objects = 0;
+  int64_t index = std::max<int64_t>(begin, 0);
+  for (; index < capacity_ && num_objects < max_objects; ++index) {
+    const Slot& slot = slots_[index];
+    const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+    if ((sequence & 1) || slot.state.load(std::memory_order_relaxed) != kSlotSealed) {
+      continue;
+    }
+    uint64_t words[kIdWords];
+    for (int64_t j = 0; j < kIdWords; ++j) {
+      words[j] = slot.id[j].load(std::memory_order_relaxed);
+    }
+    PlasmaObject object = {};
+    object.data_offset = slot.data_offset.load(std::memory_order_relaxed);
+    object.metadata_offset = slot.metadata_offset.load(std::memory_order_relaxed);
+    object.data_size = slot.data_size.load(std::memory_order_relaxed);
+    object.metadata_size = slot.metadata_size.load(std::memory_order_relaxed);
+    object.device_num = slot.device_num.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.sequence.load(std::memory_order_relaxed) != sequence) {
+      continue;
+    }
+    objects->emplace_back(
+        ObjectID::from_binary(
+            std::string(reinterpret_cast<const char*>(words), kUniqueIDSize)),
+        object);
+    num_objects += 1;
+  }
+  return index;
+}
+
+void ObjectDirectory::SetMaxRegionSize(int64_t max_region_size) {
+  header_->max_region_size.store(max_region_size, std::memory_order_release);
+}
+
+int64_t ObjectDirectory::max_region_size() const {
+  return header_->max_region_size.load(std::memory_order_acquire);
+}
+
+}  // namespace plasma
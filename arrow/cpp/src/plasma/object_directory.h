@@ -0,0 +1,162 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/macros.h"
+#include "plasma/common.h"
+#include "plasma/plasma.h"
+
+namespace plasma {
+
+/// A directory of the sealed objects of a store, kept in the header of the
+/// store's shared memory region.
+///
+/// The store is the only writer. Any process that maps the region, such as a
+/// client that called MmapRemoteMemory on the peer's region, can look objects
+/// up without talking to the store. The directory is an open-addressing table
+/// with linear probing and a fixed number of slots. Each slot is guarded by a
+/// sequence lock: the writer makes the sequence odd while it changes the slot,
+/// and readers retry when the sequence was odd or changed while they read.
+///
+/// The directory is best effort. Publish fails when the table is 7/8 full or
+/// no slot is free near the object's hash, and callers are expected to fall
+/// back to asking the store. Lookups read a bounded number of slots, and
+/// Remove moves objects back instead of leaving removed slots behind, so that
+/// missing objects are found missing quickly.
+///
+/// Since the directory lives in the region, it outlives the store. A store
+/// that restarts on the same region can take it over with Recover and keep
+/// serving the objects in it.
+class ARROW_EXPORT ObjectDirectory {
+ public:
+  /// A sealed object that a previous store left in the directory.
+  struct RecoveredObject {
+    ObjectID object_id;
+    PlasmaObject object;
+    unsigned char digest[kDigestSize];
+  };
+
+  /// Number of bytes a directory with the given number of slots occupies.
+  static int64_t RequiredSize(int64_t capacity);
+
+  /// A number of slots suitable for a region of the given size.
+  static int64_t CapacityForRegion(int64_t region_size);
+
+  /// Format an empty directory at the start of a region.
+  ///
+  /// \param region The start of the region, aligned to a cache line.
+  /// \param capacity The number of slots, a power of two.
+  /// \return The directory, which the caller may publish objects to.
+  static std::unique_ptr<ObjectDirectory> Create(uint8_t* region, int64_t capacity);
+
+  /// Attach to a directory another process formatted.
+  ///
+  /// \param region The start of the region.
+  /// \param region_size The size of the mapping of the region.
+  /// \return The directory, or nullptr if the region does not start with one.
+  static std::unique_ptr<ObjectDirectory> Open(uint8_t* region, int64_t region_size);
+
+  /// Take over the directory of a store that stopped or crashed. Slots that
+  /// store was in the middle of changing are dropped, since they may be torn.
+  ///
+  /// \param region The start of the region.
+  /// \param capacity The number of slots the directory must have.
+  /// \param objects Filled with the sealed objects in the directory.
+  /// \return The directory, or nullptr if the region does not start with a
+  ///         directory of this format and capacity.
+  static std::unique_ptr<ObjectDirectory> Recover(uint8_t* region, int64_t capacity,
+                                                  std::vector<RecoveredObject>* objects);
+
+  /// Make a sealed object visible to readers, or update it if it is already.
+  ///
+  /// \param object_id The object ID.
+  /// \param object The location of the object in the region.
+  /// \param digest The kDigestSize bytes of the digest of the object, kept for
+  ///        a store that recovers the directory. May be null.
+  /// \return False if there is no free slot left for the object, in which
+  ///         case readers have to ask the store about it.
+  bool Publish(const ObjectID& object_id, const PlasmaObject& object,
+               const unsigned char* digest = nullptr);
+
+  /// Hide an object from readers. Does nothing if it is not in the directory.
+  void Remove(const ObjectID& object_id);
+
+  /// Look up an object. This neither blocks nor takes locks.
+  ///
+  /// \param object_id The object ID.
+  /// \param object Filled with the location of the object in the region. The
+  ///        store_fd is left untouched.
+  /// \param version Filled with a number that changes each time the object is
+  ///        published, so that readers can tell a recreated object apart.
+  /// \return False if the object is not in the directory.
+  bool Lookup(const ObjectID& object_id, PlasmaObject* object,
+              uint64_t* version = nullptr) const;
+
+  /// Read the sealed objects in the slots from begin on, in slot order, so
+  /// that a listing of the directory can go on where it stopped. Like Lookup,
+  /// this neither blocks nor takes locks, and objects that change while they
+  /// are read are skipped.
+  ///
+  /// \param begin The first slot to read.
+  /// \param max_objects The number of objects after which to stop.
+  /// \param objects Filled with the IDs and locations of the objects.
+  /// \return The slot to go on from, or capacity() if all slots were read.
+  int64_t Scan(int64_t begin, int64_t max_objects,
+               std::vector<std::pair<ObjectID, PlasmaObject>>* objects) const;
+
+  /// Record the size the region may grow to, so that clients map it at that
+  /// size once instead of each time the store grows it.
+  void SetMaxRegionSize(int64_t max_region_size);
+
+  /// The size the region may grow to, or 0 if the store did not say.
+  int64_t max_region_size() const;
+
+  int64_t capacity() const { return capacity_; }
+
+  /// Number of bytes the directory occupies at the start of the region.
+  int64_t size() const { return RequiredSize(capacity_); }
+
+ private:
+  struct Header;
+  struct Slot;
+
+  ObjectDirectory(Header* header, Slot* slots, int64_t capacity);
+
+  /// The slot holding object_id, or -1.
+  int64_t FindSlot(const ObjectID& object_id, uint64_t hash) const;
+
+  Header* header_;
+  Slot* slots_;
+  int64_t capacity_;
+  /// The number of slots a lookup reads at most.
+  int64_t max_probe_length_;
+  /// Only the writer uses these. Used slots are the ones that are not empty.
+  int64_t max_used_slots_;
+  int64_t num_used_slots_;
+  uint64_t last_version_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ObjectDirectory);
+};
+
+}  // namespace plasma
@@ -29,7 +29,8 @@ namespace fb = plasma::flatbuf;
 
 namespace plasma {
 
-ObjectTableEntry::ObjectTableEntry() : pointer(nullptr), ref_count(0) {}
+ObjectTableEntry::ObjectTableEntry()
+    : pointer(nullptr), stream_size(-1), compressed_size(0), ref_count(0), owner(-1) {}
 
 ObjectTableEntry::~ObjectTableEntry() { pointer = nullptr; }
 
@@ -93,7 +94,7 @@ ObjectTableEntry* GetObjectTableEntry(PlasmaStoreInfo* store_info,
   if (it == store_info->objects.end()) {
     return NULL;
   }
-  return it->second.get();
+  return &it->second;
 }
 
 }  // namespace plasma
@@ -38,6 +38,7 @@
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "plasma/common.h"
+#include "plasma/flat_object_table.h"
 
 #ifdef PLASMA_CUDA
 using arrow::cuda::CudaIpcMemHandle;
@@ -87,6 +88,18 @@ struct Client {
   int notification_fd;
 
   std::string name = "anonymous_client";
+
+  /// The NUMA node the client runs on, whose arena its objects are created
+  /// in first. -1 if it is not known.
+  int numa_node = -1;
+
+  /// Whether the client mapped the region of the remote store, so that
+  /// objects it creates can be placed there.
+  bool remote_memory = false;
+
+  /// The share of the store the client gets relative to other clients when
+  /// requests are scheduled.
+  int weight = 1;
 };
 
 // TODO(pcm): Replace this by the flatbuffers message PlasmaObjectSpec.
@@ -131,7 +144,7 @@ enum class ObjectStatus : int {
 /// The plasma store information that is exposed to the eviction policy.
 struct PlasmaStoreInfo {
   /// Objects that are in the Plasma store.
-  ObjectTable objects;
+  FlatObjectTable objects;
 
   /// Boolean flag indicating whether to start the object store with hugepages
   /// support enabled. Huge pages are substantially larger than normal memory
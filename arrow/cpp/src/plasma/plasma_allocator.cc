@@ -17,10 +17,19 @@
 
 #include <arrow/util/logging.h>
 
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
 #include "plasma/malloc.h"
 #include "plasma/plasma_allocator.h"
 #include <sys/mman.h>
 #include <fcntl.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#endif
 
 
 namespace plasma {
@@ -31,52 +40,190 @@ void dlfree(void* mem);
 }
 
 int64_t PlasmaAllocator::footprint_limit_ = 0;
+int64_t PlasmaAllocator::max_footprint_limit_ = 0;
 int64_t PlasmaAllocator::allocated_ = 0;
 void* PlasmaAllocator::base_pointer_ = nullptr;
-std::multimap<size_t, uint64_t> PlasmaAllocator::available_regions_;
+std::vector<PlasmaAllocator::Arena> PlasmaAllocator::arenas_;
+std::unordered_map<int, std::vector<size_t>> PlasmaAllocator::arena_orders_;
 int64_t PlasmaAllocator::fd_ = 0;
 
-void PlasmaAllocator::Init(int64_t fd, void* base_pointer) {
+void PlasmaAllocator::Init(int64_t fd, void* base_pointer, int64_t header_size) {
   fd_ = fd;
   base_pointer_ = base_pointer;
   ARROW_CHECK(base_pointer_);
+  ARROW_CHECK(header_size >= 0 && header_size < footprint_limit_);
+  allocated_ = header_size;
   MmapRecord& record = mmap_records[base_pointer_];
   record.fd = fd_;
-  record.size = footprint_limit_;
-  available_regions_.emplace(footprint_limit_, 0);
+  // Clients map the region at the size it may grow to, so that they do not
+  // have to map it again when it grows.
+  record.size = GetMaxFootprintLimit();
+  // Until the region is split between NUMA nodes, it is a single arena.
+  arenas_.clear();
+  arenas_.emplace_back();
+  Arena& arena = arenas_.back();
+  arena.numa_node = -1;
+  arena.begin = header_size;
+  arena.end = footprint_limit_;
+  arena.allocated = 0;
+  arena.available_regions.emplace(footprint_limit_ - header_size, header_size);
+  ComputeArenaOrders();
   ARROW_LOG(INFO) << "Base ptr at address: " << base_pointer_;
   ARROW_LOG(INFO) << "Available memory: " << footprint_limit_ << "bytes";
 }
 
-void* PlasmaAllocator::Memalign(size_t alignment, size_t bytes, int* fd, int64_t* map_size, ptrdiff_t* offset) {
+void PlasmaAllocator::SetNumaNodes(const std::vector<int>& nodes) {
+  ARROW_CHECK(!nodes.empty());
+  ARROW_CHECK(arenas_.size() == 1 && arenas_[0].allocated == 0);
+  const int64_t page_size = sysconf(_SC_PAGESIZE);
+  const int64_t begin = arenas_[0].begin;
+  const int64_t span = (footprint_limit_ - begin) / static_cast<int64_t>(nodes.size());
+  arenas_.clear();
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    // Arenas after the first start at a page, so that every page but the one
+    // shared with the header belongs to a single node.
+    const int64_t arena_begin =
+        i == 0 ? begin : (begin + static_cast<int64_t>(i) * span) / page_size * page_size;
+    if (!arenas_.empty()) {
+      arenas_.back().end = arena_begin;
+    }
+    arenas_.emplace_back();
+    Arena& arena = arenas_.back();
+    arena.numa_node = nodes[i];
+    arena.begin = arena_begin;
+    arena.end = footprint_limit_;
+    arena.allocated = 0;
+  }
+  for (auto& arena : arenas_) {
+    arena.available_regions.emplace(arena.end - arena.begin, arena.begin);
+    BindToNode(arena, arena.begin, arena.end);
+    ARROW_LOG(INFO) << "Arena of NUMA node " << arena.numa_node << " at offset "
+                    << arena.begin << " with " << arena.end - arena.begin << " bytes";
+  }
+  ComputeArenaOrders();
+}
+
+void PlasmaAllocator::ComputeArenaOrders() {
+  // The arena of the node comes first, then the others in order.
+  arena_orders_.clear();
+  std::vector<size_t>& any_node = arena_orders_[-1];
+  for (size_t i = 0; i < arenas_.size(); ++i) {
+    any_node.push_back(i);
+  }
+  for (size_t i = 0; i < arenas_.size(); ++i) {
+    const int numa_node = arenas_[i].numa_node;
+    if (numa_node == -1 || arena_orders_.count(numa_node) > 0) {
+      continue;
+    }
+    std::vector<size_t>& order = arena_orders_[numa_node];
+    order.push_back(i);
+    for (size_t j = 0; j < arenas_.size(); ++j) {
+      if (j != i) {
+        order.push_back(j);
+      }
+    }
+  }
+}
+
+void PlasmaAllocator::BindToNode(const Arena& arena, int64_t begin, int64_t end) {
+#ifdef __linux__
+  // A preferred rather than a strict binding, so that a full node does not
+  // turn into SIGBUS for the processes that touch the arena.
+  const int64_t page_size = sysconf(_SC_PAGESIZE);
+  const int64_t bind_begin = (begin + page_size - 1) / page_size * page_size;
+  if (end > bind_begin && arena.numa_node >= 0 && arena.numa_node < 64) {
+    unsigned long mask = 1UL << arena.numa_node;
+    if (syscall(SYS_mbind, static_cast<uint8_t*>(base_pointer_) + bind_begin,
+                end - bind_begin, MPOL_PREFERRED, &mask, sizeof(mask) * 8 + 1,
+                MPOL_MF_MOVE) != 0) {
+      ARROW_LOG(WARNING) << "could not place the arena of NUMA node " << arena.numa_node
+                         << " on its node: " << std::strerror(errno);
+    }
+  }
+#endif
+}
+
+void PlasmaAllocator::Reserve(std::vector<std::pair<int64_t, int64_t>> allocations) {
+  for (auto& arena : arenas_) {
+    ARROW_CHECK(arena.allocated == 0 && arena.available_regions.size() == 1);
+    arena.available_regions.clear();
+  }
+  // A free piece that spans arenas goes to each of them in parts.
+  auto add_free = [](int64_t begin, int64_t end) {
+    for (auto& arena : arenas_) {
+      const int64_t piece_begin = std::max(begin, arena.begin);
+      const int64_t piece_end = std::min(end, arena.end);
+      if (piece_end > piece_begin) {
+        arena.available_regions.emplace(piece_end - piece_begin, piece_begin);
+      }
+    }
+  };
+  int64_t begin = arenas_.front().begin;
+  std::sort(allocations.begin(), allocations.end());
+  for (const auto& allocation : allocations) {
+    ARROW_CHECK(allocation.first >= begin &&
+                allocation.first + allocation.second <= footprint_limit_);
+    add_free(begin, allocation.first);
+    begin = allocation.first + allocation.second;
+    ArenaOf(allocation.first)->allocated += allocation.second;
+    allocated_ += allocation.second;
+  }
+  add_free(begin, footprint_limit_);
+}
+
+void* PlasmaAllocator::Memalign(size_t alignment, size_t bytes, int* fd, int64_t* map_size,
+                                ptrdiff_t* offset, int numa_node) {
   if (allocated_ + static_cast<int64_t>(bytes) > footprint_limit_) {
     return nullptr;
   }
-  *offset = FindRegion(bytes);
+  auto order = arena_orders_.find(numa_node);
+  if (order == arena_orders_.end()) {
+    order = arena_orders_.find(-1);
+  }
+  Arena* arena = nullptr;
+  *offset = -1;
+  for (size_t index : order->second) {
+    *offset = FindRegion(&arenas_[index], bytes);
+    if (*offset != -1) {
+      arena = &arenas_[index];
+      break;
+    }
+  }
   if (*offset == -1) {
     return nullptr;
   }
   ARROW_LOG(DEBUG) << "Allocating " << bytes << " bytes of memory at " << *offset;
   *map_size = bytes;
   *fd = fd_;
+  arena->allocated += bytes;
   allocated_ += bytes;
   return base_pointer_;
 }
 
-int64_t PlasmaAllocator::FindRegion(size_t bytes) {
+int64_t PlasmaAllocator::FindRegion(Arena* arena, size_t bytes) {
   int64_t offset = -1;
-  auto it = available_regions_.lower_bound(bytes);
-  if (it == available_regions_.end()) {
+  auto it = arena->available_regions.lower_bound(bytes);
+  if (it == arena->available_regions.end()) {
     return -1;
   }
   offset = it->second;
   if (it->first > bytes) {
-    available_regions_.emplace(it->first - bytes, offset + bytes);
+    arena->available_regions.emplace(it->first - bytes, offset + bytes);
   }
-  available_regions_.erase(it);
+  arena->available_regions.erase(it);
   return offset;
 }
 
+PlasmaAllocator::Arena* PlasmaAllocator::ArenaOf(int64_t offset) {
+  Arena* arena = &arenas_.front();
+  for (auto& candidate : arenas_) {
+    if (candidate.begin <= offset) {
+      arena = &candidate;
+    }
+  }
+  return arena;
+}
+
 void PlasmaAllocator::Free(void* mem, size_t bytes) {
   int64_t begin, end, offset, regOffset;
   size_t size, regSize;
@@ -85,19 +232,24 @@ void PlasmaAllocator::Free(void* mem, size_t bytes) {
   offset = begin;
   size = bytes;
   ARROW_LOG(DEBUG) << "Freeing " << bytes << " bytes of memory at " << mem << ", offset:" << offset;
-  for (auto it = available_regions_.begin(); it != available_regions_.end(); it++) {
+  Arena* arena = ArenaOf(begin);
+  auto& available_regions = arena->available_regions;
+  for (auto it = available_regions.begin(); it != available_regions.end();) {
     regSize = it->first;
     regOffset = it->second;
     if (regOffset == end) {
       size += regSize;
-      available_regions_.erase(it);
-    } else if (regOffset + static_cast<int>(regSize) == begin) {
+      it = available_regions.erase(it);
+    } else if (regOffset + static_cast<int64_t>(regSize) == begin) {
       offset = regOffset;
       size += regSize;
-      available_regions_.erase(it);
+      it = available_regions.erase(it);
+    } else {
+      ++it;
     }
   }
-  available_regions_.emplace(size, offset);
+  available_regions.emplace(size, offset);
+  arena->allocated -= bytes;
   allocated_ -= bytes;
 }
 
@@ -107,6 +259,54 @@ void PlasmaAllocator::SetFootprintLimit(size_t bytes) {
 
 int64_t PlasmaAllocator::GetFootprintLimit() { return footprint_limit_; }
 
+void PlasmaAllocator::SetMaxFootprintLimit(size_t bytes) {
+  max_footprint_limit_ = static_cast<int64_t>(bytes);
+}
+
+int64_t PlasmaAllocator::GetMaxFootprintLimit() {
+  return std::max(max_footprint_limit_, footprint_limit_);
+}
+
+void PlasmaAllocator::Grow(int64_t bytes) {
+  ARROW_CHECK(bytes >= footprint_limit_ && bytes <= GetMaxFootprintLimit());
+  if (bytes == footprint_limit_) {
+    return;
+  }
+  // The new memory extends the last arena, merged with a free piece at its end.
+  Arena& arena = arenas_.back();
+  int64_t begin = footprint_limit_;
+  for (auto it = arena.available_regions.begin(); it != arena.available_regions.end();
+       ++it) {
+    if (static_cast<int64_t>(it->second + it->first) == footprint_limit_) {
+      begin = it->second;
+      arena.available_regions.erase(it);
+      break;
+    }
+  }
+  arena.available_regions.emplace(bytes - begin, begin);
+  BindToNode(arena, footprint_limit_, bytes);
+  arena.end = bytes;
+  ARROW_LOG(INFO) << "Grew the region from " << footprint_limit_ << " to " << bytes
+                  << " bytes";
+  footprint_limit_ = bytes;
+}
+
+void* PlasmaAllocator::GetBasePointer() { return base_pointer_; }
+
+int PlasmaAllocator::GetFd() { return static_cast<int>(fd_); }
+
 int64_t PlasmaAllocator::Allocated() { return allocated_; }
 
+std::vector<PlasmaAllocator::ArenaInfo> PlasmaAllocator::GetArenas() {
+  std::vector<ArenaInfo> arenas;
+  for (const auto& arena : arenas_) {
+    arenas.push_back({arena.numa_node, arena.end - arena.begin, arena.allocated});
+  }
+  return arenas;
+}
+
+int PlasmaAllocator::GetNumaNode(ptrdiff_t offset) {
+  return ArenaOf(offset)->numa_node;
+}
+
 }  // namespace plasma
@@ -21,22 +21,64 @@
 #include <cstddef>
 #include <cstdint>
 #include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace plasma {
 
 class PlasmaAllocator {
  public:
-  static void Init(int64_t fd, void* base_pointer);
+  /// The part of the region that is bound to one NUMA node.
+  struct ArenaInfo {
+    /// The NUMA node, or -1 if the region is not split between nodes.
+    int numa_node;
+    /// Number of bytes in the arena.
+    int64_t size;
+    /// Number of bytes allocated in the arena.
+    int64_t allocated;
+  };
+
+  /// Hand the allocator the shared memory region it allocates from.
+  ///
+  /// \param fd File descriptor of the region.
+  /// \param base_pointer Start of the mapping of the region.
+  /// \param header_size Number of bytes at the start of the region that are
+  ///        reserved for the object directory. They count as allocated, so
+  ///        that the eviction policy sees the real amount of free memory.
+  static void Init(int64_t fd, void* base_pointer, int64_t header_size = 0);
+
+  /// Split the memory after the header into one arena per NUMA node, and ask
+  /// the kernel to place the pages of each arena on its node. Must be called
+  /// right after Init.
+  ///
+  /// \param nodes The NUMA nodes, in the order of their arenas in the region.
+  static void SetNumaNodes(const std::vector<int>& nodes);
+
+  /// Mark memory that a previous store left objects in as allocated, so that
+  /// a recovering store can keep them. Must be called after Init and
+  /// SetNumaNodes, before anything is allocated.
+  ///
+  /// \param allocations The offset and size of each piece of memory. They
+  ///        must not overlap each other or the header.
+  static void Reserve(std::vector<std::pair<int64_t, int64_t>> allocations);
+
+  /// Get the start of the mapping of the region.
+  static void* GetBasePointer();
+
+  /// Get the file descriptor of the region.
+  static int GetFd();
 
-  static int64_t FindRegion(size_t bytes);
-  
   /// Allocates size bytes and returns a pointer to the allocated memory. The
   /// memory address will be a multiple of alignment, which must be a power of two.
   ///
   /// \param alignment Memory alignment.
   /// \param bytes Number of bytes.
+  /// \param numa_node The NUMA node to allocate on if there is room, or -1.
+  ///        Other nodes are tried next.
   /// \return Pointer to allocated memory.
-  static void* Memalign(size_t alignment, size_t bytes, int* fd, int64_t* map_size, ptrdiff_t* offset);
+  static void* Memalign(size_t alignment, size_t bytes, int* fd, int64_t* map_size,
+                        ptrdiff_t* offset, int numa_node = -1);
 
   /// Frees the memory space pointed to by mem, which must have been returned by
   /// a previous call to Memalign()
@@ -55,15 +97,67 @@ class PlasmaAllocator {
   /// \return Plasma memory footprint limit in bytes.
   static int64_t GetFootprintLimit();
 
+  /// Sets the size the region may grow to at runtime. The region is mapped at
+  /// this size from the start, so that growing it does not move it. Must be
+  /// called before Init.
+  ///
+  /// \param bytes The largest footprint limit, at least the current one.
+  static void SetMaxFootprintLimit(size_t bytes);
+
+  /// Get the size the region may grow to, which is the size of its mapping.
+  static int64_t GetMaxFootprintLimit();
+
+  /// Raise the footprint limit. The memory between the old and the new limit
+  /// becomes free memory of the last arena. The caller makes sure that the
+  /// file of the region is large enough.
+  ///
+  /// \param bytes The new footprint limit, at most the largest one.
+  static void Grow(int64_t bytes);
+
   /// Get the number of bytes allocated by Plasma so far.
   /// \return Number of bytes allocated by Plasma so far.
   static int64_t Allocated();
 
+  /// Get the arenas of the region, one per NUMA node.
+  static std::vector<ArenaInfo> GetArenas();
+
+  /// Get the NUMA node of the memory at an offset in the region, or -1 if
+  /// the region is not split between nodes.
+  static int GetNumaNode(ptrdiff_t offset);
+
  private:
+  struct Arena {
+    int numa_node;
+    int64_t begin;
+    int64_t end;
+    int64_t allocated;
+    /// The free pieces of the arena, as size and offset.
+    std::multimap<uint64_t, size_t> available_regions;
+  };
+
+  /// Take bytes from the smallest free piece of an arena that is large enough.
+  ///
+  /// \return The offset of the memory, or -1.
+  static int64_t FindRegion(Arena* arena, size_t bytes);
+
+  /// The arena that memory starting at offset belongs to.
+  static Arena* ArenaOf(int64_t offset);
+
+  /// Ask the kernel to place the pages of part of an arena on its node.
+  static void BindToNode(const Arena& arena, int64_t begin, int64_t end);
+
+  /// Fill arena_orders_ for the current arenas.
+  static void ComputeArenaOrders();
+
   static int64_t allocated_;
   static int64_t footprint_limit_;
+  static int64_t max_footprint_limit_;
   static void* base_pointer_;
-  static std::multimap<uint64_t, size_t> available_regions_;
+  static std::vector<Arena> arenas_;
+  /// The indices of the arenas in the order Memalign tries them, by NUMA node.
+  /// Allocations for node -1, or for a node without an arena, use the order
+  /// of node -1.
+  static std::unordered_map<int, std::vector<size_t>> arena_orders_;
   static int64_t fd_;
 };
 
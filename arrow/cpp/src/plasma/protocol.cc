@@ -17,6 +17,7 @@
 
 #include "plasma/protocol.h"
 
+#include <cstring>
 #include <utility>
 
 #include "flatbuffers/flatbuffers.h"
@@ -42,12 +43,29 @@ using flatbuffers::uoffset_t;
 #define PLASMA_CHECK_ENUM(x, y) \
   static_assert(static_cast<int>(x) == static_cast<int>(y), "protocol mismatch")
 
+// Object IDs are converted from and to their bytes directly, since going
+// through binary() allocates a string for every ID.
+
+flatbuffers::Offset<flatbuffers::String> ToFlatbuffer(flatbuffers::FlatBufferBuilder* fbb,
+                                                      const ObjectID& object_id) {
+  return fbb->CreateString(reinterpret_cast<const char*>(object_id.data()),
+                           kUniqueIDSize);
+}
+
+ObjectID FromFlatbuffer(const flatbuffers::String* string) {
+  DCHECK(string->size() == kUniqueIDSize);
+  ObjectID object_id;
+  std::memcpy(object_id.mutable_data(), string->data(), kUniqueIDSize);
+  return object_id;
+}
+
 flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>>
 ToFlatbuffer(flatbuffers::FlatBufferBuilder* fbb, const ObjectID* object_ids,
              int64_t num_objects) {
-  std::vector<flatbuffers::Offset<flatbuffers::String>> results;
+  static thread_local std::vector<flatbuffers::Offset<flatbuffers::String>> results;
+  results.clear();
   for (int64_t i = 0; i < num_objects; i++) {
-    results.push_back(fbb->CreateString(object_ids[i].binary()));
+    results.push_back(ToFlatbuffer(fbb, object_ids[i]));
   }
   return fbb->CreateVector(arrow::util::MakeNonNull(results.data()), results.size());
 }
@@ -99,11 +117,27 @@ void ConvertToVector(const FlatbufferVectorPointer fbvector, std::vector<T>* out
   }
 }
 
+/// Messages larger than this do not keep their memory in the message builder.
+constexpr uoffset_t kMaxRetainedMessageSize = 1 << 20;
+
+/// Returns the builder of the messages sent by this thread, cleared. Reusing it
+/// keeps its memory, so that sending a message does not allocate once the
+/// builder has grown to the size of the messages.
+flatbuffers::FlatBufferBuilder& MessageBuilder() {
+  static thread_local flatbuffers::FlatBufferBuilder fbb;
+  fbb.Clear();
+  return fbb;
+}
+
 template <typename Message>
 Status PlasmaSend(int sock, MessageType message_type, flatbuffers::FlatBufferBuilder* fbb,
                   const Message& message) {
   fbb->Finish(message);
-  return WriteMessage(sock, message_type, fbb->GetSize(), fbb->GetBufferPointer());
+  Status s = WriteMessage(sock, message_type, fbb->GetSize(), fbb->GetBufferPointer());
+  if (fbb->GetSize() > kMaxRetainedMessageSize) {
+    fbb->Reset();
+  }
+  return s;
 }
 
 Status PlasmaErrorStatus(fb::PlasmaError plasma_error) {
@@ -119,6 +153,10 @@ Status PlasmaErrorStatus(fb::PlasmaError plasma_error) {
     case fb::PlasmaError::OutOfMemory:
       return MakePlasmaError(PlasmaErrorCode::PlasmaStoreFull,
                              "object does not fit in the plasma store");
+    case fb::PlasmaError::ObjectNotSealed:
+      return Status::Invalid("object is not sealed");
+    case fb::PlasmaError::InvalidView:
+      return Status::Invalid("view does not fit in the data of its parent");
     default:
       ARROW_LOG(FATAL) << "unknown plasma error code " << static_cast<int>(plasma_error);
   }
@@ -128,25 +166,26 @@ Status PlasmaErrorStatus(fb::PlasmaError plasma_error) {
 // Set options messages.
 
 Status SendSetOptionsRequest(int sock, const std::string& client_name,
-                             int64_t output_memory_limit) {
-  flatbuffers::FlatBufferBuilder fbb;
+                             int64_t output_memory_limit, int weight) {
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
   auto message = fb::CreatePlasmaSetOptionsRequest(fbb, fbb.CreateString(client_name),
-                                                   output_memory_limit);
+                                                   output_memory_limit, weight);
   return PlasmaSend(sock, MessageType::PlasmaSetOptionsRequest, &fbb, message);
 }
 
 Status ReadSetOptionsRequest(const uint8_t* data, size_t size, std::string* client_name,
-                             int64_t* output_memory_quota) {
+                             int64_t* output_memory_quota, int* weight) {
   DCHECK(data);
   auto message = flatbuffers::GetRoot<fb::PlasmaSetOptionsRequest>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
   *client_name = std::string(message->client_name()->str());
   *output_memory_quota = message->output_memory_quota();
+  *weight = message->weight();
   return Status::OK();
 }
 
 Status SendSetOptionsReply(int sock, PlasmaError error) {
-  flatbuffers::FlatBufferBuilder fbb;
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
   auto message = fb::CreatePlasmaSetOptionsReply(fbb, error);
   return PlasmaSend(sock, MessageType::PlasmaSetOptionsReply, &fbb, message);
 }
@@ -161,13 +200,13 @@ Status ReadSetOptionsReply(const uint8_t* data, size_t size) {
 // Get debug string messages.
 
 Status SendGetDebugStringRequest(int sock) {
-  flatbuffers::FlatBufferBuilder fbb;
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
   auto message = fb::CreatePlasmaGetDebugStringRequest(fbb);
   return PlasmaSend(sock, MessageType::PlasmaGetDebugStringRequest, &fbb, message);
 }
 
 Status SendGetDebugStringReply(int sock, const std::string& debug_string) {
-  flatbuffers::FlatBufferBuilder fbb;
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
   auto message = fb::CreatePlasmaGetDebugStringReply(fbb, fbb.CreateString(debug_string));
   return PlasmaSend(sock, MessageType::PlasmaGetDebugStringReply, &fbb, message);
 }
@@ -184,35 +223,39 @@ Status ReadGetDebugStringReply(const uint8_t* data, size_t size,
 // Create messages.
 
 Status SendCreateRequest(int sock, ObjectID object_id, bool evict_if_full,
-                         int64_t data_size, int64_t metadata_size, int device_num) {
-  flatbuffers::FlatBufferBuilder fbb;
-  auto message =
-      fb::CreatePlasmaCreateRequest(fbb, fbb.CreateString(object_id.binary()),
-                                    evict_if_full, data_size, metadata_size, device_num);
+                         int64_t data_size, int64_t metadata_size, int device_num,
+                         uint64_t request_id) {
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
+  auto message = fb::CreatePlasmaCreateRequest(fbb, ToFlatbuffer(&fbb, object_id),
+                                               evict_if_full, data_size, metadata_size,
+                                               device_num, request_id);
   return PlasmaSend(sock, MessageType::PlasmaCreateRequest, &fbb, message);
 }
 
 Status ReadCreateRequest(const uint8_t* data, size_t size, ObjectID* object_id,
                          bool* evict_if_full, int64_t* data_size, int64_t* metadata_size,
-                         int* device_num) {
+                         int* device_num, uint64_t* request_id) {
   DCHECK(data);
   auto message = flatbuffers::GetRoot<fb::PlasmaCreateRequest>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
   *evict_if_full = message->evict_if_full();
   *data_size = message->data_size();
   *metadata_size = message->metadata_size();
-  *object_id = ObjectID::from_binary(message->object_id()->str());
+  *object_id = FromFlatbuffer(message->object_id());
   *device_num = message->device_num();
+  if (request_id != nullptr) {
+    *request_id = message->request_id();
+  }
   return Status::OK();
 }
 
 Status SendCreateReply(int sock, ObjectID object_id, PlasmaObject* object,
-                       PlasmaError error_code, int64_t mmap_size) {
-  flatbuffers::FlatBufferBuilder fbb;
+                       PlasmaError error_code, int64_t mmap_size, uint64_t request_id) {
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
   PlasmaObjectSpec plasma_object(object->store_fd, object->data_offset, object->data_size,
                                  object->metadata_offset, object->metadata_size,
                                  object->device_num);
-  auto object_string = fbb.CreateString(object_id.binary());
+  auto object_string = ToFlatbuffer(&fbb, object_id);
 #ifdef PLASMA_CUDA
   flatbuffers::Offset<fb::CudaHandle> ipc_handle;
   if (object->device_num != 0) {
@@ -228,6 +271,7 @@ Status SendCreateReply(int sock, ObjectID object_id, PlasmaObject* object,
   crb.add_object_id(object_string);
   crb.add_store_fd(object->store_fd);
   crb.add_mmap_size(mmap_size);
+  crb.add_request_id(request_id);
   if (object->device_num != 0) {
 #ifdef PLASMA_CUDA
     crb.add_ipc_handle(ipc_handle);
@@ -240,11 +284,12 @@ Status SendCreateReply(int sock, ObjectID object_id, PlasmaObject* object,
 }
 
 Status ReadCreateReply(const uint8_t* data, size_t size, ObjectID* object_id,
-                       PlasmaObject* object, int* store_fd, int64_t* mmap_size) {
+                       PlasmaObject* object, int* store_fd, int64_t* mmap_size,
+                       uint64_t* request_id) {
   DCHECK(data);
   auto message = flatbuffers::GetRoot<fb::PlasmaCreateReply>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
-  *object_id = ObjectID::from_binary(message->object_id()->str());
+  *object_id = FromFlatbuffer(message->object_id());
   object->store_fd = message->plasma_object()->segment_index();
   object->data_offset = message->plasma_object()->data_offset();
   object->data_size = message->plasma_object()->data_size();
@@ -253,6 +298,9 @@ Status ReadCreateReply(const uint8_t* data, size_t size, ObjectID* object_id,
 
   *store_fd = message->store_fd();
   *mmap_size = message->mmap_size();
+  if (request_id != nullptr) {
+    *request_id = message->request_id();
+  }
 
   object->device_num = message->plasma_object()->device_num();
 #ifdef PLASMA_CUDA
@@ -268,10 +316,10 @@ Status ReadCreateReply(const uint8_t* data, size_t size, ObjectID* object_id,
 Status SendCreateAndSealRequest(int sock, const ObjectID& object_id, bool evict_if_full,
                                 const std::string& data, const std::string& metadata,
                                 unsigned char* digest) {
-  flatbuffers::FlatBufferBuilder fbb;
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
   auto digest_string = fbb.CreateString(reinterpret_cast<char*>(digest), kDigestSize);
   auto message = fb::CreatePlasmaCreateAndSealRequest(
-      fbb, fbb.CreateString(object_id.binary()), evict_if_full, fbb.CreateString(data),
+      fbb, ToFlatbuffer(&fbb, object_id), evict_if_full, fbb.CreateString(data),
       fbb.CreateString(metadata), digest_string);
   return PlasmaSend(sock, MessageType::PlasmaCreateAndSealRequest, &fbb, message);
 }
@@ -283,7 +331,7 @@ Status ReadCreateAndSealRequest(const uint8_t* data, size_t size, ObjectID* obje
   auto message = flatbuffers::GetRoot<fb::PlasmaCreateAndSealRequest>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
 
-  *object_id = ObjectID::from_binary(message->object_id()->str());
+  *object_id = FromFlatbuffer(message->object_id());
   *evict_if_full = message->evict_if_full();
   *object_data = message->data()->str();
   *metadata = message->metadata()->str();
@@ -297,7 +345,7 @@ Status SendCreateAndSealBatchRequest(int sock, const std::vector<ObjectID>& obje
                                      const std::vector<std::string>& data,
                                      const std::vector<std::string>& metadata,
                                      const std::vector<std::string>& digests) {
-  flatbuffers::FlatBufferBuilder fbb;
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
 
   auto message = fb::CreatePlasmaCreateAndSealBatchRequest(
       fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()), evict_if_full,
@@ -320,7 +368,7 @@ Status ReadCreateAndSealBatchRequest(const uint8_t* data, size_t size,
   *evict_if_full = message->evict_if_full();
   ConvertToVector(message->object_ids(), object_ids,
                   [](const flatbuffers::String& element) {
-                    return ObjectID::from_binary(element.str());
+                    return FromFlatbuffer(&element);
                   });
 
   ConvertToVector(message->data(), object_data,
@@ -336,7 +384,7 @@ Status ReadCreateAndSealBatchRequest(const uint8_t* data, size_t size,
 }
 
 Status SendCreateAndSealReply(int sock, PlasmaError error) {
-  flatbuffers::FlatBufferBuilder fbb;
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
   auto message = fb::CreatePlasmaCreateAndSealReply(fbb, static_cast<PlasmaError>(error));
   return PlasmaSend(sock, MessageType::PlasmaCreateAndSealReply, &fbb, message);
 }
@@ -349,7 +397,7 @@ Status ReadCreateAndSealReply(const uint8_t* data, size_t size) {
 }
 
 Status SendCreateAndSealBatchReply(int sock, PlasmaError error) {
-  flatbuffers::FlatBufferBuilder fbb;
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
   auto message =
       fb::CreatePlasmaCreateAndSealBatchReply(fbb, static_cast<PlasmaError>(error));
   return PlasmaSend(sock, MessageType::PlasmaCreateAndSealBatchReply, &fbb, message);
@@ -362,9 +410,43 @@ Status ReadCreateAndSealBatchReply(const uint8_t* data, size_t size) {
   return PlasmaErrorStatus(message->error());
 }
 
+Status SendCreateViewRequest(int sock, const ObjectID& parent_id, int64_t offset,
+                             int64_t length, const ObjectID& object_id) {
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
+  auto message = fb::CreatePlasmaCreateViewRequest(
+      fbb, ToFlatbuffer(&fbb, parent_id), offset, length,
+      ToFlatbuffer(&fbb, object_id));
+  return PlasmaSend(sock, MessageType::PlasmaCreateViewRequest, &fbb, message);
+}
+
+Status ReadCreateViewRequest(const uint8_t* data, size_t size, ObjectID* parent_id,
+                             int64_t* offset, int64_t* length, ObjectID* object_id) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaCreateViewRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  *parent_id = FromFlatbuffer(message->parent_id());
+  *offset = message->offset();
+  *length = message->length();
+  *object_id = FromFlatbuffer(message->object_id());
+  return Status::OK();
+}
+
+Status SendCreateViewReply(int sock, PlasmaError error) {
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
+  auto message = fb::CreatePlasmaCreateViewReply(fbb, error);
+  return PlasmaSend(sock, MessageType::PlasmaCreateViewReply, &fbb, message);
+}
+
+Status ReadCreateViewReply(const uint8_t* data, size_t size) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaCreateViewReply>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  return PlasmaErrorStatus(message->error());
+}
+
 Status SendAbortRequest(int sock, ObjectID object_id) {
-  flatbuffers::FlatBufferBuilder fbb;
-  auto message = fb::CreatePlasmaAbortRequest(fbb, fbb.CreateString(object_id.binary()));
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
+  auto message = fb::CreatePlasmaAbortRequest(fbb, ToFlatbuffer(&fbb, object_id));
   return PlasmaSend(sock, MessageType::PlasmaAbortRequest, &fbb, message);
 }
 
@@ -372,13 +454,13 @@ Status ReadAbortRequest(const uint8_t* data, size_t size, ObjectID* object_id) {
   DCHECK(data);
   auto message = flatbuffers::GetRoot<fb::PlasmaAbortRequest>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
-  *object_id = ObjectID::from_binary(message->object_id()->str());
+  *object_id = FromFlatbuffer(message->object_id());
   return Status::OK();
 }
 
 Status SendAbortReply(int sock, ObjectID object_id) {
-  flatbuffers::FlatBufferBuilder fbb;
-  auto message = fb::CreatePlasmaAbortReply(fbb, fbb.CreateString(object_id.binary()));
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
+  auto message = fb::CreatePlasmaAbortReply(fbb, ToFlatbuffer(&fbb, object_id));
   return PlasmaSend(sock, MessageType::PlasmaAbortReply, &fbb, message);
 }
 
@@ -386,51 +468,60 @@ Status ReadAbortReply(const uint8_t* data, size_t size, ObjectID* object_id) {
   DCHECK(data);
   auto message = flatbuffers::GetRoot<fb::PlasmaAbortReply>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
-  *object_id = ObjectID::from_binary(message->object_id()->str());
+  *object_id = FromFlatbuffer(message->object_id());
   return Status::OK();
 }
 
 // Seal messages.
 
-Status SendSealRequest(int sock, ObjectID object_id, const std::string& digest) {
-  flatbuffers::FlatBufferBuilder fbb;
-  auto message = fb::CreatePlasmaSealRequest(fbb, fbb.CreateString(object_id.binary()),
-                                             fbb.CreateString(digest));
+Status SendSealRequest(int sock, ObjectID object_id, const std::string& digest,
+                       uint64_t request_id) {
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
+  auto message = fb::CreatePlasmaSealRequest(fbb, ToFlatbuffer(&fbb, object_id),
+                                             fbb.CreateString(digest), request_id);
   return PlasmaSend(sock, MessageType::PlasmaSealRequest, &fbb, message);
 }
 
 Status ReadSealRequest(const uint8_t* data, size_t size, ObjectID* object_id,
-                       std::string* digest) {
+                       std::string* digest, uint64_t* request_id) {
   DCHECK(data);
   auto message = flatbuffers::GetRoot<fb::PlasmaSealRequest>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
-  *object_id = ObjectID::from_binary(message->object_id()->str());
+  *object_id = FromFlatbuffer(message->object_id());
   ARROW_CHECK_EQ(message->digest()->size(), kDigestSize);
   digest->assign(message->digest()->data(), kDigestSize);
+  if (request_id != nullptr) {
+    *request_id = message->request_id();
+  }
   return Status::OK();
 }
 
-Status SendSealReply(int sock, ObjectID object_id, PlasmaError error) {
-  flatbuffers::FlatBufferBuilder fbb;
-  auto message =
-      fb::CreatePlasmaSealReply(fbb, fbb.CreateString(object_id.binary()), error);
+Status SendSealReply(int sock, ObjectID object_id, PlasmaError error,
+                     uint64_t request_id) {
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
+  auto message = fb::CreatePlasmaSealReply(fbb, ToFlatbuffer(&fbb, object_id),
+                                           error, request_id);
   return PlasmaSend(sock, MessageType::PlasmaSealReply, &fbb, message);
 }
 
-Status ReadSealReply(const uint8_t* data, size_t size, ObjectID* object_id) {
+Status ReadSealReply(const uint8_t* data, size_t size, ObjectID* object_id,
+                     uint64_t* request_id) {
   DCHECK(data);
   auto message = flatbuffers::GetRoot<fb::PlasmaSealReply>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
-  *object_id = ObjectID::from_binary(message->object_id()->str());
+  *object_id = FromFlatbuffer(message->object_id());
+  if (request_id != nullptr) {
+    *request_id = message->request_id();
+  }
   return PlasmaErrorStatus(message->error());
 }
 
 // Release messages.
 
 Status SendReleaseRequest(int sock, ObjectID object_id) {
-  flatbuffers::FlatBufferBuilder fbb;
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
   auto message =
-      fb::CreatePlasmaReleaseRequest(fbb, fbb.CreateString(object_id.binary()));
+      fb::CreatePlasmaReleaseRequest(fbb, ToFlatbuffer(&fbb, object_id));
   return PlasmaSend(sock, MessageType::PlasmaReleaseRequest, &fbb, message);
 }
 
@@ -438,14 +529,14 @@ Status ReadReleaseRequest(const uint8_t* data, size_t size, ObjectID* object_id)
   DCHECK(data);
   auto message = flatbuffers::GetRoot<fb::PlasmaReleaseRequest>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
-  *object_id = ObjectID::from_binary(message->object_id()->str());
+  *object_id = FromFlatbuffer(message->object_id());
   return Status::OK();
 }
 
 Status SendReleaseReply(int sock, ObjectID object_id, PlasmaError error) {
-  flatbuffers::FlatBufferBuilder fbb;
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
   auto message =
-      fb::CreatePlasmaReleaseReply(fbb, fbb.CreateString(object_id.binary()), error);
+      fb::CreatePlasmaReleaseReply(fbb, ToFlatbuffer(&fbb, object_id), error);
   return PlasmaSend(sock, MessageType::PlasmaReleaseReply, &fbb, message);
 }
 
@@ -453,14 +544,14 @@ Status ReadReleaseReply(const uint8_t* data, size_t size, ObjectID* object_id) {
   DCHECK(data);
   auto message = flatbuffers::GetRoot<fb::PlasmaReleaseReply>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
-  *object_id = ObjectID::from_binary(message->object_id()->str());
+  *object_id = FromFlatbuffer(message->object_id());
   return PlasmaErrorStatus(message->error());
 }
 
 // Delete objects messages.
 
 Status SendDeleteRequest(int sock, const std::vector<ObjectID>& object_ids) {
-  flatbuffers::FlatBufferBuilder fbb;
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
   auto message = fb::CreatePlasmaDeleteRequest(
       fbb, static_cast<int32_t>(object_ids.size()),
       ToFlatbuffer(&fbb, &object_ids[0], object_ids.size()));
@@ -476,7 +567,7 @@ Status ReadDeleteRequest(const uint8_t* data, size_t size,
   auto message = flatbuffers::GetRoot<PlasmaDeleteRequest>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
   ToVector(*message, object_ids, [](const PlasmaDeleteRequest& request, int i) {
-    return ObjectID::from_binary(request.object_ids()->Get(i)->str());
+    return FromFlatbuffer(request.object_ids()->Get(i));
   });
   return Status::OK();
 }
@@ -484,7 +575,7 @@ Status ReadDeleteRequest(const uint8_t* data, size_t size,
 Status SendDeleteReply(int sock, const std::vector<ObjectID>& object_ids,
                        const std::vector<PlasmaError>& errors) {
   DCHECK(object_ids.size() == errors.size());
-  flatbuffers::FlatBufferBuilder fbb;
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
   auto message = fb::CreatePlasmaDeleteReply(
       fbb, static_cast<int32_t>(object_ids.size()),
       ToFlatbuffer(&fbb, &object_ids[0], object_ids.size()),
@@ -505,7 +596,7 @@ Status ReadDeleteReply(const uint8_t* data, size_t size,
   auto message = flatbuffers::GetRoot<PlasmaDeleteReply>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
   ToVector(*message, object_ids, [](const PlasmaDeleteReply& request, int i) {
-    return ObjectID::from_binary(request.object_ids()->Get(i)->str());
+    return FromFlatbuffer(request.object_ids()->Get(i));
   });
   ToVector(*message, errors, [](const PlasmaDeleteReply& request, int i) {
     return static_cast<PlasmaError>(request.errors()->Get(i));
@@ -516,9 +607,9 @@ Status ReadDeleteReply(const uint8_t* data, size_t size,
 // Contains messages.
 
 Status SendContainsRequest(int sock, ObjectID object_id) {
-  flatbuffers::FlatBufferBuilder fbb;
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
   auto message =
-      fb::CreatePlasmaContainsRequest(fbb, fbb.CreateString(object_id.binary()));
+      fb::CreatePlasmaContainsRequest(fbb, ToFlatbuffer(&fbb, object_id));
   return PlasmaSend(sock, MessageType::PlasmaContainsRequest, &fbb, message);
 }
 
@@ -526,13 +617,13 @@ Status ReadContainsRequest(const uint8_t* data, size_t size, ObjectID* object_id
   DCHECK(data);
   auto message = flatbuffers::GetRoot<fb::PlasmaContainsRequest>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
-  *object_id = ObjectID::from_binary(message->object_id()->str());
+  *object_id = FromFlatbuffer(message->object_id());
   return Status::OK();
 }
 
 Status SendContainsReply(int sock, ObjectID object_id, bool has_object) {
-  flatbuffers::FlatBufferBuilder fbb;
-  auto message = fb::CreatePlasmaContainsReply(fbb, fbb.CreateString(object_id.binary()),
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
+  auto message = fb::CreatePlasmaContainsReply(fbb, ToFlatbuffer(&fbb, object_id),
                                                has_object);
   return PlasmaSend(sock, MessageType::PlasmaContainsReply, &fbb, message);
 }
@@ -542,34 +633,55 @@ Status ReadContainsReply(const uint8_t* data, size_t size, ObjectID* object_id,
   DCHECK(data);
   auto message = flatbuffers::GetRoot<fb::PlasmaContainsReply>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
-  *object_id = ObjectID::from_binary(message->object_id()->str());
+  *object_id = FromFlatbuffer(message->object_id());
   *has_object = message->has_object();
   return Status::OK();
 }
 
 // List messages.
 
-Status SendListRequest(int sock) {
-  flatbuffers::FlatBufferBuilder fbb;
-  auto message = fb::CreatePlasmaListRequest(fbb);
+Status SendListRequest(int sock, const ObjectListFilter& filter, int64_t page_size,
+                       uint64_t cursor) {
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
+  auto message = fb::CreatePlasmaListRequest(
+      fbb, cursor, page_size, filter.state_mask, filter.min_size, filter.max_size,
+      filter.min_age, filter.max_age, fbb.CreateString(filter.owner));
   return PlasmaSend(sock, MessageType::PlasmaListRequest, &fbb, message);
 }
 
-Status ReadListRequest(const uint8_t* data, size_t size) { return Status::OK(); }
+Status ReadListRequest(const uint8_t* data, size_t size, ObjectListFilter* filter,
+                       int64_t* page_size, uint64_t* cursor) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaListRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  *cursor = message->cursor();
+  *page_size = message->page_size();
+  filter->state_mask = message->state_mask();
+  filter->min_size = message->min_size();
+  filter->max_size = message->max_size();
+  filter->min_age = message->min_age();
+  filter->max_age = message->max_age();
+  filter->owner = message->owner() == nullptr ? "" : message->owner()->str();
+  return Status::OK();
+}
+
+flatbuffers::Offset<fb::ObjectInfo> ToObjectInfo(flatbuffers::FlatBufferBuilder* fbb,
+                                                 const ObjectID& object_id,
+                                                 const ObjectTableEntry& entry) {
+  auto digest = entry.state == ObjectState::PLASMA_CREATED
+                    ? fbb->CreateString("")
+                    : fbb->CreateString(reinterpret_cast<const char*>(entry.digest),
+                                        kDigestSize);
+  return fb::CreateObjectInfo(*fbb, ToFlatbuffer(fbb, object_id), entry.data_size,
+                              entry.metadata_size, entry.ref_count, entry.create_time,
+                              entry.construct_duration, digest);
+}
 
-Status SendListReply(int sock, const ObjectTable& objects) {
-  flatbuffers::FlatBufferBuilder fbb;
+Status SendListReply(int sock, const FlatObjectTable& objects) {
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
   std::vector<flatbuffers::Offset<fb::ObjectInfo>> object_infos;
   for (auto const& entry : objects) {
-    auto digest = entry.second->state == ObjectState::PLASMA_CREATED
-                      ? fbb.CreateString("")
-                      : fbb.CreateString(reinterpret_cast<char*>(entry.second->digest),
-                                         kDigestSize);
-    auto info = fb::CreateObjectInfo(fbb, fbb.CreateString(entry.first.binary()),
-                                     entry.second->data_size, entry.second->metadata_size,
-                                     entry.second->ref_count, entry.second->create_time,
-                                     entry.second->construct_duration, digest);
-    object_infos.push_back(info);
+    object_infos.push_back(ToObjectInfo(&fbb, entry.first, entry.second));
   }
   auto message = fb::CreatePlasmaListReply(
       fbb, fbb.CreateVector(arrow::util::MakeNonNull(object_infos.data()),
@@ -577,12 +689,35 @@ Status SendListReply(int sock, const ObjectTable& objects) {
   return PlasmaSend(sock, MessageType::PlasmaListReply, &fbb, message);
 }
 
-Status ReadListReply(const uint8_t* data, size_t size, ObjectTable* objects) {
+Status SendListReply(int sock,
+                     const std::vector<FlatObjectTable::const_iterator>& objects,
+                     uint64_t cursor, bool restarted) {
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
+  std::vector<flatbuffers::Offset<fb::ObjectInfo>> object_infos;
+  for (auto const& entry : objects) {
+    object_infos.push_back(ToObjectInfo(&fbb, entry->first, entry->second));
+  }
+  auto message = fb::CreatePlasmaListReply(
+      fbb,
+      fbb.CreateVector(arrow::util::MakeNonNull(object_infos.data()),
+                       object_infos.size()),
+      cursor, restarted);
+  return PlasmaSend(sock, MessageType::PlasmaListReply, &fbb, message);
+}
+
+Status ReadListReply(const uint8_t* data, size_t size, ObjectTable* objects,
+                     uint64_t* cursor, bool* restarted) {
   DCHECK(data);
   auto message = flatbuffers::GetRoot<fb::PlasmaListReply>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
+  if (cursor != nullptr) {
+    *cursor = message->cursor();
+  }
+  if (restarted != nullptr) {
+    *restarted = message->restarted();
+  }
   for (auto const object : *message->objects()) {
-    ObjectID object_id = ObjectID::from_binary(object->object_id()->str());
+    ObjectID object_id = FromFlatbuffer(object->object_id());
     auto entry = std::unique_ptr<ObjectTableEntry>(new ObjectTableEntry());
     entry->data_size = object->data_size();
     entry->metadata_size = object->metadata_size();
@@ -598,16 +733,24 @@ Status ReadListReply(const uint8_t* data, size_t size, ObjectTable* objects) {
 
 // Connect messages.
 
-Status SendConnectRequest(int sock) {
-  flatbuffers::FlatBufferBuilder fbb;
-  auto message = fb::CreatePlasmaConnectRequest(fbb);
+Status SendConnectRequest(int sock, int numa_node, bool remote_memory) {
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
+  auto message = fb::CreatePlasmaConnectRequest(fbb, numa_node, remote_memory);
   return PlasmaSend(sock, MessageType::PlasmaConnectRequest, &fbb, message);
 }
 
-Status ReadConnectRequest(const uint8_t* data) { return Status::OK(); }
+Status ReadConnectRequest(const uint8_t* data, size_t size, int* numa_node,
+                          bool* remote_memory) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaConnectRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  *numa_node = message->numa_node();
+  *remote_memory = message->remote_memory();
+  return Status::OK();
+}
 
 Status SendConnectReply(int sock, int64_t memory_capacity) {
-  flatbuffers::FlatBufferBuilder fbb;
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
   auto message = fb::CreatePlasmaConnectReply(fbb, memory_capacity);
   return PlasmaSend(sock, MessageType::PlasmaConnectReply, &fbb, message);
 }
@@ -623,7 +766,7 @@ Status ReadConnectReply(const uint8_t* data, size_t size, int64_t* memory_capaci
 // Evict messages.
 
 Status SendEvictRequest(int sock, int64_t num_bytes) {
-  flatbuffers::FlatBufferBuilder fbb;
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
   auto message = fb::CreatePlasmaEvictRequest(fbb, num_bytes);
   return PlasmaSend(sock, MessageType::PlasmaEvictRequest, &fbb, message);
 }
@@ -637,7 +780,7 @@ Status ReadEvictRequest(const uint8_t* data, size_t size, int64_t* num_bytes) {
 }
 
 Status SendEvictReply(int sock, int64_t num_bytes) {
-  flatbuffers::FlatBufferBuilder fbb;
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
   auto message = fb::CreatePlasmaEvictReply(fbb, num_bytes);
   return PlasmaSend(sock, MessageType::PlasmaEvictReply, &fbb, message);
 }
@@ -650,63 +793,116 @@ Status ReadEvictReply(const uint8_t* data, size_t size, int64_t& num_bytes) {
   return Status::OK();
 }
 
+// GrowRegion messages.
+
+Status SendGrowRegionRequest(int sock, int64_t memory_capacity) {
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
+  auto message = fb::CreatePlasmaGrowRegionRequest(fbb, memory_capacity);
+  return PlasmaSend(sock, MessageType::PlasmaGrowRegionRequest, &fbb, message);
+}
+
+Status ReadGrowRegionRequest(const uint8_t* data, size_t size, int64_t* memory_capacity) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaGrowRegionRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  *memory_capacity = message->memory_capacity();
+  return Status::OK();
+}
+
+Status SendGrowRegionReply(int sock, PlasmaError error, int64_t memory_capacity) {
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
+  auto message = fb::CreatePlasmaGrowRegionReply(fbb, error, memory_capacity);
+  return PlasmaSend(sock, MessageType::PlasmaGrowRegionReply, &fbb, message);
+}
+
+Status ReadGrowRegionReply(const uint8_t* data, size_t size, int64_t* memory_capacity) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaGrowRegionReply>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  *memory_capacity = message->memory_capacity();
+  return PlasmaErrorStatus(message->error());
+}
+
 // Get messages.
 
 Status SendGetRequest(int sock, const ObjectID* object_ids, int64_t num_objects,
-                      int64_t timeout_ms) {
-  flatbuffers::FlatBufferBuilder fbb;
+                      int64_t timeout_ms, uint64_t request_id) {
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
   auto message = fb::CreatePlasmaGetRequest(
-      fbb, ToFlatbuffer(&fbb, object_ids, num_objects), timeout_ms);
+      fbb, ToFlatbuffer(&fbb, object_ids, num_objects), timeout_ms, request_id);
   return PlasmaSend(sock, MessageType::PlasmaGetRequest, &fbb, message);
 }
 
 Status ReadGetRequest(const uint8_t* data, size_t size, std::vector<ObjectID>& object_ids,
-                      int64_t* timeout_ms) {
+                      int64_t* timeout_ms, uint64_t* request_id) {
   DCHECK(data);
   auto message = flatbuffers::GetRoot<fb::PlasmaGetRequest>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
+  object_ids.clear();
   for (uoffset_t i = 0; i < message->object_ids()->size(); ++i) {
-    auto object_id = message->object_ids()->Get(i)->str();
-    object_ids.push_back(ObjectID::from_binary(object_id));
+    object_ids.push_back(FromFlatbuffer(message->object_ids()->Get(i)));
   }
   *timeout_ms = message->timeout_ms();
+  if (request_id != nullptr) {
+    *request_id = message->request_id();
+  }
   return Status::OK();
 }
 
 Status SendGetReply(int sock, ObjectID object_ids[],
                     std::unordered_map<ObjectID, PlasmaObject>& plasma_objects,
                     int64_t num_objects, const std::vector<int>& store_fds,
-                    const std::vector<int64_t>& mmap_sizes) {
-  flatbuffers::FlatBufferBuilder fbb;
-  std::vector<PlasmaObjectSpec> objects;
+                    const std::vector<int64_t>& mmap_sizes, uint64_t request_id,
+                    const std::vector<int64_t>& leases) {
+  std::vector<PlasmaObject> objects;
+  for (int64_t i = 0; i < num_objects; ++i) {
+    objects.push_back(plasma_objects[object_ids[i]]);
+  }
+  return SendGetReply(sock, object_ids, objects.data(), num_objects, store_fds,
+                      mmap_sizes, request_id, leases);
+}
 
+Status SendGetReply(int sock, const ObjectID object_ids[],
+                    const PlasmaObject plasma_objects[], int64_t num_objects,
+                    const std::vector<int>& store_fds,
+                    const std::vector<int64_t>& mmap_sizes, uint64_t request_id,
+                    const std::vector<int64_t>& leases) {
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
   std::vector<flatbuffers::Offset<fb::CudaHandle>> handles;
-  for (int64_t i = 0; i < num_objects; ++i) {
-    const PlasmaObject& object = plasma_objects[object_ids[i]];
-    objects.push_back(PlasmaObjectSpec(object.store_fd, object.data_offset,
-                                       object.data_size, object.metadata_offset,
-                                       object.metadata_size, object.device_num));
 #ifdef PLASMA_CUDA
+  for (int64_t i = 0; i < num_objects; ++i) {
+    const PlasmaObject& object = plasma_objects[i];
     if (object.device_num != 0) {
       std::shared_ptr<arrow::Buffer> handle;
       ARROW_ASSIGN_OR_RAISE(handle, object.ipc_handle->Serialize());
       handles.push_back(
           fb::CreateCudaHandle(fbb, fbb.CreateVector(handle->data(), handle->size())));
     }
+  }
 #endif
+  static thread_local std::vector<PlasmaObjectSpec> objects;
+  objects.clear();
+  for (int64_t i = 0; i < num_objects; ++i) {
+    const PlasmaObject& object = plasma_objects[i];
+    objects.push_back(PlasmaObjectSpec(object.store_fd, object.data_offset,
+                                       object.data_size, object.metadata_offset,
+                                       object.metadata_size, object.device_num));
   }
   auto message = fb::CreatePlasmaGetReply(
       fbb, ToFlatbuffer(&fbb, object_ids, num_objects),
       fbb.CreateVectorOfStructs(arrow::util::MakeNonNull(objects.data()), num_objects),
       fbb.CreateVector(arrow::util::MakeNonNull(store_fds.data()), store_fds.size()),
       fbb.CreateVector(arrow::util::MakeNonNull(mmap_sizes.data()), mmap_sizes.size()),
-      fbb.CreateVector(arrow::util::MakeNonNull(handles.data()), handles.size()));
+      fbb.CreateVector(arrow::util::MakeNonNull(handles.data()), handles.size()),
+      request_id,
+      leases.empty() ? 0 : fbb.CreateVector(leases.data(), leases.size()));
   return PlasmaSend(sock, MessageType::PlasmaGetReply, &fbb, message);
 }
 
 Status ReadGetReply(const uint8_t* data, size_t size, ObjectID object_ids[],
                     PlasmaObject plasma_objects[], int64_t num_objects,
-                    std::vector<int>& store_fds, std::vector<int64_t>& mmap_sizes) {
+                    std::vector<int>& store_fds, std::vector<int64_t>& mmap_sizes,
+                    uint64_t* request_id, std::vector<int64_t>* leases) {
   DCHECK(data);
   auto message = flatbuffers::GetRoot<fb::PlasmaGetReply>(data);
 #ifdef PLASMA_CUDA
@@ -714,7 +910,7 @@ Status ReadGetReply(const uint8_t* data, size_t size, ObjectID object_ids[],
 #endif
   DCHECK(VerifyFlatbuffer(message, data, size));
   for (uoffset_t i = 0; i < num_objects; ++i) {
-    object_ids[i] = ObjectID::from_binary(message->object_ids()->Get(i)->str());
+    object_ids[i] = FromFlatbuffer(message->object_ids()->Get(i));
   }
   for (uoffset_t i = 0; i < num_objects; ++i) {
     const PlasmaObjectSpec* object = message->plasma_objects()->Get(i);
@@ -738,24 +934,111 @@ Status ReadGetReply(const uint8_t* data, size_t size, ObjectID object_ids[],
     store_fds.push_back(message->store_fds()->Get(i));
     mmap_sizes.push_back(message->mmap_sizes()->Get(i));
   }
+  if (request_id != nullptr) {
+    *request_id = message->request_id();
+  }
+  if (leases != nullptr) {
+    leases->clear();
+    if (message->leases() != nullptr) {
+      leases->assign(message->leases()->begin(), message->leases()->end());
+    }
+  }
+  return Status::OK();
+}
+
+Status ReadReplyRequestId(MessageType type, const uint8_t* data, size_t size,
+                          uint64_t* request_id) {
+  DCHECK(data);
+  switch (type) {
+    case MessageType::PlasmaCreateReply: {
+      auto message = flatbuffers::GetRoot<fb::PlasmaCreateReply>(data);
+      DCHECK(VerifyFlatbuffer(message, data, size));
+      *request_id = message->request_id();
+    } break;
+    case MessageType::PlasmaSealReply: {
+      auto message = flatbuffers::GetRoot<fb::PlasmaSealReply>(data);
+      DCHECK(VerifyFlatbuffer(message, data, size));
+      *request_id = message->request_id();
+    } break;
+    case MessageType::PlasmaGetReply: {
+      auto message = flatbuffers::GetRoot<fb::PlasmaGetReply>(data);
+      DCHECK(VerifyFlatbuffer(message, data, size));
+      *request_id = message->request_id();
+    } break;
+    default:
+      return Status::IOError("Unexpected reply of type ", static_cast<int64_t>(type),
+                             " on a pipelined connection");
+  }
+  return Status::OK();
+}
+
+// Wait messages.
+
+Status SendWaitRequest(int sock, const std::vector<ObjectID>& object_ids,
+                       int64_t num_ready_objects, int64_t timeout_ms) {
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
+  auto message = fb::CreatePlasmaWaitRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()), num_ready_objects,
+      timeout_ms);
+  return PlasmaSend(sock, MessageType::PlasmaWaitRequest, &fbb, message);
+}
+
+Status ReadWaitRequest(const uint8_t* data, size_t size,
+                       std::vector<ObjectID>* object_ids, int64_t* num_ready_objects,
+                       int64_t* timeout_ms) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaWaitRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  for (uoffset_t i = 0; i < message->object_ids()->size(); ++i) {
+    object_ids->push_back(FromFlatbuffer(message->object_ids()->Get(i)));
+  }
+  *num_ready_objects = message->num_ready_objects();
+  *timeout_ms = message->timeout_ms();
+  return Status::OK();
+}
+
+Status SendWaitReply(int sock, const std::vector<ObjectID>& ready_object_ids) {
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
+  auto message = fb::CreatePlasmaWaitReply(
+      fbb, ToFlatbuffer(&fbb, ready_object_ids.data(), ready_object_ids.size()));
+  return PlasmaSend(sock, MessageType::PlasmaWaitReply, &fbb, message);
+}
+
+Status ReadWaitReply(const uint8_t* data, size_t size,
+                     std::vector<ObjectID>* ready_object_ids) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaWaitReply>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  for (uoffset_t i = 0; i < message->ready_object_ids()->size(); ++i) {
+    ready_object_ids->push_back(
+        FromFlatbuffer(message->ready_object_ids()->Get(i)));
+  }
   return Status::OK();
 }
 
 // Subscribe messages.
 
-Status SendSubscribeRequest(int sock) {
-  flatbuffers::FlatBufferBuilder fbb;
-  auto message = fb::CreatePlasmaSubscribeRequest(fbb);
+Status SendSubscribeRequest(int sock, bool notification_ring) {
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
+  auto message = fb::CreatePlasmaSubscribeRequest(fbb, notification_ring);
   return PlasmaSend(sock, MessageType::PlasmaSubscribeRequest, &fbb, message);
 }
 
+Status ReadSubscribeRequest(const uint8_t* data, size_t size, bool* notification_ring) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaSubscribeRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  *notification_ring = message->notification_ring();
+  return Status::OK();
+}
+
 // Data messages.
 
 Status SendDataRequest(int sock, ObjectID object_id, const char* address, int port) {
-  flatbuffers::FlatBufferBuilder fbb;
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
   auto addr = fbb.CreateString(address, strlen(address));
   auto message =
-      fb::CreatePlasmaDataRequest(fbb, fbb.CreateString(object_id.binary()), addr, port);
+      fb::CreatePlasmaDataRequest(fbb, ToFlatbuffer(&fbb, object_id), addr, port);
   return PlasmaSend(sock, MessageType::PlasmaDataRequest, &fbb, message);
 }
 
@@ -765,7 +1048,7 @@ Status ReadDataRequest(const uint8_t* data, size_t size, ObjectID* object_id,
   auto message = flatbuffers::GetRoot<fb::PlasmaDataRequest>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
   DCHECK(message->object_id()->size() == sizeof(ObjectID));
-  *object_id = ObjectID::from_binary(message->object_id()->str());
+  *object_id = FromFlatbuffer(message->object_id());
   *address = strdup(message->address()->c_str());
   *port = message->port();
   return Status::OK();
@@ -773,8 +1056,8 @@ Status ReadDataRequest(const uint8_t* data, size_t size, ObjectID* object_id,
 
 Status SendDataReply(int sock, ObjectID object_id, int64_t object_size,
                      int64_t metadata_size) {
-  flatbuffers::FlatBufferBuilder fbb;
-  auto message = fb::CreatePlasmaDataReply(fbb, fbb.CreateString(object_id.binary()),
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
+  auto message = fb::CreatePlasmaDataReply(fbb, ToFlatbuffer(&fbb, object_id),
                                            object_size, metadata_size);
   return PlasmaSend(sock, MessageType::PlasmaDataReply, &fbb, message);
 }
@@ -784,7 +1067,7 @@ Status ReadDataReply(const uint8_t* data, size_t size, ObjectID* object_id,
   DCHECK(data);
   auto message = flatbuffers::GetRoot<fb::PlasmaDataReply>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
-  *object_id = ObjectID::from_binary(message->object_id()->str());
+  *object_id = FromFlatbuffer(message->object_id());
   *object_size = static_cast<int64_t>(message->object_size());
   *metadata_size = static_cast<int64_t>(message->metadata_size());
   return Status::OK();
@@ -793,7 +1076,7 @@ Status ReadDataReply(const uint8_t* data, size_t size, ObjectID* object_id,
 // RefreshLRU messages.
 
 Status SendRefreshLRURequest(int sock, const std::vector<ObjectID>& object_ids) {
-  flatbuffers::FlatBufferBuilder fbb;
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
 
   auto message = fb::CreatePlasmaRefreshLRURequest(
       fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()));
@@ -814,7 +1097,7 @@ Status ReadRefreshLRURequest(const uint8_t* data, size_t size,
 }
 
 Status SendRefreshLRUReply(int sock) {
-  flatbuffers::FlatBufferBuilder fbb;
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
   auto message = fb::CreatePlasmaRefreshLRUReply(fbb);
   return PlasmaSend(sock, MessageType::PlasmaRefreshLRUReply, &fbb, message);
 }
@@ -826,4 +1109,82 @@ Status ReadRefreshLRUReply(const uint8_t* data, size_t size) {
   return Status::OK();
 }
 
+// Stream messages.
+
+Status SendCreateStreamRequest(int sock, const ObjectID& object_id, bool evict_if_full,
+                               int64_t capacity, int64_t metadata_size) {
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
+  auto message = fb::CreatePlasmaCreateStreamRequest(
+      fbb, ToFlatbuffer(&fbb, object_id), evict_if_full, capacity, metadata_size);
+  return PlasmaSend(sock, MessageType::PlasmaCreateStreamRequest, &fbb, message);
+}
+
+Status ReadCreateStreamRequest(const uint8_t* data, size_t size, ObjectID* object_id,
+                               bool* evict_if_full, int64_t* capacity,
+                               int64_t* metadata_size) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaCreateStreamRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  *object_id = FromFlatbuffer(message->object_id());
+  *evict_if_full = message->evict_if_full();
+  *capacity = message->capacity();
+  *metadata_size = message->metadata_size();
+  return Status::OK();
+}
+
+Status SendPublishRequest(int sock, const ObjectID& object_id, int64_t stream_size) {
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
+  auto message = fb::CreatePlasmaPublishRequest(
+      fbb, ToFlatbuffer(&fbb, object_id), stream_size);
+  return PlasmaSend(sock, MessageType::PlasmaPublishRequest, &fbb, message);
+}
+
+Status ReadPublishRequest(const uint8_t* data, size_t size, ObjectID* object_id,
+                          int64_t* stream_size) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaPublishRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  *object_id = FromFlatbuffer(message->object_id());
+  *stream_size = message->stream_size();
+  return Status::OK();
+}
+
+Status SendWaitStreamRequest(int sock, const ObjectID& object_id, int64_t stream_size,
+                             int64_t timeout_ms) {
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
+  auto message = fb::CreatePlasmaWaitStreamRequest(
+      fbb, ToFlatbuffer(&fbb, object_id), stream_size, timeout_ms);
+  return PlasmaSend(sock, MessageType::PlasmaWaitStreamRequest, &fbb, message);
+}
+
+Status ReadWaitStreamRequest(const uint8_t* data, size_t size, ObjectID* object_id,
+                             int64_t* stream_size, int64_t* timeout_ms) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaWaitStreamRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  *object_id = FromFlatbuffer(message->object_id());
+  *stream_size = message->stream_size();
+  *timeout_ms = message->timeout_ms();
+  return Status::OK();
+}
+
+Status SendWaitStreamReply(int sock, const ObjectID& object_id, PlasmaError error,
+                           int64_t stream_size, bool closed) {
+  flatbuffers::FlatBufferBuilder& fbb = MessageBuilder();
+  auto message = fb::CreatePlasmaWaitStreamReply(
+      fbb, ToFlatbuffer(&fbb, object_id), error, stream_size, closed);
+  return PlasmaSend(sock, MessageType::PlasmaWaitStreamReply, &fbb, message);
+}
+
+Status ReadWaitStreamReply(const uint8_t* data, size_t size, ObjectID* object_id,
+                           int64_t* stream_size, bool* closed) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaWaitStreamReply>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  *object_id = FromFlatbuffer(message->object_id());
+  *stream_size = message->stream_size();
+  *closed = message->closed();
+  return PlasmaErrorStatus(message->error());
+}
+
 }  // namespace plasma
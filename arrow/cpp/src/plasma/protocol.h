@@ -57,10 +57,10 @@ Status PlasmaReceive(int sock, MessageType message_type, std::vector<uint8_t>* b
 /* Set options messages. */
 
 Status SendSetOptionsRequest(int sock, const std::string& client_name,
-                             int64_t output_memory_limit);
+                             int64_t output_memory_limit, int weight = 0);
 
 Status ReadSetOptionsRequest(const uint8_t* data, size_t size, std::string* client_name,
-                             int64_t* output_memory_quota);
+                             int64_t* output_memory_quota, int* weight);
 
 Status SendSetOptionsReply(int sock, PlasmaError error);
 
@@ -78,17 +78,19 @@ Status ReadGetDebugStringReply(const uint8_t* data, size_t size,
 /* Plasma Create message functions. */
 
 Status SendCreateRequest(int sock, ObjectID object_id, bool evict_if_full,
-                         int64_t data_size, int64_t metadata_size, int device_num);
+                         int64_t data_size, int64_t metadata_size, int device_num,
+                         uint64_t request_id = 0);
 
 Status ReadCreateRequest(const uint8_t* data, size_t size, ObjectID* object_id,
                          bool* evict_if_full, int64_t* data_size, int64_t* metadata_size,
-                         int* device_num);
+                         int* device_num, uint64_t* request_id = nullptr);
 
 Status SendCreateReply(int sock, ObjectID object_id, PlasmaObject* object,
-                       PlasmaError error, int64_t mmap_size);
+                       PlasmaError error, int64_t mmap_size, uint64_t request_id = 0);
 
 Status ReadCreateReply(const uint8_t* data, size_t size, ObjectID* object_id,
-                       PlasmaObject* object, int* store_fd, int64_t* mmap_size);
+                       PlasmaObject* object, int* store_fd, int64_t* mmap_size,
+                       uint64_t* request_id = nullptr);
 
 Status SendCreateAndSealRequest(int sock, const ObjectID& object_id, bool evict_if_full,
                                 const std::string& data, const std::string& metadata,
@@ -119,6 +121,16 @@ Status SendCreateAndSealBatchReply(int sock, PlasmaError error);
 
 Status ReadCreateAndSealBatchReply(const uint8_t* data, size_t size);
 
+Status SendCreateViewRequest(int sock, const ObjectID& parent_id, int64_t offset,
+                             int64_t length, const ObjectID& object_id);
+
+Status ReadCreateViewRequest(const uint8_t* data, size_t size, ObjectID* parent_id,
+                             int64_t* offset, int64_t* length, ObjectID* object_id);
+
+Status SendCreateViewReply(int sock, PlasmaError error);
+
+Status ReadCreateViewReply(const uint8_t* data, size_t size);
+
 Status SendAbortRequest(int sock, ObjectID object_id);
 
 Status ReadAbortRequest(const uint8_t* data, size_t size, ObjectID* object_id);
@@ -129,31 +141,62 @@ Status ReadAbortReply(const uint8_t* data, size_t size, ObjectID* object_id);
 
 /* Plasma Seal message functions. */
 
-Status SendSealRequest(int sock, ObjectID object_id, const std::string& digest);
+Status SendSealRequest(int sock, ObjectID object_id, const std::string& digest,
+                       uint64_t request_id = 0);
 
 Status ReadSealRequest(const uint8_t* data, size_t size, ObjectID* object_id,
-                       std::string* digest);
+                       std::string* digest, uint64_t* request_id = nullptr);
 
-Status SendSealReply(int sock, ObjectID object_id, PlasmaError error);
+Status SendSealReply(int sock, ObjectID object_id, PlasmaError error,
+                     uint64_t request_id = 0);
 
-Status ReadSealReply(const uint8_t* data, size_t size, ObjectID* object_id);
+Status ReadSealReply(const uint8_t* data, size_t size, ObjectID* object_id,
+                     uint64_t* request_id = nullptr);
 
 /* Plasma Get message functions. */
 
 Status SendGetRequest(int sock, const ObjectID* object_ids, int64_t num_objects,
-                      int64_t timeout_ms);
+                      int64_t timeout_ms, uint64_t request_id = 0);
 
 Status ReadGetRequest(const uint8_t* data, size_t size, std::vector<ObjectID>& object_ids,
-                      int64_t* timeout_ms);
+                      int64_t* timeout_ms, uint64_t* request_id = nullptr);
 
 Status SendGetReply(int sock, ObjectID object_ids[],
                     std::unordered_map<ObjectID, PlasmaObject>& plasma_objects,
                     int64_t num_objects, const std::vector<int>& store_fds,
-                    const std::vector<int64_t>& mmap_sizes);
+                    const std::vector<int64_t>& mmap_sizes, uint64_t request_id = 0,
+                    const std::vector<int64_t>& leases = {});
+
+/// Like the above, with the object of object_ids[i] in plasma_objects[i].
+Status SendGetReply(int sock, const ObjectID object_ids[],
+                    const PlasmaObject plasma_objects[], int64_t num_objects,
+                    const std::vector<int>& store_fds,
+                    const std::vector<int64_t>& mmap_sizes, uint64_t request_id = 0,
+                    const std::vector<int64_t>& leases = {});
 
 Status ReadGetReply(const uint8_t* data, size_t size, ObjectID object_ids[],
                     PlasmaObject plasma_objects[], int64_t num_objects,
-                    std::vector<int>& store_fds, std::vector<int64_t>& mmap_sizes);
+                    std::vector<int>& store_fds, std::vector<int64_t>& mmap_sizes,
+                    uint64_t* request_id = nullptr, std::vector<int64_t>* leases = nullptr);
+
+/// Read the request_id of a reply to a Create, Seal or Get request, so that the
+/// reply can be matched with its request before it is fully decoded.
+Status ReadReplyRequestId(MessageType type, const uint8_t* data, size_t size,
+                          uint64_t* request_id);
+
+/* Plasma Wait message functions. */
+
+Status SendWaitRequest(int sock, const std::vector<ObjectID>& object_ids,
+                       int64_t num_ready_objects, int64_t timeout_ms);
+
+Status ReadWaitRequest(const uint8_t* data, size_t size,
+                       std::vector<ObjectID>* object_ids, int64_t* num_ready_objects,
+                       int64_t* timeout_ms);
+
+Status SendWaitReply(int sock, const std::vector<ObjectID>& ready_object_ids);
+
+Status ReadWaitReply(const uint8_t* data, size_t size,
+                     std::vector<ObjectID>* ready_object_ids);
 
 /* Plasma Release message functions. */
 
@@ -192,19 +235,27 @@ Status ReadContainsReply(const uint8_t* data, size_t size, ObjectID* object_id,
 
 /* Plasma List message functions. */
 
-Status SendListRequest(int sock);
+Status SendListRequest(int sock, const ObjectListFilter& filter = ObjectListFilter(),
+                       int64_t page_size = 0, uint64_t cursor = 0);
 
-Status ReadListRequest(const uint8_t* data, size_t size);
+Status ReadListRequest(const uint8_t* data, size_t size, ObjectListFilter* filter,
+                       int64_t* page_size, uint64_t* cursor);
 
-Status SendListReply(int sock, const ObjectTable& objects);
+Status SendListReply(int sock, const FlatObjectTable& objects);
 
-Status ReadListReply(const uint8_t* data, size_t size, ObjectTable* objects);
+Status SendListReply(int sock,
+                     const std::vector<FlatObjectTable::const_iterator>& objects,
+                     uint64_t cursor, bool restarted);
+
+Status ReadListReply(const uint8_t* data, size_t size, ObjectTable* objects,
+                     uint64_t* cursor = nullptr, bool* restarted = nullptr);
 
 /* Plasma Connect message functions. */
 
-Status SendConnectRequest(int sock);
+Status SendConnectRequest(int sock, int numa_node = -1, bool remote_memory = false);
 
-Status ReadConnectRequest(const uint8_t* data, size_t size);
+Status ReadConnectRequest(const uint8_t* data, size_t size, int* numa_node,
+                          bool* remote_memory);
 
 Status SendConnectReply(int sock, int64_t memory_capacity);
 
@@ -220,9 +271,21 @@ Status SendEvictReply(int sock, int64_t num_bytes);
 
 Status ReadEvictReply(const uint8_t* data, size_t size, int64_t& num_bytes);
 
+/* Plasma GrowRegion message functions. */
+
+Status SendGrowRegionRequest(int sock, int64_t memory_capacity);
+
+Status ReadGrowRegionRequest(const uint8_t* data, size_t size, int64_t* memory_capacity);
+
+Status SendGrowRegionReply(int sock, PlasmaError error, int64_t memory_capacity);
+
+Status ReadGrowRegionReply(const uint8_t* data, size_t size, int64_t* memory_capacity);
+
 /* Plasma Subscribe message functions. */
 
-Status SendSubscribeRequest(int sock);
+Status SendSubscribeRequest(int sock, bool notification_ring = false);
+
+Status ReadSubscribeRequest(const uint8_t* data, size_t size, bool* notification_ring);
 
 /* Data messages. */
 
@@ -248,4 +311,30 @@ Status SendRefreshLRUReply(int sock);
 
 Status ReadRefreshLRUReply(const uint8_t* data, size_t size);
 
+/* Plasma stream message functions. */
+
+Status SendCreateStreamRequest(int sock, const ObjectID& object_id, bool evict_if_full,
+                               int64_t capacity, int64_t metadata_size);
+
+Status ReadCreateStreamRequest(const uint8_t* data, size_t size, ObjectID* object_id,
+                               bool* evict_if_full, int64_t* capacity,
+                               int64_t* metadata_size);
+
+Status SendPublishRequest(int sock, const ObjectID& object_id, int64_t stream_size);
+
+Status ReadPublishRequest(const uint8_t* data, size_t size, ObjectID* object_id,
+                          int64_t* stream_size);
+
+Status SendWaitStreamRequest(int sock, const ObjectID& object_id, int64_t stream_size,
+                             int64_t timeout_ms);
+
+Status ReadWaitStreamRequest(const uint8_t* data, size_t size, ObjectID* object_id,
+                             int64_t* stream_size, int64_t* timeout_ms);
+
+Status SendWaitStreamReply(int sock, const ObjectID& object_id, PlasmaError error,
+                           int64_t stream_size, bool closed);
+
+Status ReadWaitStreamReply(const uint8_t* data, size_t size, ObjectID* object_id,
+                           int64_t* stream_size, bool* closed);
+
 }  // namespace plasma
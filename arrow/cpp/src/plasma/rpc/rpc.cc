@@ -1,52 +1,142 @@
 #include <plasma/rpc/rpc.h>
 
+#include <cstring>
+#include <sstream>
+
 #include "arrow/util/logging.h"
 
 namespace plasma {
 
+namespace {
+
+// Peers pack the IDs back to back, so an element can hold many of them.
+std::vector<ObjectID> UnpackObjectIDs(const plasmaRPC::ObjectIDs& request) {
+  std::vector<ObjectID> object_ids;
+  for (const auto& ids : request.ids()) {
+    for (size_t offset = 0; offset + kUniqueIDSize <= ids.size();
+         offset += kUniqueIDSize) {
+      ObjectID object_id;
+      std::memcpy(object_id.mutable_data(), ids.data() + offset, kUniqueIDSize);
+      object_ids.push_back(object_id);
+    }
+  }
+  return object_ids;
+}
+
+void PackObjectIDs(const std::vector<ObjectID>& object_ids, plasmaRPC::ObjectIDs* request) {
+  std::string* ids = request->add_ids();
+  ids->resize(object_ids.size() * kUniqueIDSize);
+  for (size_t i = 0; i < object_ids.size(); ++i) {
+    std::memcpy(&(*ids)[i * kUniqueIDSize], object_ids[i].data(), kUniqueIDSize);
+  }
+}
+
+}  // namespace
+
 RpcServiceImpl::RpcServiceImpl(PlasmaStoreInfo* plasma_store_info, std::mutex* mutex)
     : plasma_store_info_(plasma_store_info),
-      mutex_(mutex) {}
+      mutex_(mutex),
+      handler_(nullptr) {}
 
 grpc::Status RpcServiceImpl::GetObjects(grpc::ServerContext* context, const plasmaRPC::ObjectIDs* request,
                 plasmaRPC::ObjectDetailsList* reply) {
-  ARROW_LOG(DEBUG) << "RPC: servicing request for " << request->ids_size() << " remote objects";
-  for (auto id : request->ids()) {
-    std::lock_guard<std::mutex> lock(*mutex_);
-    const ObjectTableEntry* entry = GetObjectTableEntry(plasma_store_info_, 
-                                  ObjectID::from_binary(id));
-
-    auto object_details = reply->add_objects_details();
-    if (!entry) {
-      object_details->set_status(plasmaRPC::ObjectDetails::MISSING);
-      continue;
-    }
+  // Peers pack the IDs back to back, so an element can hold many of them.
+  size_t num_objects = 0;
+  for (const auto& ids : request->ids()) {
+    num_objects += ids.size() / kUniqueIDSize;
+  }
+  ARROW_LOG(DEBUG) << "RPC: servicing request for " << num_objects << " remote objects";
+  reply->mutable_objects_details()->Reserve(num_objects);
+  std::lock_guard<std::mutex> lock(*mutex_);
+  for (const auto& ids : request->ids()) {
+    for (size_t offset = 0; offset + kUniqueIDSize <= ids.size();
+         offset += kUniqueIDSize) {
+      ObjectID object_id;
+      std::memcpy(object_id.mutable_data(), ids.data() + offset, kUniqueIDSize);
+      const ObjectTableEntry* entry = GetObjectTableEntry(plasma_store_info_, object_id);
+
+      auto object_details = reply->add_objects_details();
+      if (!entry) {
+        object_details->set_status(plasmaRPC::ObjectDetails::MISSING);
+        continue;
+      }
 
-    switch (entry->state) {
-      case(ObjectState::PLASMA_EVICTED):
-        object_details->set_status(plasmaRPC::ObjectDetails::EVICTED);
-        break;
-      case(ObjectState::PLASMA_CREATED):
-        object_details->set_status(plasmaRPC::ObjectDetails::UNSEALED);
-        break;
-      case(ObjectState::PLASMA_SEALED): {
-        object_details->set_status(plasmaRPC::ObjectDetails::OK);
-        auto object = object_details->mutable_object();
-        object->set_data_offset(entry->offset);
-        object->set_metadata_offset(entry->offset + entry->data_size);
-        object->set_data_size(entry->data_size);
-        object->set_metadata_size(entry->metadata_size);
-        object->set_device_num(entry->device_num);
-        break;
+      switch (entry->state) {
+        case(ObjectState::PLASMA_EVICTED):
+        // Compressed objects can not be read in place either.
+        case(ObjectState::PLASMA_COMPRESSED):
+          object_details->set_status(plasmaRPC::ObjectDetails::EVICTED);
+          break;
+        case(ObjectState::PLASMA_CREATED):
+          object_details->set_status(plasmaRPC::ObjectDetails::UNSEALED);
+          break;
+        case(ObjectState::PLASMA_SEALED): {
+          object_details->set_status(plasmaRPC::ObjectDetails::OK);
+          auto object = object_details->mutable_object();
+          object->set_data_offset(entry->offset);
+          object->set_metadata_offset(entry->offset + entry->data_size);
+          object->set_data_size(entry->stream_size != -1 ? entry->stream_size
+                                                         : entry->data_size);
+          object->set_metadata_size(entry->metadata_size);
+          object->set_device_num(entry->device_num);
+          break;
+        }
+        default:
+          ARROW_LOG(ERROR) << "RPC: Invalid object state";
+          break;
       }
-      default:
-        ARROW_LOG(ERROR) << "RPC: Invalid object state";
-        break;
     }
   }
   return grpc::Status::OK;
 }
 
+grpc::Status RpcServiceImpl::AllocateObject(grpc::ServerContext* context,
+                                            const plasmaRPC::ObjectDetails* request,
+                                            plasmaRPC::ObjectDetails* reply) {
+  if (handler_ == nullptr) {
+    return grpc::Status(grpc::StatusCode::UNIMPLEMENTED,
+                        "the store does not create objects for its peer");
+  }
+  if (request->id().size() != kUniqueIDSize || !request->has_object()) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "malformed allocation");
+  }
+  ObjectID object_id = ObjectID::from_binary(request->id());
+  ARROW_LOG(DEBUG) << "RPC: allocating " << object_id.hex() << " for the remote store";
+  handler_->AllocateForPeer(object_id, request->object().data_size(),
+                            request->object().metadata_size(), reply);
+  return grpc::Status::OK;
+}
+
+grpc::Status RpcServiceImpl::SealObjects(grpc::ServerContext* context,
+                                         const plasmaRPC::ObjectIDs* request,
+                                         plasmaRPC::ObjectDetailsList* reply) {
+  if (handler_ == nullptr) {
+    return grpc::Status(grpc::StatusCode::UNIMPLEMENTED,
+                        "the store does not create objects for its peer");
+  }
+  for (const auto& object_id : UnpackObjectIDs(*request)) {
+    reply->add_objects_details()->set_status(handler_->SealForPeer(object_id)
+                                                 ? plasmaRPC::ObjectDetails::OK
+                                                 : plasmaRPC::ObjectDetails::MISSING);
+  }
+  return grpc::Status::OK;
+}
+
+grpc::Status RpcServiceImpl::AbortObjects(grpc::ServerContext* context,
+                                          const plasmaRPC::ObjectIDs* request,
+                                          plasmaRPC::ObjectDetailsList* reply) {
+  if (handler_ == nullptr) {
+    return grpc::Status(grpc::StatusCode::UNIMPLEMENTED,
+                        "the store does not create objects for its peer");
+  }
+  for (const auto& object_id : UnpackObjectIDs(*request)) {
+    reply->add_objects_details()->set_status(handler_->AbortForPeer(object_id)
+                                                 ? plasmaRPC::ObjectDetails::OK
+                                                 : plasmaRPC::ObjectDetails::MISSING);
+  }
+  return grpc::Status::OK;
+}
+
 RpcClient::RpcClient() {}
 
 RpcClient::RpcClient(std::shared_ptr<grpc::Channel> channel)
@@ -55,21 +145,26 @@ RpcClient::RpcClient(std::shared_ptr<grpc::Channel> channel)
 // Assembles the client's payload, sends it and presents the response back
 // from the server.
 plasmaRPC::ObjectDetailsList RpcClient::GetObjects(std::vector<ObjectID> object_ids) {
-  // Data we are sending to the server.
-  plasmaRPC::ObjectIDs request;
-  for (auto id : object_ids) {
-   request.add_ids(id.binary());
-  }
+  google::protobuf::Arena arena;
+  return *GetObjects(object_ids, &arena);
+}
+
+plasmaRPC::ObjectDetailsList* RpcClient::GetObjects(const std::vector<ObjectID>& object_ids,
+                                                    google::protobuf::Arena* arena) {
+  // Data we are sending to the server. The IDs are packed into one element,
+  // rather than a string each.
+  auto request = google::protobuf::Arena::CreateMessage<plasmaRPC::ObjectIDs>(arena);
+  PackObjectIDs(object_ids, request);
 
   // Container for the data we expect from the server.
-  plasmaRPC::ObjectDetailsList reply;
+  auto reply = google::protobuf::Arena::CreateMessage<plasmaRPC::ObjectDetailsList>(arena);
 
   // Context for the client. It could be used to convey extra information to
   // the server and/or tweak certain RPC behaviors.
   grpc::ClientContext context;
 
   // The actual RPC.
-  grpc::Status status = stub_->GetObjects(&context, request, &reply);
+  grpc::Status status = stub_->GetObjects(&context, *request, reply);
 
   // Act upon its status.
   if (!status.ok()) {
@@ -78,6 +173,136 @@ plasmaRPC::ObjectDetailsList RpcClient::GetObjects(std::vector<ObjectID> object_
   return reply;
 }
 
+plasmaRPC::ObjectDetails RpcClient::AllocateObject(const ObjectID& object_id,
+                                                   int64_t data_size,
+                                                   int64_t metadata_size) {
+  plasmaRPC::ObjectDetails request;
+  request.set_id(object_id.binary());
+  request.mutable_object()->set_data_size(data_size);
+  request.mutable_object()->set_metadata_size(metadata_size);
+
+  plasmaRPC::ObjectDetails reply;
+  grpc::ClientContext context;
+  grpc::Status status = stub_->AllocateObject(&context, request, &reply);
+  if (!status.ok()) {
+    ARROW_LOG(ERROR) << "RPC error: " << status.error_code() << " - " << status.error_message();
+    reply.Clear();
+    reply.set_status(plasmaRPC::ObjectDetails::OUT_OF_MEMORY);
+  }
+  return reply;
+}
+
+template <typename Rpc>
+bool RpcClient::UpdateObjects(const std::vector<ObjectID>& object_ids, Rpc rpc) {
+  plasmaRPC::ObjectIDs request;
+  PackObjectIDs(object_ids, &request);
+  plasmaRPC::ObjectDetailsList reply;
+  grpc::ClientContext context;
+  grpc::Status status = (stub_.get()->*rpc)(&context, request, &reply);
+  if (!status.ok()) {
+    ARROW_LOG(ERROR) << "RPC error: " << status.error_code() << " - " << status.error_message();
+    return false;
+  }
+  bool all_ok = reply.objects_details_size() == static_cast<int>(object_ids.size());
+  for (const auto& details : reply.objects_details()) {
+    all_ok = all_ok && details.status() == plasmaRPC::ObjectDetails::OK;
+  }
+  return all_ok;
+}
+
+bool RpcClient::SealObjects(const std::vector<ObjectID>& object_ids) {
+  return UpdateObjects(object_ids, &plasmaRPC::RemoteObjectShare::Stub::SealObjects);
+}
+
+bool RpcClient::AbortObjects(const std::vector<ObjectID>& object_ids) {
+  return UpdateObjects(object_ids, &plasmaRPC::RemoteObjectShare::Stub::AbortObjects);
+}
+
+RemoteLookupBatcher::RemoteLookupBatcher(RpcClient* client, EventLoop* loop)
+    : client_(client),
+      loop_(loop),
+      window_ms_(0),
+      timer_(-1),
+      num_lookups_(0),
+      num_rpcs_(0) {
+  missing_.set_status(plasmaRPC::ObjectDetails::MISSING);
+}
+
+void RemoteLookupBatcher::Lookup(const std::vector<ObjectID>& object_ids,
+                                 const void* owner, Callback callback) {
+  pending_.push_back({owner, object_ids_.size(), object_ids.size(), std::move(callback)});
+  object_ids_.insert(object_ids_.end(), object_ids.begin(), object_ids.end());
+  ++num_lookups_;
+  if (window_ms_ < 0 || object_ids_.size() >= kMaxBatchSize) {
+    Flush();
+  } else if (timer_ == -1) {
+    timer_ = loop_->AddTimer(window_ms_, [this](int64_t timer_id) {
+      timer_ = -1;
+      Flush();
+      return kEventLoopTimerDone;
+    });
+  }
+}
+
+void RemoteLookupBatcher::Cancel(const void* owner) {
+  for (auto& lookup : pending_) {
+    if (lookup.owner == owner) {
+      lookup.callback = nullptr;
+    }
+  }
+  for (auto lookups : in_flight_) {
+    for (auto& lookup : *lookups) {
+      if (lookup.owner == owner) {
+        lookup.callback = nullptr;
+      }
+    }
+  }
+}
+
+void RemoteLookupBatcher::Flush() {
+  if (timer_ != -1) {
+    loop_->RemoveTimer(timer_);
+    timer_ = -1;
+  }
+  if (pending_.empty()) {
+    return;
+  }
+  std::vector<ObjectID> object_ids;
+  std::vector<PendingLookup> lookups;
+  object_ids.swap(object_ids_);
+  lookups.swap(pending_);
+
+  google::protobuf::Arena arena;
+  auto reply = client_->GetObjects(object_ids, &arena);
+  ++num_rpcs_;
+
+  in_flight_.push_back(&lookups);
+  std::vector<const plasmaRPC::ObjectDetails*> details;
+  for (auto& lookup : lookups) {
+    if (!lookup.callback) {
+      continue;
+    }
+    details.clear();
+    for (size_t i = lookup.first; i < lookup.first + lookup.count; ++i) {
+      details.push_back(static_cast<int>(i) < reply->objects_details_size()
+                            ? &reply->objects_details(i)
+                            : &missing_);
+    }
+    // The callback may cancel lookups that come after it in this batch.
+    Callback callback = std::move(lookup.callback);
+    lookup.callback = nullptr;
+    callback(details);
+  }
+  in_flight_.pop_back();
+}
+
+std::string RemoteLookupBatcher::DebugString() const {
+  std::stringstream result;
+  result << "\n(remote) lookups: " << num_lookups_;
+  result << "\n(remote) lookup rpcs: " << num_rpcs_;
+  return result.str();
+}
+
 void RunRpcServer(RpcServiceImpl& service, const std::string& local_address) {
   grpc::EnableDefaultHealthCheckService(true);
   // grpc::reflection::InitProtoReflectionServerBuilderPlugin();
@@ -1,9 +1,11 @@
 #pragma once
 
+#include <functional>
 #include <string>
 #include <vector>
 #include <mutex>
 
+#include <plasma/events.h>
 #include <plasma/plasma.h>
 
 #include <grpcpp/grpcpp.h>
@@ -12,17 +14,55 @@
 
 namespace plasma {
 
+// Serves the requests of the remote store to create objects in the region of
+// this one. The methods are called on the RPC thread.
+class PeerObjectHandler {
+ public:
+  virtual ~PeerObjectHandler() = default;
+
+  // Create an object for the remote store and fill in details with the status
+  // and, if it is OK, where the object is in the region.
+  virtual void AllocateForPeer(const ObjectID& object_id, int64_t data_size,
+                               int64_t metadata_size,
+                               plasmaRPC::ObjectDetails* details) = 0;
+
+  // Seal an object that AllocateForPeer created. Returns false if there is no
+  // such object.
+  virtual bool SealForPeer(const ObjectID& object_id) = 0;
+
+  // Free an object that AllocateForPeer created and that was not sealed.
+  // Returns false if there is no such object.
+  virtual bool AbortForPeer(const ObjectID& object_id) = 0;
+};
+
 class RpcServiceImpl : public plasmaRPC::RemoteObjectShare::Service {
  public:
   RpcServiceImpl(PlasmaStoreInfo* plasma_store_info, std::mutex* mutex);
 
+  // Without a handler, the remote store can not create objects here. It must
+  // be set before the server runs.
+  void SetPeerObjectHandler(PeerObjectHandler* handler) { handler_ = handler; }
+
  private:
   grpc::Status GetObjects(grpc::ServerContext* context, const plasmaRPC::ObjectIDs* request,
                   plasmaRPC::ObjectDetailsList* response) override;
 
+  grpc::Status AllocateObject(grpc::ServerContext* context,
+                              const plasmaRPC::ObjectDetails* request,
+                              plasmaRPC::ObjectDetails* response) override;
+
+  grpc::Status SealObjects(grpc::ServerContext* context,
+                           const plasmaRPC::ObjectIDs* request,
+                           plasmaRPC::ObjectDetailsList* response) override;
+
+  grpc::Status AbortObjects(grpc::ServerContext* context,
+                            const plasmaRPC::ObjectIDs* request,
+                            plasmaRPC::ObjectDetailsList* response) override;
+
   // std::unique_ptr<PlasmaStoreInfo> plasma_store_info_;
   PlasmaStoreInfo* plasma_store_info_;
   std::mutex* mutex_;
+  PeerObjectHandler* handler_;
 };
 
 class RpcClient {
@@ -33,14 +73,89 @@ class RpcClient {
   // Assembles the client's payload, sends it and presents the response back
   // from the server.
   plasmaRPC::ObjectDetailsList GetObjects(std::vector<ObjectID> object_ids);
+  // Like the above, with the request and the response allocated in arena.
+  plasmaRPC::ObjectDetailsList* GetObjects(const std::vector<ObjectID>& object_ids,
+                                           google::protobuf::Arena* arena);
   plasmaRPC::ObjectDetails GetObject(const ObjectID& object_id) {
     return *GetObjects({object_id}).mutable_objects_details(0);
   }
 
+  // Create an object in the region of the remote store. The status of the
+  // result is OUT_OF_MEMORY if the RPC fails.
+  plasmaRPC::ObjectDetails AllocateObject(const ObjectID& object_id, int64_t data_size,
+                                          int64_t metadata_size);
+  // Seal or free objects that AllocateObject created. Returns false if the RPC
+  // fails or the remote store did not have all of them.
+  bool SealObjects(const std::vector<ObjectID>& object_ids);
+  bool AbortObjects(const std::vector<ObjectID>& object_ids);
+
  private:
+  // Sends the IDs of objects that AllocateObject created with rpc.
+  template <typename Rpc>
+  bool UpdateObjects(const std::vector<ObjectID>& object_ids, Rpc rpc);
+
   std::unique_ptr<plasmaRPC::RemoteObjectShare::Stub> stub_;
 };
 
+// Gathers the lookups of objects in the remote store that arrive within a
+// window, and sends them to it in one RPC. It runs on the event loop of the
+// store, like everything that uses it.
+class RemoteLookupBatcher {
+ public:
+  // Called with the details of the objects of a lookup, in the order of its
+  // IDs. If the RPC fails, the objects are reported missing.
+  using Callback =
+      std::function<void(const std::vector<const plasmaRPC::ObjectDetails*>& details)>;
+
+  RemoteLookupBatcher(RpcClient* client, EventLoop* loop);
+
+  // How many milliseconds lookups are gathered for. With 0, the lookups that
+  // arrive in one iteration of the event loop are sent together. With -1,
+  // every lookup is sent on its own.
+  void SetWindow(int64_t window_ms) { window_ms_ = window_ms; }
+
+  // Look up object_ids in the remote store and call callback with the result.
+  // The callback may be called before Lookup returns.
+  //
+  // owner identifies the lookup for Cancel.
+  void Lookup(const std::vector<ObjectID>& object_ids, const void* owner,
+              Callback callback);
+
+  // Drop the lookups of owner that were not answered yet, without calling
+  // their callbacks.
+  void Cancel(const void* owner);
+
+  // Send the lookups that are waiting now.
+  void Flush();
+
+  std::string DebugString() const;
+
+ private:
+  struct PendingLookup {
+    const void* owner;
+    size_t first;
+    size_t count;
+    Callback callback;
+  };
+
+  // Lookups of more objects are sent without waiting for the window.
+  static constexpr size_t kMaxBatchSize = 4096;
+
+  RpcClient* client_;
+  EventLoop* loop_;
+  int64_t window_ms_;
+  int64_t timer_;
+  // The IDs of the waiting lookups, back to back.
+  std::vector<ObjectID> object_ids_;
+  std::vector<PendingLookup> pending_;
+  // The lookups of the RPCs whose callbacks are running. A callback can flush
+  // again, e.g. to answer a request right away.
+  std::vector<std::vector<PendingLookup>*> in_flight_;
+  plasmaRPC::ObjectDetails missing_;
+  int64_t num_lookups_;
+  int64_t num_rpcs_;
+};
+
 void RunRpcServer(RpcServiceImpl& service, const std::string& local_address);
 
 } // namespace plasma
\ No newline at end of file
@@ -32,22 +32,31 @@
 #include <fcntl.h>
 #include <getopt.h>
 #include <limits.h>
+#include <poll.h>
 #include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/ioctl.h>
+#include <sys/eventfd.h>
 #include <sys/mman.h>
 #include <sys/socket.h>
+#include <sys/stat.h>
 #include <sys/statvfs.h>
 #include <sys/types.h>
 #include <sys/un.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
 #include <ctime>
 #include <deque>
 #include <iostream>
 #include <memory>
+#include <new>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -59,6 +68,7 @@
 #include <grpcpp/grpcpp.h>
 
 #include "arrow/status.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/config.h"
 
 #include "plasma/common.h"
@@ -82,51 +92,378 @@ using arrow::util::ArrowLogLevel;
 
 namespace fb = plasma::flatbuf;
 
+#ifdef PLASMA_COUNT_ALLOCATIONS
+// The heap allocations of the store are counted, so that the debug string can
+// show how many requests cost. Only builds for bench_allocations count them
+// (-DARROW_PLASMA_COUNT_ALLOCATIONS=ON).
+static std::atomic<int64_t> num_heap_allocations(0);
+
+void* operator new(std::size_t size) {
+  num_heap_allocations.fetch_add(1, std::memory_order_relaxed);
+  void* pointer = std::malloc(size == 0 ? 1 : size);
+  if (pointer == nullptr) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+void* operator new[](std::size_t size) { return operator new(size); }
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+#endif
+
 namespace plasma {
 
 void SetMallocGranularity(int value);
 
 struct GetRequest {
-  GetRequest(Client* client, const std::vector<ObjectID>& object_ids);
+  /// Prepare the request, which may have served another get before, for a get
+  /// of object_ids by client.
+  void Reset(Client* client, const std::vector<ObjectID>& object_ids,
+             uint64_t request_id);
+  /// Set the object information of every occurrence of object_id.
+  void SetObject(const ObjectID& object_id, const PlasmaObject& object);
   /// The client that called get.
   Client* client;
+  /// The request_id the client sent with the get, echoed in the reply.
+  uint64_t request_id;
   /// The ID of the timer that will time out and cause this wait to return to
   ///  the client if it hasn't already returned.
   int64_t timer;
   /// The object IDs involved in this request. This is used in the reply.
   std::vector<ObjectID> object_ids;
-  /// The object information for the objects in this request. This is used in
-  /// the reply.
-  std::unordered_map<ObjectID, PlasmaObject> objects;
+  /// The object information for the objects in this request, in the order of
+  /// object_ids. This is used in the reply.
+  std::vector<PlasmaObject> objects;
   /// The minimum number of objects to wait for in this request.
   int64_t num_objects_to_wait_for;
   /// The number of object requests in this wait request that are already
   /// satisfied.
   int64_t num_satisfied;
+  /// Scratch space of Reset and of the reply. It stays with the request, so
+  /// that a pooled request does not allocate it again.
+  std::vector<ObjectID> sorted_ids;
+  std::vector<int> store_fds;
+  std::vector<int64_t> mmap_sizes;
+  std::vector<int64_t> leases;
 };
 
-GetRequest::GetRequest(Client* client, const std::vector<ObjectID>& object_ids)
-    : client(client),
-      timer(-1),
-      object_ids(object_ids.begin(), object_ids.end()),
-      objects(object_ids.size()),
-      num_satisfied(0) {
-  std::unordered_set<ObjectID> unique_ids(object_ids.begin(), object_ids.end());
-  num_objects_to_wait_for = unique_ids.size();
+void GetRequest::Reset(Client* client, const std::vector<ObjectID>& object_ids,
+                       uint64_t request_id) {
+  this->client = client;
+  this->request_id = request_id;
+  timer = -1;
+  this->object_ids.assign(object_ids.begin(), object_ids.end());
+  objects.assign(object_ids.size(), PlasmaObject());
+  num_satisfied = 0;
+  sorted_ids.assign(object_ids.begin(), object_ids.end());
+  auto less = [](const ObjectID& a, const ObjectID& b) {
+    return std::memcmp(a.data(), b.data(), kUniqueIDSize) < 0;
+  };
+  std::sort(sorted_ids.begin(), sorted_ids.end(), less);
+  num_objects_to_wait_for =
+      std::unique(sorted_ids.begin(), sorted_ids.end()) - sorted_ids.begin();
+}
+
+void GetRequest::SetObject(const ObjectID& object_id, const PlasmaObject& object) {
+  for (size_t i = 0; i < object_ids.size(); ++i) {
+    if (object_ids[i] == object_id) {
+      objects[i] = object;
+    }
+  }
 }
 
+/// Answered get requests beyond this many are freed rather than pooled.
+constexpr size_t kMaxPooledGetRequests = 1024;
+/// Get requests of more objects than this are freed rather than pooled, so
+/// that the pool does not keep the memory of a few large gets.
+constexpr size_t kMaxPooledGetRequestSize = 1024;
+
+/// A create that waits for the remote store to tell whether its object
+/// exists there.
+struct CreateRequest {
+  /// PlasmaCreateRequest or PlasmaCreateStreamRequest.
+  fb::MessageType type;
+  ObjectID object_id;
+  bool evict_if_full;
+  int64_t data_size;
+  int64_t metadata_size;
+  int device_num;
+  /// The request_id the client sent with the create, echoed in the reply.
+  uint64_t request_id;
+};
+
+/// A create and seal of one or more objects that waits for the remote store
+/// to tell whether they exist there.
+struct CreateAndSealRequest {
+  /// Whether the client sent a batch, which is answered with a batch reply.
+  bool batch;
+  bool evict_if_full;
+  std::vector<ObjectID> object_ids;
+  std::vector<std::string> data;
+  std::vector<std::string> metadata;
+  std::vector<std::string> digests;
+};
+
+struct StreamWaitRequest {
+  StreamWaitRequest(Client* client, const ObjectID& object_id, int64_t stream_size)
+      : client(client), object_id(object_id), stream_size(stream_size), timer(-1) {}
+  /// The client that is waiting.
+  Client* client;
+  /// The object the client waits for.
+  ObjectID object_id;
+  /// The number of bytes of the object the client has seen already.
+  int64_t stream_size;
+  /// The ID of the timer that will time out and cause this wait to return to
+  /// the client if it hasn't already returned.
+  int64_t timer;
+};
+
+/// How often the remote store is first asked about the objects of wait
+/// requests. The interval doubles, up to the maximum, while none of them turns
+/// up there.
+constexpr int64_t kRemoteWaitPollIntervalMs = 10;
+constexpr int64_t kMaxRemoteWaitPollIntervalMs = 1000;
+
+/// How often the memory in use is checked against the eviction watermarks.
+constexpr int64_t kWatermarkCheckIntervalMs = 10;
+
+/// How often the records of the trace are written out, so that a store that
+/// is killed loses at most this much of it.
+constexpr int64_t kTraceFlushIntervalMs = 1000;
+
+/// The bytes a client of weight 1 may spend in each round of fair queuing. A
+/// request costs kRequestCost, plus the size of the object for a create.
+constexpr int64_t kQuantumBytes = 1 << 20;
+constexpr int64_t kRequestCost = 4096;
+
+/// Whether the socket of a client has a request, or its end, to read.
+bool HasInput(int fd) {
+  struct pollfd poll_fd = {fd, POLLIN, 0};
+  return poll(&poll_fd, 1, 0) > 0;
+}
+
+/// Creates in the remote region of at least this size go through the token
+/// bucket, which holds at most this long a burst at its rate.
+constexpr int64_t kLargeCreateBytes = 1 << 20;
+constexpr int64_t kTokenBucketBurstMs = 100;
+
+/// How long the dispatch timer sleeps when no request is queued. It is removed
+/// and added again when one is, rather than ended, since the loop only frees
+/// the callback of a timer that is removed.
+constexpr int kDispatchIdleMs = 1000;
+
+/// How soon notifications that did not fit into the ring of a subscriber are
+/// tried again, and how long the retry timer sleeps when all of them fit.
+constexpr int kRingRetryMs = 1;
+constexpr int kRingRetryIdleMs = 1000;
+
+/// A page of a listing looks at no more objects than this, or its page size,
+/// so that a filter that matches few objects does not block the loop either.
+constexpr int64_t kListScanObjects = 1 << 16;
+
+/// A listing cursor holds the slot in the object table to go on from in its
+/// low bits, and the generation of the table above them. The top bit is left
+/// to the client, which uses it for the remote region.
+constexpr int kListCursorIndexBits = 40;
+constexpr uint64_t kListCursorGenerationMask = (uint64_t(1) << 23) - 1;
+
+/// Objects that compress to more than this fraction of their size are evicted
+/// instead, since decompressing them on the next get costs more than it saves.
+constexpr double kMaxCompressedFraction = 0.75;
+
+uint64_t DigestKey(const ObjectTableEntry* entry) {
+  uint64_t key;
+  std::memcpy(&key, &entry->digest[0], sizeof(key));
+  return key;
+}
+
+/// Sent notifications beyond this many per subscriber are freed rather than
+/// kept for reuse.
+constexpr size_t kMaxFreeNotificationBuffers = 64;
+
+/// Map the notification ring a subscriber sent into its queue. The ring must
+/// be sealed against shrinking, so that the subscriber can not make the store
+/// fault on it.
+Status MapNotificationRing(int ring_fd, NotificationQueue* queue) {
+  int seals = fcntl(ring_fd, F_GET_SEALS);
+  if (seals < 0 || (seals & F_SEAL_SHRINK) == 0) {
+    return Status::Invalid("the notification ring is not sealed against shrinking");
+  }
+  struct stat stat_buf;
+  if (fstat(ring_fd, &stat_buf) != 0) {
+    return Status::IOError("fstat failed: ", std::strerror(errno));
+  }
+  void* pointer =
+      mmap(nullptr, stat_buf.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, ring_fd, 0);
+  if (pointer == MAP_FAILED) {
+    return Status::IOError("mmap failed: ", std::strerror(errno));
+  }
+  auto ring = NotificationRing::Open(static_cast<uint8_t*>(pointer), stat_buf.st_size);
+  if (ring == nullptr) {
+    munmap(pointer, stat_buf.st_size);
+    return Status::Invalid("no notification ring in the memory of the subscriber");
+  }
+  queue->ring = std::move(ring);
+  queue->ring_pointer = static_cast<uint8_t*>(pointer);
+  queue->ring_size = stat_buf.st_size;
+  return Status::OK();
+}
+
+struct WaitRequest {
+  WaitRequest(Client* client, const std::vector<ObjectID>& object_ids,
+              int64_t num_ready_objects);
+  /// The client that called wait.
+  Client* client;
+  /// The ID of the timer that will time out and cause this wait to return to
+  /// the client if it hasn't already returned.
+  int64_t timer;
+  /// The object IDs involved in this request, without duplicates.
+  std::vector<ObjectID> object_ids;
+  /// The objects of this request that are sealed.
+  std::unordered_set<ObjectID> ready;
+  /// The number of ready objects to wait for.
+  int64_t num_ready_objects;
+};
+
+WaitRequest::WaitRequest(Client* client, const std::vector<ObjectID>& object_ids,
+                         int64_t num_ready_objects)
+    : client(client), timer(-1) {
+  std::unordered_set<ObjectID> unique_ids;
+  for (const auto& object_id : object_ids) {
+    if (unique_ids.insert(object_id).second) {
+      this->object_ids.push_back(object_id);
+    }
+  }
+  this->num_ready_objects =
+      std::min(num_ready_objects, static_cast<int64_t>(this->object_ids.size()));
+}
+
+/// A task of the RPC thread for the event loop, see PlasmaStore::RunOnLoop.
+struct LoopTask {
+  std::function<void()> run;
+  /// Held while the task runs, and to look at done and cancelled.
+  std::mutex mutex;
+  std::condition_variable done_cond;
+  bool done = false;
+  /// Set when the RPC thread stopped waiting, so that the loop skips the task.
+  bool cancelled = false;
+};
+
+/// How long a request of the remote store waits for the event loop. Both
+/// stores may wait for an RPC to the other one on their loops at the same
+/// time, so the wait has to end.
+constexpr int64_t kPeerRequestTimeoutMs = 1000;
+
 Client::Client(int fd) : fd(fd), notification_fd(-1) {}
 
 PlasmaStore::PlasmaStore(EventLoop* loop, std::string directory, bool hugepages_enabled,
                          const std::string& socket_name,
                          std::shared_ptr<ExternalStore> external_store,
-                         const std::string& local_address, const std::string& remote_address)
+                         const CompressionTierOptions& compression, bool deduplicate,
+                         bool recover, int64_t lookup_window_ms,
+                         bool remote_allocation, const EvictionWatermarks& watermarks,
+                         const SchedulingOptions& scheduling,
+                         const std::string& trace_path, const std::string& local_address,
+                         const std::string& remote_address)
     : loop_(loop),
+      remote_lookups_(&rpc_client_, loop),
       rpc_service_(&store_info_, &mutex_),
+      loop_tasks_fd_(-1),
+      remote_allocation_(remote_allocation),
+      peer_client_(-1),
+      num_remote_allocations_(0),
+      num_peer_allocations_(0),
+      num_peer_timeouts_(0),
       eviction_policy_(&store_info_, PlasmaAllocator::GetFootprintLimit()),
-      external_store_(external_store) {
+      remote_poll_timer_(-1),
+      remote_poll_interval_ms_(kRemoteWaitPollIntervalMs),
+      remote_poll_in_flight_(false),
+      external_store_(external_store),
+      compression_(compression),
+      compressed_objects_("compressed lru", compression.capacity),
+      num_compressions_(0),
+      num_decompressions_(0),
+      num_incompressible_(0),
+      num_compressions_without_room_(0),
+      deduplicate_(deduplicate),
+      num_deduplicated_(0),
+      dedup_bytes_saved_(0),
+      num_digest_collisions_(0),
+      num_node_local_allocations_(0),
+      num_node_remote_allocations_(0),
+      watermarks_(watermarks),
+      watermark_timer_(-1),
+      num_background_evictions_(0),
+      background_bytes_evicted_(0),
+      num_inline_evictions_(0),
+      scheduling_(scheduling),
+      fair_queue_(kQuantumBytes),
+      dispatch_timer_(-1),
+      dispatch_sleeps_(false),
+      remote_tokens_(scheduling.remote_bytes_per_second * kTokenBucketBurstMs / 1000),
+      last_refill_(std::chrono::steady_clock::now()),
+      num_queued_requests_(0),
+      num_waited_for_tokens_(0),
+      remote_bytes_admitted_(0),
+      ring_retry_timer_(-1),
+      ring_retry_sleeps_(false),
+      num_ring_notifications_(0),
+      num_ring_wakeups_(0),
+      num_region_grows_(0),
+      region_bytes_grown_(0),
+      num_list_pages_(0),
+      num_listed_objects_(0),
+      num_list_restarts_(0) {
   store_info_.directory = directory;
   store_info_.hugepages_enabled = hugepages_enabled;
+  remote_lookups_.SetWindow(lookup_window_ms);
+  // The allocator leaves the start of the region to the directory and the
+  // lease table, which has as many slots.
+  auto base_pointer = static_cast<uint8_t*>(PlasmaAllocator::GetBasePointer());
+  // The directory is sized for the largest the region may grow to, since it
+  // can not move once clients read it.
+  const int64_t capacity =
+      ObjectDirectory::CapacityForRegion(PlasmaAllocator::GetMaxFootprintLimit());
+  std::vector<ObjectDirectory::RecoveredObject> recovered_objects;
+  if (recover) {
+    object_directory_ =
+        ObjectDirectory::Recover(base_pointer, capacity, &recovered_objects);
+    if (object_directory_ == nullptr) {
+      ARROW_LOG(WARNING) << "no object directory to recover in the region, "
+                         << "starting with an empty store";
+    }
+  }
+  if (object_directory_ == nullptr) {
+    object_directory_ = ObjectDirectory::Create(base_pointer, capacity);
+  }
+  // The clients of a previous store are gone, and their leases with them.
+  object_directory_->SetMaxRegionSize(PlasmaAllocator::GetMaxFootprintLimit());
+  lease_table_ = LeaseTable::Create(base_pointer + object_directory_->size(), capacity);
+  RecoverObjects(recovered_objects);
+
+  // The remote store creates objects here through the event loop, which the
+  // RPC thread wakes up with an eventfd.
+  loop_tasks_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  ARROW_CHECK(loop_tasks_fd_ >= 0) << "eventfd failed: " << std::strerror(errno);
+  loop_->AddFileEvent(loop_tasks_fd_, kEventLoopRead,
+                      [this](int events) { RunLoopTasks(); });
+  rpc_service_.SetPeerObjectHandler(this);
+
+  if (watermarks_.high > 0) {
+    watermark_timer_ = loop_->AddTimer(kWatermarkCheckIntervalMs, [this](int64_t timer_id) {
+      return EvictToLowWatermark();
+    });
+  }
+
+  if (!trace_path.empty()) {
+    ARROW_CHECK_OK(TraceWriter::Open(trace_path, &trace_));
+    loop_->AddTimer(kTraceFlushIntervalMs,
+                    [this](int64_t timer_id) { return FlushTrace(); });
+    ARROW_LOG(INFO) << "Recording the requests of the clients to " << trace_path;
+  }
 
   rpc_thread_ = std::thread(RunRpcServer, std::ref(rpc_service_), std::ref(local_address));
   rpc_thread_.detach();
@@ -139,7 +476,17 @@ PlasmaStore::PlasmaStore(EventLoop* loop, std::string directory, bool hugepages_
 }
 
 // TODO(pcm): Get rid of this destructor by using RAII to clean up data.
-PlasmaStore::~PlasmaStore() {}
+PlasmaStore::~PlasmaStore() {
+  for (GetRequest* get_request : get_request_pool_) {
+    delete get_request;
+  }
+  for (auto& entry : pending_notifications_) {
+    if (entry.second.ring_pointer != nullptr) {
+      munmap(entry.second.ring_pointer, entry.second.ring_size);
+    }
+  }
+  close(loop_tasks_fd_);
+}
 
 const PlasmaStoreInfo* PlasmaStore::GetPlasmaStoreInfo() { return &store_info_; }
 
@@ -192,8 +539,9 @@ uint8_t* PlasmaStore::AllocateMemory(size_t size, bool evict_if_full, int* fd,
     // plasma_client.cc). Note that even though this pointer is 64-byte aligned,
     // it is not guaranteed that the corresponding pointer in the client will be
     // 64-byte aligned, but in practice it often will be.
-    pointer = reinterpret_cast<uint8_t*>(
-                PlasmaAllocator::Memalign(kBlockSize, size, fd, map_size, offset));
+    pointer = reinterpret_cast<uint8_t*>(PlasmaAllocator::Memalign(
+        kBlockSize, size, fd, map_size, offset,
+        client != nullptr ? client->numa_node : -1));
     if (pointer || !evict_if_full) {
       // If we manage to allocate the memory, return the pointer. If we cannot
       // allocate the space, but we are also not allowed to evict anything to
@@ -201,16 +549,37 @@ uint8_t* PlasmaStore::AllocateMemory(size_t size, bool evict_if_full, int* fd,
       break;
     }
     // Tell the eviction policy how much space we need to create this object.
+    if (is_create) {
+      num_inline_evictions_ += 1;
+    }
     std::vector<ObjectID> objects_to_evict;
     bool success = eviction_policy_.RequireSpace(size, &objects_to_evict);
+    CompressObjects(&objects_to_evict);
     EvictObjects(objects_to_evict);
     // Return an error to the client if not enough space could be freed to
     // create the object.
     if (!success) {
+      // Objects that clients only hold idle leases on look in use to the
+      // eviction policy. Take the leases back and try again.
+      if (RevokeAllIdleLeases() > 0) {
+        continue;
+      }
+      // Compressed objects are not known to the eviction policy either.
+      if (DropCompressedObjects(size) > 0) {
+        continue;
+      }
       break;
     }
   }
 
+  if (pointer != nullptr && client != nullptr && client->numa_node != -1) {
+    if (PlasmaAllocator::GetNumaNode(*offset) == client->numa_node) {
+      num_node_local_allocations_ += 1;
+    } else if (PlasmaAllocator::GetNumaNode(*offset) != -1) {
+      num_node_remote_allocations_ += 1;
+    }
+  }
+
   if (pointer != nullptr) {
     // GetMallocMapinfo(pointer, fd, map_size, offset);
     ARROW_CHECK(*fd != -1);
@@ -246,8 +615,7 @@ void PlasmaStore::AddObjectTableEntry(const ObjectID& object_id, int64_t data_si
                                       uint8_t* pointer, int fd, int64_t map_size, ptrdiff_t offset, 
                                       int device_num, PlasmaObject* result) {
   std::lock_guard<std::mutex> lock(mutex_);
-  auto ptr = std::unique_ptr<ObjectTableEntry>(new ObjectTableEntry());
-  auto entry = store_info_.objects.emplace(object_id, std::move(ptr)).first->second.get();
+  auto entry = &store_info_.objects.emplace(object_id).first->second;
   entry->data_size = data_size;
   entry->metadata_size = metadata_size;
   entry->pointer = pointer;
@@ -272,7 +640,7 @@ PlasmaError PlasmaStore::CreateObject(const ObjectID& object_id, bool evict_if_f
                                       PlasmaObject* result) {
   ARROW_LOG(DEBUG) << "creating object " << object_id.hex();
 
-  if (ObjectExists(object_id)) {
+  if (GetObjectTableEntry(&store_info_, object_id) != nullptr) {
     // There is already an object with the same ID in the Plasma Store, so
     // ignore this request.
     return PlasmaError::ObjectExists;
@@ -312,6 +680,8 @@ PlasmaError PlasmaStore::CreateObject(const ObjectID& object_id, bool evict_if_f
 
   AddObjectTableEntry(object_id, data_size, metadata_size, pointer, fd, map_size, 
                       offset, device_num, result);
+  auto entry = GetObjectTableEntry(&store_info_, object_id);
+  entry->owner = OwnerIndex(client);
 
   result->store_fd = fd;
   result->data_offset = offset;
@@ -324,14 +694,133 @@ PlasmaError PlasmaStore::CreateObject(const ObjectID& object_id, bool evict_if_f
   // eviction policy does not have an opportunity to evict the object.
   eviction_policy_.ObjectCreated(object_id, client, true);
   // Record that this client is using this object.
-  AddToClientObjectIds(object_id, store_info_.objects[object_id].get(), client);
+  AddToClientObjectIds(object_id, entry, client);
+  return PlasmaError::OK;
+}
+
+PlasmaError PlasmaStore::CreateStream(const ObjectID& object_id, bool evict_if_full,
+                                      int64_t capacity, int64_t metadata_size,
+                                      Client* client, PlasmaObject* result) {
+  PlasmaError error_code = CreateObject(object_id, evict_if_full, capacity, metadata_size,
+                                        /*device_num=*/0, client, result);
+  if (error_code != PlasmaError::OK) {
+    return error_code;
+  }
+  auto entry = GetObjectTableEntry(&store_info_, object_id);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entry->stream_size = 0;
+  }
+  stream_writers_[object_id] = client;
+  // Readers can map the stream right away.
+  UpdateObjectGetRequests(object_id);
+  return PlasmaError::OK;
+}
+
+PlasmaError PlasmaStore::CreateView(const ObjectID& parent_id, int64_t offset,
+                                    int64_t length, const ObjectID& object_id,
+                                    Client* client) {
+  if (GetObjectTableEntry(&store_info_, object_id) != nullptr) {
+    return PlasmaError::ObjectExists;
+  }
+  auto parent = GetObjectTableEntry(&store_info_, parent_id);
+  if (parent != nullptr && parent->state == ObjectState::PLASMA_COMPRESSED) {
+    Status s = DecompressObject(parent_id, parent, client);
+    if (!s.ok()) {
+      return s.IsOutOfMemory() ? PlasmaError::OutOfMemory : PlasmaError::ObjectNotFound;
+    }
+  }
+  if (parent == nullptr || parent->state == ObjectState::PLASMA_EVICTED) {
+    return PlasmaError::ObjectNotFound;
+  }
+  if (parent->state != ObjectState::PLASMA_SEALED) {
+    return PlasmaError::ObjectNotSealed;
+  }
+  const int64_t parent_size =
+      parent->stream_size != -1 ? parent->stream_size : parent->data_size;
+  if (parent->device_num != 0 || offset < 0 || length < 0 ||
+      offset > parent_size - length) {
+    return PlasmaError::InvalidView;
+  }
+
+  // The view keeps its parent, and the memory of both, in the store.
+  if (parent->ref_count == 0) {
+    eviction_policy_.BeginObjectAccess(parent_id);
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    parent->ref_count++;
+  }
+  view_parents_.emplace(object_id, parent_id);
+  PlasmaObject result = {};
+  AddObjectTableEntry(object_id, length, 0, parent->pointer, parent->fd,
+                      parent->map_size, parent->offset + offset, 0, &result);
+  GetObjectTableEntry(&store_info_, object_id)->owner = OwnerIndex(client);
+  eviction_policy_.ObjectCreated(object_id, client, false);
+  SealObjects({object_id}, {std::string(kDigestSize, 0)});
+  return PlasmaError::OK;
+}
+
+PlasmaError PlasmaStore::CreateRemoteObject(const ObjectID& object_id, int64_t data_size,
+                                            int64_t metadata_size, Client* client,
+                                            PlasmaObject* result) {
+  plasmaRPC::ObjectDetails details =
+      rpc_client_.AllocateObject(object_id, data_size, metadata_size);
+  switch (details.status()) {
+    case plasmaRPC::ObjectDetails::OK:
+      break;
+    case plasmaRPC::ObjectDetails::EXISTS:
+      return PlasmaError::ObjectExists;
+    default:
+      return PlasmaError::OutOfMemory;
+  }
+  const auto& rpc_object = details.object();
+  // Mark remote object with store_fd = -1, in accordance with Client::MmapRemoteMemory
+  result->store_fd = -1;
+  result->data_offset = rpc_object.data_offset();
+  result->metadata_offset = rpc_object.metadata_offset();
+  result->data_size = rpc_object.data_size();
+  result->metadata_size = rpc_object.metadata_size();
+  result->device_num = 0;
+  remote_creates_[object_id] = {client, *result, false};
+  num_remote_allocations_ += 1;
+  ARROW_LOG(DEBUG) << "created object " << object_id.hex() << " in the remote region";
   return PlasmaError::OK;
 }
 
+bool PlasmaStore::SealRemoteObject(const ObjectID& object_id) {
+  auto it = remote_creates_.find(object_id);
+  ARROW_CHECK(it != remote_creates_.end());
+  if (!rpc_client_.SealObjects({object_id})) {
+    return false;
+  }
+  it->second.sealed = true;
+  const PlasmaObject object = it->second.object;
+
+  // The object is in no table here, so the get requests waiting for it get
+  // it like one the remote store had all along.
+  auto get_requests = object_get_requests_.find(object_id);
+  if (get_requests != object_get_requests_.end()) {
+    // ReturnFromGet removes the requests it replies to, so iterate over a copy.
+    std::vector<GetRequest*> waiting = get_requests->second;
+    object_get_requests_.erase(get_requests);
+    for (GetRequest* get_req : waiting) {
+      get_req->SetObject(object_id, object);
+      get_req->num_satisfied += 1;
+      if (get_req->num_satisfied == get_req->num_objects_to_wait_for) {
+        ReturnFromGet(get_req);
+      }
+    }
+  }
+  UpdateObjectWaitRequests(object_id);
+  return true;
+}
+
 void PlasmaObject_init(PlasmaObject* object, const ObjectTableEntry* entry) {
   DCHECK(object != nullptr);
   DCHECK(entry != nullptr);
-  DCHECK(entry->state == ObjectState::PLASMA_SEALED);
+  // Open streams can be read while they are written.
+  DCHECK(entry->state == ObjectState::PLASMA_SEALED || entry->stream_size != -1);
 #ifdef PLASMA_CUDA
   if (entry->device_num != 0) {
     object->ipc_handle = entry->ipc_handle;
@@ -340,7 +829,13 @@ void PlasmaObject_init(PlasmaObject* object, const ObjectTableEntry* entry) {
   object->store_fd = entry->fd;
   object->data_offset = entry->offset;
   object->metadata_offset = entry->offset + entry->data_size;
-  object->data_size = entry->data_size;
+  // A sealed stream is as long as what was published to it, while an open one
+  // spans all of its capacity.
+  if (entry->state == ObjectState::PLASMA_SEALED && entry->stream_size != -1) {
+    object->data_size = entry->stream_size;
+  } else {
+    object->data_size = entry->data_size;
+  }
   object->metadata_size = entry->metadata_size;
   object->device_num = entry->device_num;
 }
@@ -368,7 +863,29 @@ void PlasmaStore::RemoveGetRequest(GetRequest* get_request) {
   if (get_request->timer != -1) {
     ARROW_CHECK(loop_->RemoveTimer(get_request->timer) == kEventLoopOk);
   }
-  delete get_request;
+  if (remote_lookup_gets_.erase(get_request) > 0) {
+    remote_lookups_.Cancel(get_request);
+  }
+  if (get_request_pool_.size() < kMaxPooledGetRequests &&
+      get_request->object_ids.capacity() <= kMaxPooledGetRequestSize) {
+    get_request_pool_.push_back(get_request);
+  } else {
+    delete get_request;
+  }
+}
+
+GetRequest* PlasmaStore::NewGetRequest(Client* client,
+                                       const std::vector<ObjectID>& object_ids,
+                                       uint64_t request_id) {
+  GetRequest* get_request;
+  if (get_request_pool_.empty()) {
+    get_request = new GetRequest();
+  } else {
+    get_request = get_request_pool_.back();
+    get_request_pool_.pop_back();
+  }
+  get_request->Reset(client, object_ids, request_id);
+  return get_request;
 }
 
 void PlasmaStore::RemoveGetRequestsForClient(Client* client) {
@@ -380,33 +897,61 @@ void PlasmaStore::RemoveGetRequestsForClient(Client* client) {
       }
     }
   }
+  for (GetRequest* get_request : remote_lookup_gets_) {
+    if (get_request->client == client) {
+      get_requests_to_remove.insert(get_request);
+    }
+  }
 
-  // It shouldn't be possible for a given client to be in the middle of multiple get
+  // A client that pipelines its requests can be in the middle of several get
   // requests.
-  ARROW_CHECK(get_requests_to_remove.size() <= 1);
   for (GetRequest* get_request : get_requests_to_remove) {
     RemoveGetRequest(get_request);
   }
 }
 
 void PlasmaStore::ReturnFromGet(GetRequest* get_req) {
-  // Figure out how many file descriptors we need to send.
-  std::unordered_set<int> fds_to_send;
-  std::vector<int> store_fds;
-  std::vector<int64_t> mmap_sizes;
-  for (const auto& object_id : get_req->object_ids) {
-    PlasmaObject& object = get_req->objects[object_id];
+  // Figure out how many file descriptors we need to send. There are only a few
+  // of them, so a linear search is cheaper than a set.
+  std::vector<int>& store_fds = get_req->store_fds;
+  std::vector<int64_t>& mmap_sizes = get_req->mmap_sizes;
+  store_fds.clear();
+  mmap_sizes.clear();
+  for (const auto& object : get_req->objects) {
     int fd = object.store_fd;
-    if (object.data_size != -1 && fds_to_send.count(fd) == 0 && fd != -1) {
-      fds_to_send.insert(fd);
+    if (object.data_size != -1 && fd != -1 &&
+        std::find(store_fds.begin(), store_fds.end(), fd) == store_fds.end()) {
       store_fds.push_back(fd);
       mmap_sizes.push_back(GetMmapSize(fd));
     }
   }
 
+  // Lease the sealed objects in the region to the client, so that it can keep
+  // them after it is done with them.
+  std::vector<int64_t>& leases = get_req->leases;
+  leases.assign(get_req->object_ids.size(), kNoLease);
+  bool any_lease = false;
+  for (size_t i = 0; i < get_req->object_ids.size(); ++i) {
+    const ObjectID& object_id = get_req->object_ids[i];
+    const PlasmaObject& object = get_req->objects[i];
+    if (object.data_size == -1 || object.store_fd == -1 || object.device_num != 0) {
+      continue;
+    }
+    auto entry = GetObjectTableEntry(&store_info_, object_id);
+    if (entry == nullptr || entry->state != ObjectState::PLASMA_SEALED) {
+      continue;
+    }
+    leases[i] = GrantLease(object_id, get_req->client);
+    any_lease |= leases[i] != kNoLease;
+  }
+  if (!any_lease) {
+    leases.clear();
+  }
+
   // Send the get reply to the client.
-  Status s = SendGetReply(get_req->client->fd, &get_req->object_ids[0], get_req->objects,
-                          get_req->object_ids.size(), store_fds, mmap_sizes);
+  Status s = SendGetReply(get_req->client->fd, get_req->object_ids.data(),
+                          get_req->objects.data(), get_req->object_ids.size(), store_fds,
+                          mmap_sizes, get_req->request_id, leases);
   WarnIfSigpipe(s.ok() ? 0 : -1, get_req->client->fd);
   // If we successfully sent the get reply message to the client, then also send
   // the file descriptors.
@@ -446,7 +991,9 @@ void PlasmaStore::UpdateObjectGetRequests(const ObjectID& object_id) {
     auto entry = GetObjectTableEntry(&store_info_, object_id);
     ARROW_CHECK(entry != nullptr);
 
-    PlasmaObject_init(&get_req->objects[object_id], entry);
+    PlasmaObject object = {};
+    PlasmaObject_init(&object, entry);
+    get_req->SetObject(object_id, object);
     get_req->num_satisfied += 1;
     // Record the fact that this client will be using this object and will
     // be responsible for releasing this object.
@@ -472,21 +1019,130 @@ void PlasmaStore::UpdateObjectGetRequests(const ObjectID& object_id) {
   }
 }
 
+/// Whether an object is one a listing with the filter returns. The owner is
+/// the index of the name of filter.owner, or -1 for any owner.
+bool MatchesListFilter(const ObjectListFilter& filter, int32_t owner, int64_t now,
+                       const ObjectTableEntry& entry) {
+  if (filter.state_mask != 0 &&
+      (filter.state_mask & (1 << static_cast<int>(entry.state))) == 0) {
+    return false;
+  }
+  const int64_t size = entry.data_size + entry.metadata_size;
+  if (size < filter.min_size || (filter.max_size != -1 && size > filter.max_size)) {
+    return false;
+  }
+  const int64_t age = now - entry.create_time;
+  if (age < filter.min_age || (filter.max_age != -1 && age > filter.max_age)) {
+    return false;
+  }
+  return owner == -1 || entry.owner == owner;
+}
+
+int32_t PlasmaStore::OwnerIndex(const Client* client) {
+  if (client == nullptr) {
+    return -1;
+  }
+  auto it = owner_indices_.find(client->name);
+  if (it != owner_indices_.end()) {
+    return it->second;
+  }
+  const int32_t index = static_cast<int32_t>(owner_names_.size());
+  owner_names_.push_back(client->name);
+  owner_indices_.emplace(client->name, index);
+  return index;
+}
+
+void PlasmaStore::ProcessListRequest(Client* client, const ObjectListFilter& filter,
+                                     int64_t page_size, uint64_t cursor) {
+  const FlatObjectTable& objects = store_info_.objects;
+  const uint64_t generation =
+      static_cast<uint64_t>(objects.generation()) & kListCursorGenerationMask;
+  int64_t index = 0;
+  bool restarted = false;
+  if (cursor != 0) {
+    // Entries move when the table is rehashed, so a cursor from before that
+    // points nowhere in particular, and the listing starts over.
+    if ((cursor >> kListCursorIndexBits) == generation) {
+      index = static_cast<int64_t>(cursor & ((uint64_t(1) << kListCursorIndexBits) - 1));
+    } else {
+      restarted = true;
+      num_list_restarts_ += 1;
+    }
+  }
+  int32_t owner = -1;
+  auto it = objects.begin_at(index);
+  if (!filter.owner.empty()) {
+    auto owner_index = owner_indices_.find(filter.owner);
+    if (owner_index == owner_indices_.end()) {
+      // No client of that name created an object.
+      it = objects.end();
+    } else {
+      owner = owner_index->second;
+    }
+  }
+  const int64_t now = std::time(nullptr);
+  const int64_t max_scanned = std::max(page_size, kListScanObjects);
+  int64_t num_scanned = 0;
+  std::vector<FlatObjectTable::const_iterator> page;
+  for (; it != objects.end(); ++it) {
+    if (page_size > 0 && (static_cast<int64_t>(page.size()) == page_size ||
+                          num_scanned == max_scanned)) {
+      break;
+    }
+    num_scanned += 1;
+    if (MatchesListFilter(filter, owner, now, it->second)) {
+      page.push_back(it);
+    }
+  }
+  // A page always moves past at least one slot, so the cursor of a listing
+  // that is not done yet is never 0.
+  const uint64_t next_cursor =
+      it == objects.end()
+          ? 0
+          : (generation << kListCursorIndexBits) | static_cast<uint64_t>(it.index());
+  num_list_pages_ += 1;
+  num_listed_objects_ += page.size();
+  Status s = SendListReply(client->fd, page, next_cursor, restarted);
+  WarnIfSigpipe(s.ok() ? 0 : -1, client->fd);
+}
+
+std::string PlasmaStore::ListDebugString() const {
+  std::stringstream result;
+  result << "\n(list) pages sent: " << num_list_pages_;
+  result << "\n(list) objects listed: " << num_listed_objects_;
+  result << "\n(list) listings started over: " << num_list_restarts_;
+  return result.str();
+}
+
 void PlasmaStore::ProcessGetRequest(Client* client,
                                     const std::vector<ObjectID>& object_ids,
-                                    int64_t timeout_ms) {
+                                    int64_t timeout_ms, uint64_t request_id) {
   // Create a get request for this object.
-  auto get_req = new GetRequest(client, object_ids);
+  auto get_req = NewGetRequest(client, object_ids, request_id);
   std::vector<ObjectID> check_remote_ids;
   std::vector<ObjectID> evicted_ids;
   std::vector<ObjectTableEntry*> evicted_entries;
+  // Objects that are not present are sent with a data size of -1.
+  PlasmaObject missing = {};
+  missing.data_size = -1;
   for (auto object_id : object_ids) {
     // Check if this object is already present locally. If so, record that the
     // object is being used and mark it as accounted for.
     auto entry = GetObjectTableEntry(&store_info_, object_id);
-    if (entry && entry->state == ObjectState::PLASMA_SEALED) {
+    if (entry && entry->state == ObjectState::PLASMA_COMPRESSED &&
+        !DecompressObject(object_id, entry, client).ok()) {
+      // Nothing wakes up a get that waits for the object, since it is neither
+      // sealed nor created again, so it is reported missing right away.
+      get_req->SetObject(object_id, missing);
+      get_req->num_satisfied += 1;
+      continue;
+    }
+    if (entry && (entry->state == ObjectState::PLASMA_SEALED ||
+                  stream_writers_.count(object_id) > 0)) {
       // Update the get request to take into account the present object.
-      PlasmaObject_init(&get_req->objects[object_id], entry);
+      PlasmaObject object = {};
+      PlasmaObject_init(&object, entry);
+      get_req->SetObject(object_id, object);
       get_req->num_satisfied += 1;
       // If necessary, record that this client is using this object. In the case
       // where entry == NULL, this will be called from SealObject.
@@ -495,20 +1151,26 @@ void PlasmaStore::ProcessGetRequest(Client* client,
       // Make sure the object pointer is not already allocated
       ARROW_CHECK(!entry->pointer);
 
-      {
-        std::lock_guard<std::mutex> lock(mutex_);
-        entry->pointer =
-          AllocateMemory(entry->data_size + entry->metadata_size, /*evict=*/true,
-                         &entry->fd, &entry->map_size, &entry->offset, client, false);
-      }      
-      if (entry->pointer) {
+      // Making room may evict, compress or drop other objects, which takes
+      // mutex_, so only the entry is updated under it.
+      int fd = -1;
+      int64_t map_size = 0;
+      ptrdiff_t offset = 0;
+      uint8_t* pointer =
+          AllocateMemory(entry->data_size + entry->metadata_size, /*evict=*/true, &fd,
+                         &map_size, &offset, client, false);
+      if (pointer) {
         {
           std::lock_guard<std::mutex> lock(mutex_);
+          entry->pointer = pointer;
+          entry->fd = fd;
+          entry->map_size = map_size;
+          entry->offset = offset;
           entry->state = ObjectState::PLASMA_CREATED;
           entry->create_time = std::time(nullptr);
         }
         eviction_policy_.ObjectCreated(object_id, client, false);
-        AddToClientObjectIds(object_id, store_info_.objects[object_id].get(), client);
+        AddToClientObjectIds(object_id, entry, client);
         evicted_ids.push_back(object_id);
         evicted_entries.push_back(entry);
       } else {
@@ -523,34 +1185,6 @@ void PlasmaStore::ProcessGetRequest(Client* client,
     }
   }
 
-  if (!check_remote_ids.empty()) {
-    plasmaRPC::ObjectDetailsList remote_entries = rpc_client_.GetObjects(check_remote_ids);
-    for (uint i = 0; i < check_remote_ids.size(); i++) {
-      ObjectID object_id = check_remote_ids[i];
-      auto remote_entry = remote_entries.mutable_objects_details(i);
-      if (remote_entry->status() == plasmaRPC::ObjectDetails::OK) {
-        PlasmaObject object;
-        auto rpc_object = remote_entry->object();
-        object.data_offset = rpc_object.data_offset();
-        object.metadata_offset = rpc_object.metadata_offset();
-        object.data_size = rpc_object.data_size();
-        object.metadata_size = rpc_object.metadata_size();
-        object.device_num = rpc_object.device_num();
-        // Mark remote object with store_fd = -1, in accordance with Client::MmapRemoteMemory
-        object.store_fd = -1;
-        get_req->objects[object_id] = object;
-        get_req->num_satisfied += 1;
-      } else {
-        // Add a placeholder plasma object to the get request to indicate that the
-        // object is not present. This will be parsed by the client. We set the
-        // data size to -1 to indicate that the object is not present.
-        get_req->objects[object_id].data_size = -1;
-        // Add the get request to the relevant data structures.
-        object_get_requests_[object_id].push_back(get_req);
-      }
-    }
-  }
-
   if (!evicted_ids.empty()) {
     unsigned char digest[kDigestSize] = {};
     std::vector<std::shared_ptr<Buffer>> buffers;
@@ -565,7 +1199,10 @@ void PlasmaStore::ProcessGetRequest(Client* client,
         std::memcpy(&evicted_entries[i]->digest[0], &digest[0], kDigestSize);
         evicted_entries[i]->construct_duration =
             std::time(nullptr) - evicted_entries[i]->create_time;
-        PlasmaObject_init(&get_req->objects[evicted_ids[i]], evicted_entries[i]);
+        PublishToDirectory(evicted_ids[i], evicted_entries[i]);
+        PlasmaObject object = {};
+        PlasmaObject_init(&object, evicted_entries[i]);
+        get_req->SetObject(evicted_ids[i], object);
         get_req->num_satisfied += 1;
       }
     } else {
@@ -579,6 +1216,58 @@ void PlasmaStore::ProcessGetRequest(Client* client,
     }
   }
 
+  if (check_remote_ids.empty()) {
+    FinishGetRequest(get_req, timeout_ms);
+    return;
+  }
+  // Ask the remote store about the rest. The lookup is sent together with the
+  // others that arrive around the same time.
+  remote_lookup_gets_.insert(get_req);
+  remote_lookups_.Lookup(
+      check_remote_ids, get_req,
+      [this, get_req, timeout_ms, check_remote_ids](
+          const std::vector<const plasmaRPC::ObjectDetails*>& details) {
+        remote_lookup_gets_.erase(get_req);
+        PlasmaObject missing = {};
+        missing.data_size = -1;
+        for (size_t i = 0; i < check_remote_ids.size(); ++i) {
+          const ObjectID& object_id = check_remote_ids[i];
+          if (details[i]->status() == plasmaRPC::ObjectDetails::OK) {
+            PlasmaObject object;
+            const auto& rpc_object = details[i]->object();
+            object.data_offset = rpc_object.data_offset();
+            object.metadata_offset = rpc_object.metadata_offset();
+            object.data_size = rpc_object.data_size();
+            object.metadata_size = rpc_object.metadata_size();
+            object.device_num = rpc_object.device_num();
+            // Mark remote object with store_fd = -1, in accordance with Client::MmapRemoteMemory
+            object.store_fd = -1;
+            get_req->SetObject(object_id, object);
+            get_req->num_satisfied += 1;
+            continue;
+          }
+          // The object may have been sealed here while the lookup waited.
+          auto entry = GetObjectTableEntry(&store_info_, object_id);
+          if (entry && entry->state == ObjectState::PLASMA_SEALED) {
+            PlasmaObject object = {};
+            PlasmaObject_init(&object, entry);
+            get_req->SetObject(object_id, object);
+            get_req->num_satisfied += 1;
+            AddToClientObjectIds(object_id, entry, get_req->client);
+          } else {
+            // Add a placeholder plasma object to the get request to indicate that the
+            // object is not present. This will be parsed by the client. We set the
+            // data size to -1 to indicate that the object is not present.
+            get_req->SetObject(object_id, missing);
+            // Add the get request to the relevant data structures.
+            object_get_requests_[object_id].push_back(get_req);
+          }
+        }
+        FinishGetRequest(get_req, timeout_ms);
+      });
+}
+
+void PlasmaStore::FinishGetRequest(GetRequest* get_req, int64_t timeout_ms) {
   // If all of the objects are present already or if the timeout is 0, return to
   // the client.
   if (get_req->num_satisfied == get_req->num_objects_to_wait_for || timeout_ms == 0) {
@@ -593,30 +1282,310 @@ void PlasmaStore::ProcessGetRequest(Client* client,
   }
 }
 
-int PlasmaStore::RemoveFromClientObjectIds(const ObjectID& object_id,
-                                           ObjectTableEntry* entry, Client* client) {
-  auto it = client->object_ids.find(object_id);
-  if (it != client->object_ids.end()) {
-    client->object_ids.erase(it);
-    // Decrease reference count.
-    {
-      std::lock_guard<std::mutex> lock(mutex_);
-      entry->ref_count--;
+void PlasmaStore::PublishStream(const ObjectID& object_id, int64_t stream_size,
+                                Client* client) {
+  auto writer = stream_writers_.find(object_id);
+  if (writer == stream_writers_.end() || writer->second != client) {
+    ARROW_LOG(WARNING) << "Client on fd " << client->fd << " published "
+                       << object_id.hex() << ", which is not an open stream it writes";
+    return;
+  }
+  auto entry = GetObjectTableEntry(&store_info_, object_id);
+  ARROW_CHECK(entry != nullptr);
+  if (stream_size > entry->data_size) {
+    ARROW_LOG(WARNING) << "Client on fd " << client->fd << " published " << stream_size
+                       << " bytes of stream " << object_id.hex() << ", which only has "
+                       << entry->data_size;
+    return;
+  }
+  // Threads of the writer may publish concurrently, so their requests can
+  // arrive out of order. A stream never shrinks.
+  if (stream_size <= entry->stream_size) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entry->stream_size = stream_size;
+  }
+  UpdateStreamWaitRequests(object_id);
+}
+
+void PlasmaStore::CloseStream(const ObjectID& object_id) {
+  ARROW_LOG(DEBUG) << "closing stream " << object_id.hex();
+  SealObjects({object_id}, {std::string(kDigestSize, 0)});
+}
+
+void PlasmaStore::ProcessWaitStreamRequest(Client* client, const ObjectID& object_id,
+                                           int64_t stream_size, int64_t timeout_ms) {
+  auto wait_req = new StreamWaitRequest(client, object_id, stream_size);
+  stream_wait_requests_[object_id].push_back(wait_req);
+
+  auto entry = GetObjectTableEntry(&store_info_, object_id);
+  if (entry == nullptr || entry->state != ObjectState::PLASMA_CREATED ||
+      entry->stream_size > stream_size || timeout_ms == 0) {
+    ReturnFromWaitStream(wait_req);
+  } else if (timeout_ms != -1) {
+    wait_req->timer = loop_->AddTimer(timeout_ms, [this, wait_req](int64_t timer_id) {
+      ReturnFromWaitStream(wait_req);
+      return kEventLoopTimerDone;
+    });
+  }
+}
+
+void PlasmaStore::ReturnFromWaitStream(StreamWaitRequest* wait_req) {
+  PlasmaError error_code = PlasmaError::OK;
+  int64_t stream_size = 0;
+  bool closed = false;
+  auto entry = GetObjectTableEntry(&store_info_, wait_req->object_id);
+  if (entry == nullptr) {
+    error_code = PlasmaError::ObjectNotFound;
+  } else {
+    closed = entry->state != ObjectState::PLASMA_CREATED;
+    if (entry->stream_size != -1) {
+      stream_size = entry->stream_size;
+    } else if (closed) {
+      // A sealed object that is not a stream reads like a closed stream.
+      stream_size = entry->data_size;
+    }
+  }
+  Status s = SendWaitStreamReply(wait_req->client->fd, wait_req->object_id, error_code,
+                                 stream_size, closed);
+  WarnIfSigpipe(s.ok() ? 0 : -1, wait_req->client->fd);
+
+  auto it = stream_wait_requests_.find(wait_req->object_id);
+  ARROW_CHECK(it != stream_wait_requests_.end());
+  auto& wait_requests = it->second;
+  wait_requests.erase(std::find(wait_requests.begin(), wait_requests.end(), wait_req));
+  if (wait_requests.empty()) {
+    stream_wait_requests_.erase(it);
+  }
+  if (wait_req->timer != -1) {
+    ARROW_CHECK(loop_->RemoveTimer(wait_req->timer) == kEventLoopOk);
+  }
+  delete wait_req;
+}
+
+void PlasmaStore::UpdateStreamWaitRequests(const ObjectID& object_id) {
+  auto it = stream_wait_requests_.find(object_id);
+  if (it == stream_wait_requests_.end()) {
+    return;
+  }
+  auto entry = GetObjectTableEntry(&store_info_, object_id);
+  // ReturnFromWaitStream removes the requests it replies to, so iterate over a
+  // copy.
+  std::vector<StreamWaitRequest*> wait_requests = it->second;
+  for (StreamWaitRequest* wait_req : wait_requests) {
+    if (entry == nullptr || entry->state != ObjectState::PLASMA_CREATED ||
+        entry->stream_size > wait_req->stream_size) {
+      ReturnFromWaitStream(wait_req);
+    }
+  }
+}
+
+void PlasmaStore::RemoveStreamWaitRequestsForClient(Client* client) {
+  for (auto it = stream_wait_requests_.begin(); it != stream_wait_requests_.end();) {
+    auto& wait_requests = it->second;
+    for (auto req = wait_requests.begin(); req != wait_requests.end();) {
+      if ((*req)->client == client) {
+        if ((*req)->timer != -1) {
+          ARROW_CHECK(loop_->RemoveTimer((*req)->timer) == kEventLoopOk);
+        }
+        delete *req;
+        req = wait_requests.erase(req);
+      } else {
+        ++req;
+      }
+    }
+    if (wait_requests.empty()) {
+      it = stream_wait_requests_.erase(it);
+    } else {
+      ++it;
     }
+  }
+}
+
+void PlasmaStore::ProcessWaitRequest(Client* client,
+                                     const std::vector<ObjectID>& object_ids,
+                                     int64_t num_ready_objects, int64_t timeout_ms) {
+  auto wait_req = new WaitRequest(client, object_ids, num_ready_objects);
+  std::vector<ObjectID> check_remote_ids;
+  for (const auto& object_id : wait_req->object_ids) {
+    auto entry = GetObjectTableEntry(&store_info_, object_id);
+    if (entry && (entry->state == ObjectState::PLASMA_SEALED ||
+                  entry->state == ObjectState::PLASMA_EVICTED ||
+                  entry->state == ObjectState::PLASMA_COMPRESSED)) {
+      wait_req->ready.insert(object_id);
+    } else if (!entry) {
+      // Objects that are being created here are ready when they are sealed,
+      // only the others can be in the remote store.
+      check_remote_ids.push_back(object_id);
+    }
+  }
 
-    // If no more clients are using this object, notify the eviction policy
-    // that the object is no longer being used.
-    if (entry->ref_count == 0) {
-      if (deletion_cache_.count(object_id) == 0) {
-        // Tell the eviction policy that this object is no longer being used.
-        eviction_policy_.EndObjectAccess(object_id);
+  const int64_t num_ready = wait_req->ready.size();
+  if (num_ready >= wait_req->num_ready_objects ||
+      (timeout_ms == 0 && check_remote_ids.empty())) {
+    ReturnFromWait(wait_req);
+    return;
+  }
+  for (const auto& object_id : wait_req->object_ids) {
+    if (wait_req->ready.count(object_id) == 0) {
+      object_wait_requests_[object_id].push_back(wait_req);
+    }
+  }
+  if (timeout_ms > 0) {
+    wait_req->timer = loop_->AddTimer(timeout_ms, [this, wait_req](int64_t timer_id) {
+      ReturnFromWait(wait_req);
+      return kEventLoopTimerDone;
+    });
+  }
+  if (check_remote_ids.empty()) {
+    return;
+  }
+  // Ask the remote store together with the other lookups that arrive around
+  // the same time. A wait that does not wait is answered with the result.
+  remote_lookups_.Lookup(
+      check_remote_ids, wait_req,
+      [this, wait_req, timeout_ms, check_remote_ids](
+          const std::vector<const plasmaRPC::ObjectDetails*>& details) {
+        for (size_t i = 0; i < check_remote_ids.size(); ++i) {
+          auto status = details[i]->status();
+          if (status == plasmaRPC::ObjectDetails::OK ||
+              status == plasmaRPC::ObjectDetails::EVICTED) {
+            wait_req->ready.insert(check_remote_ids[i]);
+          }
+        }
+        if (static_cast<int64_t>(wait_req->ready.size()) >= wait_req->num_ready_objects ||
+            timeout_ms == 0) {
+          ReturnFromWait(wait_req);
+        }
+      });
+  // The objects may still be sealed in the remote store later.
+  remote_poll_interval_ms_ = kRemoteWaitPollIntervalMs;
+  if (remote_poll_timer_ == -1) {
+    remote_poll_timer_ = loop_->AddTimer(
+        remote_poll_interval_ms_, [this](int64_t timer_id) { return PollRemoteObjects(); });
+  }
+}
+
+void PlasmaStore::ReturnFromWait(WaitRequest* wait_req) {
+  std::vector<ObjectID> ready_object_ids;
+  for (const auto& object_id : wait_req->object_ids) {
+    if (wait_req->ready.count(object_id) > 0) {
+      ready_object_ids.push_back(object_id);
+    }
+  }
+  Status s = SendWaitReply(wait_req->client->fd, ready_object_ids);
+  WarnIfSigpipe(s.ok() ? 0 : -1, wait_req->client->fd);
+
+  for (const auto& object_id : wait_req->object_ids) {
+    auto it = object_wait_requests_.find(object_id);
+    if (it != object_wait_requests_.end()) {
+      auto& wait_requests = it->second;
+      auto req = std::find(wait_requests.begin(), wait_requests.end(), wait_req);
+      if (req != wait_requests.end()) {
+        wait_requests.erase(req);
+        if (wait_requests.empty()) {
+          object_wait_requests_.erase(it);
+        }
+      }
+    }
+  }
+  if (wait_req->timer != -1) {
+    ARROW_CHECK(loop_->RemoveTimer(wait_req->timer) == kEventLoopOk);
+  }
+  remote_lookups_.Cancel(wait_req);
+  delete wait_req;
+}
+
+void PlasmaStore::UpdateObjectWaitRequests(const ObjectID& object_id) {
+  auto it = object_wait_requests_.find(object_id);
+  if (it == object_wait_requests_.end()) {
+    return;
+  }
+  // ReturnFromWait removes the requests it replies to, so iterate over a copy.
+  std::vector<WaitRequest*> wait_requests = it->second;
+  object_wait_requests_.erase(it);
+  for (WaitRequest* wait_req : wait_requests) {
+    wait_req->ready.insert(object_id);
+    if (static_cast<int64_t>(wait_req->ready.size()) >= wait_req->num_ready_objects) {
+      ReturnFromWait(wait_req);
+    }
+  }
+}
+
+void PlasmaStore::RemoveWaitRequestsForClient(Client* client) {
+  std::unordered_set<WaitRequest*> wait_requests_to_remove;
+  for (auto it = object_wait_requests_.begin(); it != object_wait_requests_.end();) {
+    auto& wait_requests = it->second;
+    for (auto req = wait_requests.begin(); req != wait_requests.end();) {
+      if ((*req)->client == client) {
+        wait_requests_to_remove.insert(*req);
+        req = wait_requests.erase(req);
       } else {
-        // Above code does not really delete an object. Instead, it just put an
-        // object to LRU cache which will be cleaned when the memory is not enough.
-        deletion_cache_.erase(object_id);
-        EvictObjects({object_id});
+        ++req;
       }
     }
+    if (wait_requests.empty()) {
+      it = object_wait_requests_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  for (WaitRequest* wait_req : wait_requests_to_remove) {
+    if (wait_req->timer != -1) {
+      ARROW_CHECK(loop_->RemoveTimer(wait_req->timer) == kEventLoopOk);
+    }
+    remote_lookups_.Cancel(wait_req);
+    delete wait_req;
+  }
+}
+
+int PlasmaStore::PollRemoteObjects() {
+  std::vector<ObjectID> object_ids;
+  for (const auto& pair : object_wait_requests_) {
+    // Objects that are here are ready when they are sealed.
+    if (GetObjectTableEntry(&store_info_, pair.first) == nullptr) {
+      object_ids.push_back(pair.first);
+    }
+  }
+  if (object_ids.empty()) {
+    remote_poll_timer_ = -1;
+    return kEventLoopTimerDone;
+  }
+  // The lookup is answered later on the loop, and the next one is only sent
+  // after it.
+  if (!remote_poll_in_flight_) {
+    remote_poll_in_flight_ = true;
+    remote_lookups_.Lookup(
+        object_ids, this,
+        [this, object_ids](const std::vector<const plasmaRPC::ObjectDetails*>& details) {
+          remote_poll_in_flight_ = false;
+          bool found = false;
+          for (size_t i = 0; i < object_ids.size(); ++i) {
+            auto status = details[i]->status();
+            if (status == plasmaRPC::ObjectDetails::OK ||
+                status == plasmaRPC::ObjectDetails::EVICTED) {
+              UpdateObjectWaitRequests(object_ids[i]);
+              found = true;
+            }
+          }
+          remote_poll_interval_ms_ =
+              found ? kRemoteWaitPollIntervalMs
+                    : std::min(2 * remote_poll_interval_ms_, kMaxRemoteWaitPollIntervalMs);
+        });
+  }
+  return static_cast<int>(remote_poll_interval_ms_);
+}
+
+int PlasmaStore::RemoveFromClientObjectIds(const ObjectID& object_id,
+                                           ObjectTableEntry* entry, Client* client) {
+  auto it = client->object_ids.find(object_id);
+  if (it != client->object_ids.end()) {
+    client->object_ids.erase(it);
+    // A lease lasts as long as the reference it came with.
+    DropLease(object_id, client);
+    DropReference(object_id, entry);
     // Return 1 to indicate that the client was removed.
     return 1;
   } else {
@@ -625,18 +1594,645 @@ int PlasmaStore::RemoveFromClientObjectIds(const ObjectID& object_id,
   }
 }
 
-void PlasmaStore::EraseFromObjectTable(const ObjectID& object_id) {
-  std::lock_guard<std::mutex> lock(mutex_);
+void PlasmaStore::DropReference(const ObjectID& object_id, ObjectTableEntry* entry) {
+  // Decrease reference count.
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entry->ref_count--;
+  }
+
+  // If no more clients are using this object, notify the eviction policy
+  // that the object is no longer being used.
+  if (entry->ref_count == 0) {
+    if (deletion_cache_.count(object_id) == 0) {
+      // Now that no client maps the object, it can move to the memory of an
+      // identical one.
+      if (dedup_candidates_.count(object_id) > 0) {
+        DeduplicateObject(object_id, entry);
+      }
+      // Tell the eviction policy that this object is no longer being used.
+      eviction_policy_.EndObjectAccess(object_id);
+    } else {
+      // Above code does not really delete an object. Instead, it just put an
+      // object to LRU cache which will be cleaned when the memory is not enough.
+      deletion_cache_.erase(object_id);
+      EvictObjects({object_id});
+    }
+  }
+}
+
+void PlasmaStore::PublishToDirectory(const ObjectID& object_id,
+                                     const ObjectTableEntry* entry) {
+  // Objects on GPUs can only be reached through the store.
+  if (entry->device_num != 0) {
+    return;
+  }
+  PlasmaObject object;
+  PlasmaObject_init(&object, entry);
+  if (!object_directory_->Publish(object_id, object, &entry->digest[0])) {
+    ARROW_LOG(DEBUG) << "object directory is full, object " << object_id.hex()
+                     << " can only be found through the store";
+  }
+}
+
+void PlasmaStore::RecoverObjects(
+    const std::vector<ObjectDirectory::RecoveredObject>& objects) {
+  if (objects.empty()) {
+    return;
+  }
+  auto base_pointer = static_cast<uint8_t*>(PlasmaAllocator::GetBasePointer());
+  const int64_t header_size = object_directory_->size() +
+                              LeaseTable::RequiredSize(lease_table_->capacity());
+  std::vector<const ObjectDirectory::RecoveredObject*> sorted;
+  for (const auto& recovered : objects) {
+    sorted.push_back(&recovered);
+  }
+  std::sort(sorted.begin(), sorted.end(),
+            [](const ObjectDirectory::RecoveredObject* a,
+               const ObjectDirectory::RecoveredObject* b) {
+              // Of objects at the same offset the largest comes first, so
+              // that views starting there are dropped rather than parents.
+              return a->object.data_offset < b->object.data_offset ||
+                     (a->object.data_offset == b->object.data_offset &&
+                      a->object.data_size + a->object.metadata_size >
+                          b->object.data_size + b->object.metadata_size);
+            });
+
+  // The offset and size of the memory of each recovered object, once for
+  // objects that share memory.
+  std::vector<std::pair<int64_t, int64_t>> allocations;
+  ObjectID previous_id;
+  int64_t recovered_bytes = 0;
+  for (auto recovered : sorted) {
+    const ObjectID& object_id = recovered->object_id;
+    const PlasmaObject& object = recovered->object;
+    const int64_t size = object.data_size + object.metadata_size;
+    const bool same_memory = !allocations.empty() &&
+                             allocations.back().first == object.data_offset &&
+                             allocations.back().second == size;
+    const int64_t end_of_previous =
+        allocations.empty() ? header_size
+                            : allocations.back().first + allocations.back().second;
+    if (object.device_num != 0 || object.data_size < 0 || object.metadata_size < 0 ||
+        object.metadata_offset != object.data_offset + object.data_size ||
+        object.data_offset + size > PlasmaAllocator::GetFootprintLimit() ||
+        (!same_memory && object.data_offset < end_of_previous)) {
+      ARROW_LOG(WARNING) << "dropping recovered object " << object_id.hex()
+                         << " with an invalid location";
+      object_directory_->Remove(object_id);
+      continue;
+    }
+    if (same_memory) {
+      // The previous store deduplicated these objects.
+      auto& sharers = shared_memory_[object.data_offset];
+      if (sharers.empty()) {
+        sharers.push_back(previous_id);
+      }
+      sharers.push_back(object_id);
+      dedup_bytes_saved_ += size;
+    } else {
+      allocations.emplace_back(object.data_offset, size);
+      recovered_bytes += size;
+    }
+    previous_id = object_id;
+
+    PlasmaObject unused = {};
+    AddObjectTableEntry(object_id, object.data_size, object.metadata_size, base_pointer,
+                        PlasmaAllocator::GetFd(), size, object.data_offset, 0, &unused);
+    auto entry = GetObjectTableEntry(&store_info_, object_id);
+    entry->state = ObjectState::PLASMA_SEALED;
+    entry->construct_duration = 0;
+    std::memcpy(&entry->digest[0], recovered->digest, kDigestSize);
+    eviction_policy_.ObjectCreated(object_id, nullptr, false);
+    if (deduplicate_ && !same_memory) {
+      objects_by_digest_.emplace(DigestKey(entry), object_id);
+    }
+  }
+  PlasmaAllocator::Reserve(allocations);
+  ARROW_LOG(INFO) << "Recovered " << store_info_.objects.size() << " objects in "
+                  << recovered_bytes << " bytes from the region";
+}
+
+int64_t PlasmaStore::GrantLease(const ObjectID& object_id, Client* client) {
+  auto& leases = object_leases_[object_id];
+  // The client asked for the object again while the store still counts a
+  // lease of it, so its copy of the lease is gone. Its new reference goes
+  // without a lease, and giving it back drops the old one.
+  if (leases.count(client) > 0) {
+    return kNoLease;
+  }
+  int64_t lease = lease_table_->Grant();
+  if (lease == kNoLease) {
+    if (leases.empty()) {
+      object_leases_.erase(object_id);
+    }
+    return kNoLease;
+  }
+  leases[client] = lease;
+  return lease;
+}
+
+void PlasmaStore::DropLease(const ObjectID& object_id, Client* client) {
+  auto it = object_leases_.find(object_id);
+  if (it == object_leases_.end()) {
+    return;
+  }
+  auto lease = it->second.find(client);
+  if (lease == it->second.end()) {
+    return;
+  }
+  lease_table_->Free(lease->second);
+  it->second.erase(lease);
+  if (it->second.empty()) {
+    object_leases_.erase(it);
+  }
+}
+
+int64_t PlasmaStore::RevokeIdleLeases(const ObjectID& object_id) {
+  auto it = object_leases_.find(object_id);
+  if (it == object_leases_.end()) {
+    return 0;
+  }
+  std::vector<Client*> revoked;
+  for (const auto& lease : it->second) {
+    if (lease_table_->Revoke(lease.second)) {
+      revoked.push_back(lease.first);
+    }
+  }
+  // Giving back the references drops the leases, and the last one may evict
+  // the object if it is waiting to be deleted.
   auto entry = GetObjectTableEntry(&store_info_, object_id);
-  auto buff_size = entry->data_size + entry->metadata_size;
-  if (entry->device_num == 0) {
-    PlasmaAllocator::Free(entry->pointer + entry->offset, buff_size);
-  } else {
+  for (Client* client : revoked) {
+    RemoveFromClientObjectIds(object_id, entry, client);
+  }
+  return static_cast<int64_t>(revoked.size());
+}
+
+int64_t PlasmaStore::RevokeAllIdleLeases() {
+  std::vector<ObjectID> object_ids;
+  object_ids.reserve(object_leases_.size());
+  for (const auto& leases : object_leases_) {
+    object_ids.push_back(leases.first);
+  }
+  int64_t num_revoked = 0;
+  for (const auto& object_id : object_ids) {
+    num_revoked += RevokeIdleLeases(object_id);
+  }
+  return num_revoked;
+}
+
+void PlasmaStore::CompressObjects(std::vector<ObjectID>* object_ids) {
+  if (!compression_.codec) {
+    return;
+  }
+  std::vector<ObjectID> to_evict;
+  for (const auto& object_id : *object_ids) {
+    auto entry = GetObjectTableEntry(&store_info_, object_id);
+    if (!CompressObject(object_id, entry)) {
+      to_evict.push_back(object_id);
+    }
+  }
+  *object_ids = std::move(to_evict);
+}
+
+bool PlasmaStore::CompressObject(const ObjectID& object_id, ObjectTableEntry* entry) {
+  if (entry->state != ObjectState::PLASMA_SEALED || entry->device_num != 0 ||
+      shared_memory_.count(entry->offset) > 0 || view_parents_.count(object_id) > 0) {
+    return false;
+  }
+  const int64_t size = entry->data_size + entry->metadata_size;
+  uint8_t* data = entry->pointer + entry->offset;
+  arrow::util::Codec* codec = compression_.codec.get();
+  const int64_t max_compressed_size = codec->MaxCompressedLen(size, data);
+  if (static_cast<int64_t>(compression_buffer_.size()) < max_compressed_size) {
+    compression_buffer_.resize(max_compressed_size);
+  }
+  auto compressed_size =
+      codec->Compress(size, data, max_compressed_size, compression_buffer_.data());
+  if (!compressed_size.ok()) {
+    ARROW_LOG(WARNING) << "failed to compress object " << object_id.hex() << ": "
+                       << compressed_size.status();
+    return false;
+  }
+  if (*compressed_size > kMaxCompressedFraction * size ||
+      *compressed_size > compressed_objects_.Capacity()) {
+    num_incompressible_ += 1;
+    return false;
+  }
+  // Make room in the tier by letting go of the coldest compressed objects.
+  if (*compressed_size > compressed_objects_.RemainingCapacity()) {
+    DropCompressedObjects(*compressed_size - compressed_objects_.RemainingCapacity());
+  }
+
+  // The allocator need not hand back the memory of the object for its
+  // compressed copy, e.g. when it comes from another arena, so the object is
+  // only freed once the copy has a place. Without one, it is evicted instead.
+  int fd;
+  int64_t map_size;
+  ptrdiff_t offset;
+  auto pointer = reinterpret_cast<uint8_t*>(
+      PlasmaAllocator::Memalign(kBlockSize, *compressed_size, &fd, &map_size, &offset));
+  if (pointer == nullptr) {
+    num_compressions_without_room_ += 1;
+    return false;
+  }
+  std::memcpy(pointer + offset, compression_buffer_.data(), *compressed_size);
+  object_directory_->Remove(object_id);
+  DetachFromSharedMemory(object_id, entry);
+  PlasmaAllocator::Free(data, size);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entry->pointer = pointer;
+    entry->fd = fd;
+    entry->map_size = map_size;
+    entry->offset = offset;
+    entry->compressed_size = *compressed_size;
+    entry->state = ObjectState::PLASMA_COMPRESSED;
+  }
+  compressed_objects_.Add(object_id, *compressed_size);
+  num_compressions_ += 1;
+  return true;
+}
+
+Status PlasmaStore::DecompressObject(const ObjectID& object_id, ObjectTableEntry* entry,
+                                     Client* client) {
+  // Making room for the object must not drop the object itself.
+  compressed_objects_.Remove(object_id);
+  const int64_t size = entry->data_size + entry->metadata_size;
+  int fd;
+  int64_t map_size;
+  ptrdiff_t offset;
+  uint8_t* pointer = AllocateMemory(size, /*evict_if_full=*/true, &fd, &map_size,
+                                    &offset, client, /*is_create=*/false);
+  if (pointer == nullptr) {
+    compressed_objects_.Add(object_id, entry->compressed_size);
+    return Status::OutOfMemory("no memory to decompress object ", object_id.hex());
+  }
+  Status s = DecompressInto(entry, pointer + offset);
+  if (!s.ok()) {
+    ARROW_LOG(WARNING) << "failed to decompress object " << object_id.hex() << ": " << s;
+    PlasmaAllocator::Free(pointer + offset, size);
+    compressed_objects_.Add(object_id, entry->compressed_size);
+    return s;
+  }
+  PlasmaAllocator::Free(entry->pointer + entry->offset, entry->compressed_size);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entry->pointer = pointer;
+    entry->fd = fd;
+    entry->map_size = map_size;
+    entry->offset = offset;
+    entry->compressed_size = 0;
+    entry->state = ObjectState::PLASMA_SEALED;
+  }
+  eviction_policy_.ObjectCreated(object_id, client, false);
+  PublishToDirectory(object_id, entry);
+  if (deduplicate_ && DigestKey(entry) != 0) {
+    dedup_candidates_.insert(object_id);
+  }
+  num_decompressions_ += 1;
+  return Status::OK();
+}
+
+Status PlasmaStore::DecompressInto(const ObjectTableEntry* entry, uint8_t* out) {
+  const int64_t size = entry->data_size + entry->metadata_size;
+  ARROW_ASSIGN_OR_RAISE(int64_t decompressed_size,
+                        compression_.codec->Decompress(entry->compressed_size,
+                                                       entry->pointer + entry->offset,
+                                                       size, out));
+  if (decompressed_size != size) {
+    return Status::IOError("decompressed ", decompressed_size, " bytes instead of ",
+                           size);
+  }
+  return Status::OK();
+}
+
+Status PlasmaStore::PutCompressedObject(const ObjectID& object_id,
+                                        const ObjectTableEntry* entry) {
+  // The external store keeps objects in their original form.
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<arrow::Buffer> buffer,
+                        arrow::AllocateBuffer(entry->data_size + entry->metadata_size));
+  RETURN_NOT_OK(DecompressInto(entry, buffer->mutable_data()));
+  return external_store_->Put({object_id}, {buffer});
+}
+
+int64_t PlasmaStore::DropCompressedObjects(int64_t num_bytes) {
+  std::vector<ObjectID> object_ids;
+  int64_t num_bytes_freed = compressed_objects_.ChooseObjectsToEvict(num_bytes, &object_ids);
+  for (const auto& object_id : object_ids) {
+    compressed_objects_.Remove(object_id);
+    auto entry = GetObjectTableEntry(&store_info_, object_id);
+    if (external_store_) {
+      Status s = PutCompressedObject(object_id, entry);
+      if (s.ok()) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        PlasmaAllocator::Free(entry->pointer + entry->offset, entry->compressed_size);
+        entry->pointer = nullptr;
+        entry->compressed_size = 0;
+        entry->state = ObjectState::PLASMA_EVICTED;
+        continue;
+      }
+      ARROW_LOG(WARNING) << "failed to move compressed object " << object_id.hex()
+                         << " to the external store, deleting it: " << s;
+    }
+    EraseFromObjectTable(object_id);
+    fb::ObjectInfoT notification;
+    notification.object_id = object_id.binary();
+    notification.is_deletion = true;
+    PushNotification(&notification);
+  }
+  return num_bytes_freed;
+}
+
+std::string PlasmaStore::CompressionDebugString() {
+  if (!compression_.codec) {
+    return "";
+  }
+  int64_t uncompressed_bytes = 0;
+  compressed_objects_.Foreach([this, &uncompressed_bytes](const ObjectID& object_id) {
+    auto entry = GetObjectTableEntry(&store_info_, object_id);
+    uncompressed_bytes += entry->data_size + entry->metadata_size;
+  });
+  const int64_t compressed_bytes = compressed_objects_.Capacity() -
+                                   compressed_objects_.RemainingCapacity();
+  std::stringstream result;
+  result << compressed_objects_.DebugString();
+  result << "\n(compression) codec: "
+         << arrow::util::Codec::GetCodecAsString(
+                compression_.codec->compression_type());
+  result << "\n(compression) bytes saved: " << uncompressed_bytes - compressed_bytes;
+  result << "\n(compression) ratio: "
+         << (compressed_bytes > 0 ? uncompressed_bytes / (double)compressed_bytes : 0.);
+  result << "\n(compression) num compressions: " << num_compressions_;
+  result << "\n(compression) num decompressions: " << num_decompressions_;
+  result << "\n(compression) num incompressible: " << num_incompressible_;
+  result << "\n(compression) num evicted for lack of room: "
+         << num_compressions_without_room_;
+  return result.str();
+}
+
+void PlasmaStore::DeduplicateObject(const ObjectID& object_id, ObjectTableEntry* entry) {
+  dedup_candidates_.erase(object_id);
+  const uint64_t key = DigestKey(entry);
+  auto original_id = objects_by_digest_.find(key);
+  if (original_id == objects_by_digest_.end()) {
+    objects_by_digest_.emplace(key, object_id);
+    return;
+  }
+  if (original_id->second == object_id) {
+    return;
+  }
+  auto original = GetObjectTableEntry(&store_info_, original_id->second);
+  DCHECK(original != nullptr && original->state == ObjectState::PLASMA_SEALED);
+  const int64_t size = entry->data_size + entry->metadata_size;
+  // The digest comes from the client, so only the bytes tell whether the
+  // objects are the same.
+  if (original->data_size != entry->data_size ||
+      original->metadata_size != entry->metadata_size ||
+      std::memcmp(original->pointer + original->offset, entry->pointer + entry->offset,
+                  size) != 0) {
+    num_digest_collisions_ += 1;
+    return;
+  }
+  auto& sharers = shared_memory_[original->offset];
+  if (sharers.empty()) {
+    sharers.push_back(original_id->second);
+  }
+  sharers.push_back(object_id);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    PlasmaAllocator::Free(entry->pointer + entry->offset, size);
+    entry->pointer = original->pointer;
+    entry->fd = original->fd;
+    entry->map_size = original->map_size;
+    entry->offset = original->offset;
+  }
+  PublishToDirectory(object_id, entry);
+  num_deduplicated_ += 1;
+  dedup_bytes_saved_ += size;
+}
+
+bool PlasmaStore::DetachFromSharedMemory(const ObjectID& object_id,
+                                         const ObjectTableEntry* entry) {
+  dedup_candidates_.erase(object_id);
+  auto original_id = objects_by_digest_.find(DigestKey(entry));
+  const bool is_original =
+      original_id != objects_by_digest_.end() && original_id->second == object_id;
+  // Only sealed objects in the region share memory. Other entries may hold a
+  // stale offset.
+  auto sharers = entry->state == ObjectState::PLASMA_SEALED && entry->device_num == 0
+                     ? shared_memory_.find(entry->offset)
+                     : shared_memory_.end();
+  if (sharers == shared_memory_.end()) {
+    if (is_original) {
+      objects_by_digest_.erase(original_id);
+    }
+    return false;
+  }
+  auto& ids = sharers->second;
+  ids.erase(std::remove(ids.begin(), ids.end(), object_id), ids.end());
+  if (is_original) {
+    original_id->second = ids.front();
+  }
+  dedup_bytes_saved_ -= entry->data_size + entry->metadata_size;
+  if (ids.size() == 1) {
+    shared_memory_.erase(sharers);
+  }
+  return true;
+}
+
+std::string PlasmaStore::NumaDebugString() const {
+  auto arenas = PlasmaAllocator::GetArenas();
+  if (arenas.size() == 1 && arenas[0].numa_node == -1) {
+    return "";
+  }
+  std::stringstream result;
+  for (const auto& arena : arenas) {
+    result << "\n(numa) node " << arena.numa_node << " bytes allocated: "
+           << arena.allocated << " of " << arena.size;
+  }
+  result << "\n(numa) allocations on the client's node: " << num_node_local_allocations_;
+  result << "\n(numa) allocations on another node: " << num_node_remote_allocations_;
+  return result.str();
+}
+
+std::string PlasmaStore::HeapDebugString() const {
+  std::stringstream result;
+#ifdef PLASMA_COUNT_ALLOCATIONS
+  result << "\n(store) heap allocations: " << num_heap_allocations.load();
+#endif
+  result << "\n(store) pooled get requests: " << get_request_pool_.size();
+  return result.str();
+}
+
+int PlasmaStore::EvictToLowWatermark() {
+  const int64_t limit = PlasmaAllocator::GetFootprintLimit();
+  const int64_t allocated = PlasmaAllocator::Allocated();
+  if (allocated <= static_cast<int64_t>(watermarks_.high * limit)) {
+    return kWatermarkCheckIntervalMs;
+  }
+  // Only objects nobody uses are chosen, so this takes no leases back and
+  // frees no compressed objects, unlike a create that does not fit.
+  std::vector<ObjectID> objects_to_evict;
+  const int64_t num_bytes = eviction_policy_.ChooseObjectsToEvict(
+      allocated - static_cast<int64_t>(watermarks_.low * limit), &objects_to_evict);
+  num_background_evictions_ += objects_to_evict.size();
+  background_bytes_evicted_ += num_bytes;
+  CompressObjects(&objects_to_evict);
+  EvictObjects(objects_to_evict);
+  return kWatermarkCheckIntervalMs;
+}
+
+std::string PlasmaStore::WatermarkDebugString() const {
+  const int64_t limit = PlasmaAllocator::GetFootprintLimit();
+  std::stringstream result;
+  result << "\n(watermarks) high: " << static_cast<int64_t>(watermarks_.high * limit);
+  result << "\n(watermarks) low: " << static_cast<int64_t>(watermarks_.low * limit);
+  result << "\n(watermarks) objects evicted in the background: "
+         << num_background_evictions_;
+  result << "\n(watermarks) bytes evicted in the background: "
+         << background_bytes_evicted_;
+  result << "\n(watermarks) creates that evicted: " << num_inline_evictions_;
+  return result.str();
+}
+
+PlasmaError PlasmaStore::GrowRegion(int64_t memory_capacity) {
+  const int64_t limit = PlasmaAllocator::GetFootprintLimit();
+  if (memory_capacity <= limit) {
+    return PlasmaError::OK;
+  }
+  if (memory_capacity > PlasmaAllocator::GetMaxFootprintLimit()) {
+    ARROW_LOG(WARNING) << "can not grow the region to " << memory_capacity
+                       << " bytes, it was mapped at "
+                       << PlasmaAllocator::GetMaxFootprintLimit();
+    return PlasmaError::OutOfMemory;
+  }
+  // Memory past the end of the file would raise SIGBUS in whoever touches it,
+  // so the file grows before the allocator hands the memory out.
+  const int fd = PlasmaAllocator::GetFd();
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0) {
+    ARROW_LOG(WARNING) << "fstat of the region failed: " << std::strerror(errno);
+    return PlasmaError::OutOfMemory;
+  }
+  if (file_stat.st_size < memory_capacity && ftruncate(fd, memory_capacity) != 0) {
+    ARROW_LOG(WARNING) << "could not extend the region to " << memory_capacity
+                       << " bytes: " << std::strerror(errno);
+    return PlasmaError::OutOfMemory;
+  }
+  PlasmaAllocator::Grow(memory_capacity);
+  eviction_policy_.AddCapacity(memory_capacity - limit);
+  num_region_grows_ += 1;
+  region_bytes_grown_ += memory_capacity - limit;
+  return PlasmaError::OK;
+}
+
+std::string PlasmaStore::RegionDebugString() const {
+  std::stringstream result;
+  result << "\n(region) size: " << PlasmaAllocator::GetFootprintLimit();
+  result << "\n(region) largest size: " << PlasmaAllocator::GetMaxFootprintLimit();
+  result << "\n(region) times grown: " << num_region_grows_;
+  result << "\n(region) bytes grown: " << region_bytes_grown_;
+  return result.str();
+}
+
+int PlasmaStore::FlushTrace() {
+  Status status = trace_->Flush();
+  if (!status.ok()) {
+    ARROW_LOG(WARNING) << "the trace is incomplete: " << status.ToString();
+  }
+  return kTraceFlushIntervalMs;
+}
+
+std::string PlasmaStore::NotificationDebugString() const {
+  int64_t num_ring_subscribers = 0;
+  int64_t num_waiting = 0;
+  for (const auto& entry : pending_notifications_) {
+    if (entry.second.ring) {
+      num_ring_subscribers += 1;
+      num_waiting += entry.second.ring_overflow.size();
+    }
+  }
+  std::stringstream result;
+  result << "\n(notifications) subscribers on rings: " << num_ring_subscribers;
+  result << "\n(notifications) notifications written to rings: "
+         << num_ring_notifications_;
+  result << "\n(notifications) wakeups of subscribers on rings: " << num_ring_wakeups_;
+  result << "\n(notifications) notifications waiting for room in a ring: "
+         << num_waiting;
+  return result.str();
+}
+
+std::string PlasmaStore::SchedulingDebugString() const {
+  std::stringstream result;
+  result << "\n(scheduling) fair queuing: " << (scheduling_.fair_queuing ? "on" : "off");
+  result << "\n(scheduling) requests queued: " << num_queued_requests_;
+  result << "\n(scheduling) requests that waited for their turn: "
+         << fair_queue_.num_waited();
+  result << "\n(scheduling) remote bytes per second: "
+         << scheduling_.remote_bytes_per_second;
+  result << "\n(scheduling) creates that waited for the token bucket: "
+         << num_waited_for_tokens_;
+  result << "\n(scheduling) bytes created in the remote region: "
+         << remote_bytes_admitted_;
+  return result.str();
+}
+
+std::string PlasmaStore::RemoteAllocationDebugString() const {
+  std::stringstream result;
+  result << "\n(remote) objects created in the remote region: "
+         << num_remote_allocations_;
+  result << "\n(remote) objects created for the remote store: "
+         << num_peer_allocations_;
+  result << "\n(remote) requests of the remote store that timed out: "
+         << num_peer_timeouts_;
+  return result.str();
+}
+
+std::string PlasmaStore::DedupDebugString() const {
+  if (!deduplicate_) {
+    return "";
+  }
+  std::stringstream result;
+  result << "\n(dedup) num objects deduplicated: " << num_deduplicated_;
+  result << "\n(dedup) num shared regions: " << shared_memory_.size();
+  result << "\n(dedup) bytes saved: " << dedup_bytes_saved_;
+  result << "\n(dedup) num digest collisions: " << num_digest_collisions_;
+  return result.str();
+}
+
+void PlasmaStore::EraseFromObjectTable(const ObjectID& object_id) {
+  // Readers of the directory must not find the memory once it is freed.
+  object_directory_->Remove(object_id);
+  auto view = view_parents_.find(object_id);
+  const bool memory_shared =
+      view != view_parents_.end() ||
+      DetachFromSharedMemory(object_id, GetObjectTableEntry(&store_info_, object_id));
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto entry = GetObjectTableEntry(&store_info_, object_id);
+    auto buff_size = entry->state == ObjectState::PLASMA_COMPRESSED
+                         ? entry->compressed_size
+                         : entry->data_size + entry->metadata_size;
+    if (memory_shared) {
+      // Other objects still use the memory.
+    } else if (entry->device_num == 0) {
+      PlasmaAllocator::Free(entry->pointer + entry->offset, buff_size);
+    } else {
 #ifdef PLASMA_CUDA
-    ARROW_CHECK_OK(FreeCudaMemory(entry->device_num, buff_size, entry->pointer));
+      ARROW_CHECK_OK(FreeCudaMemory(entry->device_num, buff_size, entry->pointer));
 #endif
+    }
+    store_info_.objects.erase(object_id);
+  }
+  stream_writers_.erase(object_id);
+  // Clients waiting for the object learn that it is gone.
+  UpdateStreamWaitRequests(object_id);
+  if (view != view_parents_.end()) {
+    const ObjectID parent_id = view->second;
+    view_parents_.erase(view);
+    DropReference(parent_id, GetObjectTableEntry(&store_info_, parent_id));
   }
-  store_info_.objects.erase(object_id);
 }
 
 void PlasmaStore::ReleaseObject(const ObjectID& object_id, Client* client) {
@@ -646,28 +2242,51 @@ void PlasmaStore::ReleaseObject(const ObjectID& object_id, Client* client) {
   ARROW_CHECK(RemoveFromClientObjectIds(object_id, entry, client) == 1);
 }
 
-bool PlasmaStore::ObjectExists(const ObjectID& object_id) {
-  return GetObjectTableEntry(&store_info_, object_id) ||
-        rpc_client_.GetObject(object_id).status() !=
-                plasmaRPC::ObjectDetails::MISSING;
+void PlasmaStore::LookupBeforeCreate(Client* client,
+                                     const std::vector<ObjectID>& object_ids,
+                                     std::function<void(bool)> create) {
+  for (const auto& object_id : object_ids) {
+    if (GetObjectTableEntry(&store_info_, object_id) != nullptr) {
+      // The create fails on this object without asking the remote store.
+      create(false);
+      return;
+    }
+  }
+  // Like a get, the create waits for its lookup, which is sent together with
+  // the others that arrive around the same time.
+  remote_lookups_.Lookup(
+      object_ids, client,
+      [create](const std::vector<const plasmaRPC::ObjectDetails*>& details) {
+        bool exists_remotely = false;
+        for (auto object_details : details) {
+          if (object_details->status() != plasmaRPC::ObjectDetails::MISSING) {
+            exists_remotely = true;
+          }
+        }
+        create(exists_remotely);
+      });
 }
 
-// Check if an object is present.
-ObjectStatus PlasmaStore::ContainsObject(const ObjectID& object_id) {
+void PlasmaStore::ProcessContainsRequest(Client* client, const ObjectID& object_id) {
   auto entry = GetObjectTableEntry(&store_info_, object_id);
-  bool found = false;
   if (entry) {
-    found = entry->state == ObjectState::PLASMA_SEALED ||
-                   entry->state == ObjectState::PLASMA_EVICTED;
-  } else {
-    auto status = rpc_client_.GetObject(object_id).status();
-    found = status == plasmaRPC::ObjectDetails::OK ||
-                   status == plasmaRPC::ObjectDetails::EVICTED;
+    bool found = entry->state == ObjectState::PLASMA_SEALED ||
+                 entry->state == ObjectState::PLASMA_EVICTED ||
+                 entry->state == ObjectState::PLASMA_COMPRESSED;
+    WarnIfSigpipe(SendContainsReply(client->fd, object_id, found).ok() ? 0 : -1,
+                  client->fd);
+    return;
   }
-
-  return found
-             ? ObjectStatus::OBJECT_FOUND
-             : ObjectStatus::OBJECT_NOT_FOUND;
+  // Answer when the lookup of the object in the remote store comes back, which
+  // is sent together with the others that arrive around the same time.
+  remote_lookups_.Lookup(
+      {object_id}, client,
+      [client, object_id](const std::vector<const plasmaRPC::ObjectDetails*>& details) {
+        bool found = details[0]->status() == plasmaRPC::ObjectDetails::OK ||
+                     details[0]->status() == plasmaRPC::ObjectDetails::EVICTED;
+        WarnIfSigpipe(SendContainsReply(client->fd, object_id, found).ok() ? 0 : -1,
+                      client->fd);
+      });
 }
 
 void PlasmaStore::SealObjects(const std::vector<ObjectID>& object_ids,
@@ -687,9 +2306,15 @@ void PlasmaStore::SealObjects(const std::vector<ObjectID>& object_ids,
     std::memcpy(&entry->digest[0], digests[i].c_str(), kDigestSize);
     // Set object construction duration.
     entry->construct_duration = std::time(nullptr) - entry->create_time;
+    stream_writers_.erase(object_ids[i]);
+    PublishToDirectory(object_ids[i], entry);
 
+    if (pending_notifications_.empty()) {
+      continue;
+    }
     object_info.object_id = object_ids[i].binary();
-    object_info.data_size = entry->data_size;
+    object_info.data_size =
+        entry->stream_size != -1 ? entry->stream_size : entry->data_size;
     object_info.metadata_size = entry->metadata_size;
     object_info.digest = digests[i];
     infos.push_back(object_info);
@@ -697,8 +2322,29 @@ void PlasmaStore::SealObjects(const std::vector<ObjectID>& object_ids,
 
   PushNotifications(infos);
 
+  if (deduplicate_) {
+    for (const auto& object_id : object_ids) {
+      auto entry = GetObjectTableEntry(&store_info_, object_id);
+      // Streams were read while they were written, so their readers may still
+      // look at the memory. Views live in the memory of their parent. Objects
+      // that were sealed without a digest, e.g. for the remote store or after
+      // a restore from the external store, would all share one key and be
+      // compared byte by byte with each other.
+      if (entry->device_num != 0 || entry->stream_size != -1 ||
+          view_parents_.count(object_id) > 0 || DigestKey(entry) == 0) {
+        continue;
+      }
+      dedup_candidates_.insert(object_id);
+      if (entry->ref_count == 0) {
+        DeduplicateObject(object_id, entry);
+      }
+    }
+  }
+
   for (size_t i = 0; i < object_ids.size(); ++i) {
     UpdateObjectGetRequests(object_ids[i]);
+    UpdateObjectWaitRequests(object_ids[i]);
+    UpdateStreamWaitRequests(object_ids[i]);
   }
 }
 
@@ -712,6 +2358,13 @@ int PlasmaStore::AbortObject(const ObjectID& object_id, Client* client) {
     // If the client requesting the abort is not the creator, do not
     // perform the abort.
     return 0;
+  } else if (stream_writers_.count(object_id) > 0 && entry->ref_count > 1) {
+    // Readers have mapped the stream, so it cannot be freed yet. End it where
+    // the writer left off and delete it once the readers release it.
+    CloseStream(object_id);
+    deletion_cache_.emplace(object_id);
+    ARROW_CHECK(RemoveFromClientObjectIds(object_id, entry, client) == 1);
+    return 1;
   } else {
     // The client requesting the abort is the creator. Free the object.
     EraseFromObjectTable(object_id);
@@ -720,6 +2373,129 @@ int PlasmaStore::AbortObject(const ObjectID& object_id, Client* client) {
   }
 }
 
+bool PlasmaStore::RunOnLoop(const std::function<void()>& task, int64_t timeout_ms) {
+  auto loop_task = std::make_shared<LoopTask>();
+  loop_task->run = task;
+  {
+    std::lock_guard<std::mutex> lock(loop_tasks_mutex_);
+    loop_tasks_.push_back(loop_task);
+  }
+  uint64_t one = 1;
+  ARROW_CHECK(write(loop_tasks_fd_, &one, sizeof(one)) == sizeof(one));
+
+  std::unique_lock<std::mutex> lock(loop_task->mutex);
+  if (!loop_task->done_cond.wait_for(lock, std::chrono::milliseconds(timeout_ms),
+                                     [&loop_task] { return loop_task->done; })) {
+    loop_task->cancelled = true;
+    return false;
+  }
+  return true;
+}
+
+void PlasmaStore::RunLoopTasks() {
+  uint64_t count;
+  // The eventfd is non-blocking, and another call may have drained it.
+  if (read(loop_tasks_fd_, &count, sizeof(count)) < 0 && errno != EAGAIN) {
+    ARROW_LOG(WARNING) << "failed to read the eventfd of the RPC thread: "
+                       << std::strerror(errno);
+  }
+  std::deque<std::shared_ptr<LoopTask>> tasks;
+  {
+    std::lock_guard<std::mutex> lock(loop_tasks_mutex_);
+    tasks.swap(loop_tasks_);
+  }
+  for (const auto& task : tasks) {
+    std::lock_guard<std::mutex> lock(task->mutex);
+    if (task->cancelled) {
+      continue;
+    }
+    task->run();
+    task->done = true;
+    task->done_cond.notify_one();
+  }
+}
+
+void PlasmaStore::AllocateForPeer(const ObjectID& object_id, int64_t data_size,
+                                  int64_t metadata_size,
+                                  plasmaRPC::ObjectDetails* details) {
+  // The reply is filled in on the loop, so the RPC thread must not look at it
+  // if it gave up waiting.
+  plasmaRPC::ObjectDetails reply;
+  bool ran = RunOnLoop(
+      [&] {
+        PlasmaObject object = {};
+        // The remote store only asks when its own region is full, so do not
+        // evict objects here to make room for its objects.
+        PlasmaError error = CreateObject(object_id, /*evict_if_full=*/false, data_size,
+                                         metadata_size, /*device_num=*/0, &peer_client_,
+                                         &object);
+        if (error == PlasmaError::ObjectExists) {
+          reply.set_status(plasmaRPC::ObjectDetails::EXISTS);
+          return;
+        }
+        if (error != PlasmaError::OK) {
+          reply.set_status(plasmaRPC::ObjectDetails::OUT_OF_MEMORY);
+          return;
+        }
+        reply.set_status(plasmaRPC::ObjectDetails::OK);
+        auto rpc_object = reply.mutable_object();
+        rpc_object->set_data_offset(object.data_offset);
+        rpc_object->set_metadata_offset(object.metadata_offset);
+        rpc_object->set_data_size(object.data_size);
+        rpc_object->set_metadata_size(object.metadata_size);
+        rpc_object->set_device_num(0);
+        num_peer_allocations_ += 1;
+      },
+      kPeerRequestTimeoutMs);
+  if (!ran) {
+    // Leaving the object to the remote store is safe: it falls back to its own
+    // region.
+    num_peer_timeouts_ += 1;
+    details->set_status(plasmaRPC::ObjectDetails::OUT_OF_MEMORY);
+    return;
+  }
+  details->Swap(&reply);
+}
+
+bool PlasmaStore::SealForPeer(const ObjectID& object_id) {
+  bool sealed = false;
+  bool ran = RunOnLoop(
+      [&] {
+        auto entry = GetObjectTableEntry(&store_info_, object_id);
+        if (entry == nullptr || entry->state != ObjectState::PLASMA_CREATED ||
+            peer_client_.object_ids.count(object_id) == 0) {
+          return;
+        }
+        // The client of the remote store computed the digest, but the seal
+        // request of the remote store does not carry it.
+        SealObjects({object_id}, {std::string(kDigestSize, 0)});
+        ReleaseObject(object_id, &peer_client_);
+        sealed = true;
+      },
+      kPeerRequestTimeoutMs);
+  if (!ran) {
+    num_peer_timeouts_ += 1;
+  }
+  return ran && sealed;
+}
+
+bool PlasmaStore::AbortForPeer(const ObjectID& object_id) {
+  bool aborted = false;
+  bool ran = RunOnLoop(
+      [&] {
+        auto entry = GetObjectTableEntry(&store_info_, object_id);
+        if (entry == nullptr || entry->state != ObjectState::PLASMA_CREATED) {
+          return;
+        }
+        aborted = AbortObject(object_id, &peer_client_) == 1;
+      },
+      kPeerRequestTimeoutMs);
+  if (!ran) {
+    num_peer_timeouts_ += 1;
+  }
+  return ran && aborted;
+}
+
 PlasmaError PlasmaStore::DeleteObject(ObjectID& object_id) {
   auto entry = GetObjectTableEntry(&store_info_, object_id);
   // TODO(rkn): This should probably not fail, but should instead throw an
@@ -730,6 +2506,17 @@ PlasmaError PlasmaStore::DeleteObject(ObjectID& object_id) {
     return PlasmaError::ObjectNotFound;
   }
 
+  if (entry->state == ObjectState::PLASMA_COMPRESSED) {
+    // Nobody can be using a compressed object.
+    compressed_objects_.Remove(object_id);
+    EraseFromObjectTable(object_id);
+    fb::ObjectInfoT notification;
+    notification.object_id = object_id.binary();
+    notification.is_deletion = true;
+    PushNotification(&notification);
+    return PlasmaError::OK;
+  }
+
   if (entry->state != ObjectState::PLASMA_SEALED) {
     // To delete an object it must have been sealed.
     // Put it into deletion cache, it will be deleted later.
@@ -737,6 +2524,15 @@ PlasmaError PlasmaStore::DeleteObject(ObjectID& object_id) {
     return PlasmaError::ObjectNotSealed;
   }
 
+  // Clients that only keep a lease on the object are not using it.
+  if (RevokeIdleLeases(object_id) > 0) {
+    entry = GetObjectTableEntry(&store_info_, object_id);
+    if (entry == nullptr || entry->state != ObjectState::PLASMA_SEALED) {
+      // The last lease was on an object that was waiting to be deleted.
+      return PlasmaError::OK;
+    }
+  }
+
   if (entry->ref_count != 0) {
     // To delete an object, there must be no clients currently using it.
     // Put it into deletion cache, it will be deleted later.
@@ -760,6 +2556,7 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
     return;
   }
 
+  std::vector<ObjectID> external_ids;
   std::vector<std::shared_ptr<arrow::Buffer>> evicted_object_data;
   std::vector<ObjectTableEntry*> evicted_entries;
   for (const auto& object_id : object_ids) {
@@ -776,10 +2573,12 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
 
     // If there is a backing external store, then mark object for eviction to
     // external store, free the object data pointer and keep a placeholder
-    // entry in ObjectTable
-    if (external_store_) {
+    // entry in ObjectTable. Views have no memory of their own to free.
+    if (external_store_ && view_parents_.count(object_id) == 0) {
+      external_ids.push_back(object_id);
+      object_directory_->Remove(object_id);
       evicted_object_data.push_back(std::make_shared<arrow::Buffer>(
-          entry->pointer, entry->data_size + entry->metadata_size));
+          entry->pointer + entry->offset, entry->data_size + entry->metadata_size));
       evicted_entries.push_back(entry);
     } else {
       // If there is no backing external store, just erase the object entry
@@ -793,11 +2592,15 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
     }
   }
 
-  if (external_store_ && !object_ids.empty()) {
-    ARROW_CHECK_OK(external_store_->Put(object_ids, evicted_object_data));
+  if (!external_ids.empty()) {
+    ARROW_CHECK_OK(external_store_->Put(external_ids, evicted_object_data));
     std::lock_guard<std::mutex> lock(mutex_);
-    for (auto entry : evicted_entries) {
-      PlasmaAllocator::Free(entry->pointer + entry->offset, entry->data_size + entry->metadata_size);
+    for (size_t i = 0; i < external_ids.size(); ++i) {
+      auto entry = evicted_entries[i];
+      if (!DetachFromSharedMemory(external_ids[i], entry)) {
+        PlasmaAllocator::Free(entry->pointer + entry->offset,
+                              entry->data_size + entry->metadata_size);
+      }
       entry->pointer = nullptr;
       entry->state = ObjectState::PLASMA_EVICTED;
     }
@@ -813,7 +2616,7 @@ void PlasmaStore::ConnectClient(int listener_sock) {
   // Add a callback to handle events on this socket.
   // TODO(pcm): Check return value.
   loop_->AddFileEvent(client_fd, kEventLoopRead, [this, client](int events) {
-    Status s = ProcessMessage(client);
+    Status s = scheduling_.fair_queuing ? QueueMessage(client) : ProcessMessage(client);
     if (!s.ok()) {
       ARROW_LOG(FATAL) << "Failed to process file event: " << s;
     }
@@ -831,18 +2634,50 @@ void PlasmaStore::DisconnectClient(int client_fd) {
   ARROW_LOG(INFO) << "Disconnecting client on fd " << client_fd;
   // Release all the objects that the client was using.
   auto client = it->second.get();
+  if (queued_requests_.erase(client) > 0) {
+    fair_queue_.Remove(client_fd);
+  }
   eviction_policy_.ClientDisconnected(client);
   std::unordered_map<ObjectID, ObjectTableEntry*> sealed_objects;
+  std::vector<ObjectID> streams_to_close;
+  RemoveStreamWaitRequestsForClient(client);
+  RemoveWaitRequestsForClient(client);
+  remote_lookups_.Cancel(client);
+  // Free the objects the client did not seal in the remote region.
+  std::vector<ObjectID> remote_objects_to_abort;
+  for (auto it = remote_creates_.begin(); it != remote_creates_.end();) {
+    if (it->second.client != client) {
+      ++it;
+      continue;
+    }
+    if (!it->second.sealed) {
+      remote_objects_to_abort.push_back(it->first);
+    }
+    it = remote_creates_.erase(it);
+  }
+  if (!remote_objects_to_abort.empty() &&
+      !rpc_client_.AbortObjects(remote_objects_to_abort)) {
+    ARROW_LOG(WARNING) << "the remote store did not abort the objects of client "
+                       << client_fd;
+  }
   for (const auto& object_id : client->object_ids) {
     auto entry = GetObjectTableEntry(&store_info_, object_id);
     if (!entry) {
       continue;
     }
 
+    auto writer = stream_writers_.find(object_id);
     if (entry->state == ObjectState::PLASMA_SEALED) {
       // Add sealed objects to a temporary list of object IDs. Do not perform
       // the remove here, since it potentially modifies the object_ids table.
       sealed_objects[object_id] = entry;
+    } else if (writer != stream_writers_.end()) {
+      // Open streams are released like sealed objects. If this client was
+      // writing the stream, its readers get what was published so far.
+      if (writer->second == client) {
+        streams_to_close.push_back(object_id);
+      }
+      sealed_objects[object_id] = entry;
     } else {
       // Abort unsealed object.
       // Don't call AbortObject() because client->object_ids would be modified.
@@ -853,6 +2688,10 @@ void PlasmaStore::DisconnectClient(int client_fd) {
   /// Remove all of the client's GetRequests.
   RemoveGetRequestsForClient(client);
 
+  for (const auto& object_id : streams_to_close) {
+    CloseStream(object_id);
+  }
+
   for (const auto& entry : sealed_objects) {
     RemoveFromClientObjectIds(entry.first, entry.second, client);
   }
@@ -864,6 +2703,10 @@ void PlasmaStore::DisconnectClient(int client_fd) {
     // Close socket.
     close(notify_fd);
     // Remove notification queue for this fd from global map.
+    auto queue = pending_notifications_.find(notify_fd);
+    if (queue != pending_notifications_.end() && queue->second.ring_pointer != nullptr) {
+      munmap(queue->second.ring_pointer, queue->second.ring_size);
+    }
     pending_notifications_.erase(notify_fd);
     // Reset fd.
     client->notification_fd = -1;
@@ -893,10 +2736,10 @@ PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
   for (size_t i = 0; i < notifications.size(); ++i) {
     auto& notification = notifications.at(i);
     // Decode the length, which is the first bytes of the message.
-    int64_t size = *(reinterpret_cast<int64_t*>(notification.get()));
+    int64_t size = *(reinterpret_cast<int64_t*>(notification.data()));
 
     // Attempt to send a notification about this object ID.
-    ssize_t nbytes = send(client_fd, notification.get(), sizeof(int64_t) + size, 0);
+    ssize_t nbytes = send(client_fd, notification.data(), sizeof(int64_t) + size, 0);
     if (nbytes >= 0) {
       ARROW_CHECK(nbytes == static_cast<ssize_t>(sizeof(int64_t)) + size);
     } else if (nbytes == -1 &&
@@ -922,7 +2765,13 @@ PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
     }
     num_processed += 1;
   }
-  // Remove the sent notifications from the array.
+  // Remove the sent notifications from the array, keeping their buffers.
+  auto& free_buffers = it->second.free_buffers;
+  for (int i = 0; i < num_processed; ++i) {
+    if (free_buffers.size() < kMaxFreeNotificationBuffers) {
+      free_buffers.push_back(std::move(notifications[i]));
+    }
+  }
   notifications.erase(notifications.begin(), notifications.begin() + num_processed);
 
   // If we have sent all notifications, remove the fd from the event loop.
@@ -939,39 +2788,147 @@ PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
   }
 }
 
-void PlasmaStore::PushNotification(fb::ObjectInfoT* object_info) {
-  auto it = pending_notifications_.begin();
-  while (it != pending_notifications_.end()) {
-    std::vector<fb::ObjectInfoT> info;
-    info.push_back(*object_info);
-    auto notification = CreatePlasmaNotificationBuffer(info);
-    it->second.object_notifications.emplace_back(std::move(notification));
-    it = SendNotifications(it);
+void PlasmaStore::QueueNotification(NotificationQueue* queue, const uint8_t* data,
+                                    size_t size) {
+  std::vector<uint8_t> notification;
+  if (!queue->free_buffers.empty()) {
+    notification = std::move(queue->free_buffers.back());
+    queue->free_buffers.pop_back();
   }
+  // The length comes first, as in CreatePlasmaNotificationBuffer.
+  int64_t length = size;
+  notification.resize(sizeof(length) + size);
+  std::memcpy(notification.data(), &length, sizeof(length));
+  std::memcpy(notification.data() + sizeof(length), data, size);
+  queue->object_notifications.push_back(std::move(notification));
+}
+
+void PlasmaStore::PushNotification(fb::ObjectInfoT* object_info) {
+  PushNotifications(object_info, 1);
 }
 
 void PlasmaStore::PushNotifications(std::vector<fb::ObjectInfoT>& object_info) {
+  PushNotifications(object_info.data(), object_info.size());
+}
+
+void PlasmaStore::PushNotifications(const fb::ObjectInfoT* object_info,
+                                    size_t num_objects) {
+  if (pending_notifications_.empty()) {
+    return;
+  }
+  // The notification is built once for all subscribers on sockets.
+  flatbuffers::FlatBufferBuilder* fbb = nullptr;
   auto it = pending_notifications_.begin();
   while (it != pending_notifications_.end()) {
-    auto notifications = CreatePlasmaNotificationBuffer(object_info);
-    it->second.object_notifications.emplace_back(std::move(notifications));
+    if (it->second.ring) {
+      PushToRing(it->first, &it->second, object_info, num_objects);
+      ++it;
+      continue;
+    }
+    if (fbb == nullptr) {
+      fbb = &BuildNotification(object_info, num_objects);
+    }
+    QueueNotification(&it->second, fbb->GetBufferPointer(), fbb->GetSize());
     it = SendNotifications(it);
   }
 }
 
 void PlasmaStore::PushNotification(fb::ObjectInfoT* object_info, int client_fd) {
   auto it = pending_notifications_.find(client_fd);
-  if (it != pending_notifications_.end()) {
-    std::vector<fb::ObjectInfoT> info;
-    info.push_back(*object_info);
-    auto notification = CreatePlasmaNotificationBuffer(info);
-    it->second.object_notifications.emplace_back(std::move(notification));
-    SendNotifications(it);
+  if (it == pending_notifications_.end()) {
+    return;
+  }
+  if (it->second.ring) {
+    PushToRing(client_fd, &it->second, object_info, 1);
+    return;
+  }
+  auto& fbb = BuildNotification(object_info, 1);
+  QueueNotification(&it->second, fbb.GetBufferPointer(), fbb.GetSize());
+  SendNotifications(it);
+}
+
+flatbuffers::FlatBufferBuilder& PlasmaStore::BuildNotification(
+    const ObjectInfoT* object_info, size_t num_objects) {
+  notification_builder_.Clear();
+  notification_infos_.clear();
+  for (size_t i = 0; i < num_objects; ++i) {
+    notification_infos_.push_back(
+        fb::CreateObjectInfo(notification_builder_, &object_info[i]));
+  }
+  notification_builder_.Finish(fb::CreatePlasmaNotification(
+      notification_builder_, notification_builder_.CreateVector(notification_infos_)));
+  return notification_builder_;
+}
+
+void PlasmaStore::PushToRing(int wakeup_fd, NotificationQueue* queue,
+                             const fb::ObjectInfoT* object_info, size_t num_objects) {
+  NotificationRing* ring = queue->ring.get();
+  auto& overflow = queue->ring_overflow;
+  while (!overflow.empty() && ring->Push(overflow.front().object_id,
+                                         overflow.front().data_size,
+                                         overflow.front().metadata_size)) {
+    overflow.pop_front();
+  }
+  for (size_t i = 0; i < num_objects; ++i) {
+    RingNotification notification;
+    notification.object_id = ObjectID::from_binary(object_info[i].object_id);
+    notification.data_size = object_info[i].is_deletion ? -1 : object_info[i].data_size;
+    notification.metadata_size =
+        object_info[i].is_deletion ? -1 : object_info[i].metadata_size;
+    // Once one notification waits, the later ones wait behind it.
+    if (!overflow.empty() ||
+        !ring->Push(notification.object_id, notification.data_size,
+                    notification.metadata_size)) {
+      overflow.push_back(notification);
+    }
+  }
+  num_ring_notifications_ += num_objects;
+  // The subscriber only needs a wakeup if it read everything before, so a
+  // subscriber that keeps up with a burst of seals costs no syscalls.
+  if (ring->Publish()) {
+    uint64_t one = 1;
+    if (write(wakeup_fd, &one, sizeof(one)) < 0 && errno != EAGAIN) {
+      ARROW_LOG(WARNING) << "failed to wake the subscriber on fd " << wakeup_fd << ": "
+                         << std::strerror(errno);
+    }
+    num_ring_wakeups_ += 1;
+  }
+  if (!overflow.empty()) {
+    ScheduleRingRetry();
+  }
+}
+
+int PlasmaStore::RetryRingNotifications() {
+  // Pushing below must not reschedule the timer while it runs.
+  ring_retry_sleeps_ = false;
+  bool waiting = false;
+  for (auto& entry : pending_notifications_) {
+    if (entry.second.ring && !entry.second.ring_overflow.empty()) {
+      PushToRing(entry.first, &entry.second, nullptr, 0);
+      waiting = waiting || !entry.second.ring_overflow.empty();
+    }
+  }
+  if (!waiting) {
+    ring_retry_sleeps_ = true;
+    return kRingRetryIdleMs;
+  }
+  return kRingRetryMs;
+}
+
+void PlasmaStore::ScheduleRingRetry() {
+  if (ring_retry_timer_ != -1) {
+    if (!ring_retry_sleeps_) {
+      return;
+    }
+    loop_->RemoveTimer(ring_retry_timer_);
   }
+  ring_retry_sleeps_ = false;
+  ring_retry_timer_ = loop_->AddTimer(
+      kRingRetryMs, [this](int64_t timer_id) { return RetryRingNotifications(); });
 }
 
 // Subscribe to notifications about sealed objects.
-void PlasmaStore::SubscribeToUpdates(Client* client) {
+void PlasmaStore::SubscribeToUpdates(Client* client, bool notification_ring) {
   ARROW_LOG(DEBUG) << "subscribing to updates on fd " << client->fd;
   if (client->notification_fd > 0) {
     // This client has already subscribed. Return.
@@ -988,165 +2945,433 @@ void PlasmaStore::SubscribeToUpdates(Client* client) {
     return;
   }
 
+  NotificationQueue queue;
+  if (notification_ring) {
+    // The first file descriptor is the ring, the second one the eventfd that
+    // wakes the client and that stands for the subscription from now on.
+    int ring_fd = fd;
+    fd = recv_fd(client->fd);
+    Status s = MapNotificationRing(ring_fd, &queue);
+    close(ring_fd);
+    if (fd < 0 || !s.ok()) {
+      ARROW_LOG(WARNING) << "Failed to subscribe client on fd " << client->fd
+                         << " with a notification ring: "
+                         << (fd < 0 ? "no eventfd" : s.ToString());
+      if (fd >= 0) {
+        close(fd);
+      }
+      if (queue.ring_pointer != nullptr) {
+        munmap(queue.ring_pointer, queue.ring_size);
+      }
+      return;
+    }
+  }
+
   // Add this fd to global map, which is needed for this client to receive notifications.
-  pending_notifications_[fd];
+  pending_notifications_[fd] = std::move(queue);
   client->notification_fd = fd;
 
   // Push notifications to the new subscriber about existing sealed objects.
   for (const auto& entry : store_info_.objects) {
-    if (entry.second->state == ObjectState::PLASMA_SEALED) {
+    if (entry.second.state == ObjectState::PLASMA_SEALED) {
       ObjectInfoT info;
       info.object_id = entry.first.binary();
-      info.data_size = entry.second->data_size;
-      info.metadata_size = entry.second->metadata_size;
+      info.data_size = entry.second.stream_size != -1 ? entry.second.stream_size
+                                                      : entry.second.data_size;
+      info.metadata_size = entry.second.metadata_size;
       info.digest =
-          std::string(reinterpret_cast<char*>(&entry.second->digest[0]), kDigestSize);
+          std::string(reinterpret_cast<const char*>(&entry.second.digest[0]), kDigestSize);
       PushNotification(&info, fd);
     }
   }
 }
 
+Status PlasmaStore::QueueMessage(Client* client) {
+  QueuedRequest& request = queued_requests_[client];
+  Status s = ReadMessage(client->fd, &request.type, &request.message);
+  ARROW_CHECK(s.ok() || s.IsIOError());
+  if (request.type == fb::MessageType::PlasmaDisconnectClient) {
+    // Nothing waits on a client that is gone.
+    ARROW_LOG(DEBUG) << "Disconnecting client on fd " << client->fd;
+    DisconnectClient(client->fd);
+    return Status::OK();
+  }
+  request.cost = kRequestCost;
+  request.large_create = false;
+  request.waited_for_tokens = false;
+  if (request.type == fb::MessageType::PlasmaCreateRequest) {
+    ObjectID object_id;
+    bool evict_if_full;
+    int64_t data_size;
+    int64_t metadata_size;
+    int device_num;
+    uint64_t request_id;
+    RETURN_NOT_OK(ReadCreateRequest(request.message.data(), request.message.size(),
+                                    &object_id, &evict_if_full, &data_size,
+                                    &metadata_size, &device_num, &request_id));
+    request.cost += data_size + metadata_size;
+    // Whether the object goes to the remote region is only known once it is
+    // created, so every large create of a client that may put it there waits
+    // for the bucket.
+    request.large_create = scheduling_.remote_bytes_per_second > 0 &&
+                           remote_allocation_ && client->remote_memory &&
+                           data_size + metadata_size >= kLargeCreateBytes;
+  }
+  loop_->RemoveFileEvent(client->fd);
+  fair_queue_.Push(client->fd, client->weight, request.cost);
+  num_queued_requests_ += 1;
+  ScheduleDispatch();
+  return Status::OK();
+}
+
+void PlasmaStore::ScheduleDispatch() {
+  if (dispatch_timer_ != -1) {
+    if (!dispatch_sleeps_) {
+      return;
+    }
+    loop_->RemoveTimer(dispatch_timer_);
+  }
+  dispatch_sleeps_ = false;
+  dispatch_timer_ =
+      loop_->AddTimer(0, [this](int64_t timer_id) { return DispatchRequests(); });
+}
+
+void PlasmaStore::RefillRemoteTokens() {
+  const int64_t rate = scheduling_.remote_bytes_per_second;
+  if (rate == 0) {
+    return;
+  }
+  auto now = std::chrono::steady_clock::now();
+  const int64_t elapsed_us =
+      std::chrono::duration_cast<std::chrono::microseconds>(now - last_refill_).count();
+  const int64_t tokens = elapsed_us * rate / 1000000;
+  if (tokens == 0) {
+    // Keep the time of the fraction of a byte for the next refill.
+    return;
+  }
+  last_refill_ = now;
+  remote_tokens_ = std::min(remote_tokens_ + tokens,
+                            std::max<int64_t>(rate * kTokenBucketBurstMs / 1000, 1));
+}
+
+int PlasmaStore::DispatchRequests() {
+  RefillRemoteTokens();
+  const int fd = fair_queue_.Pop([this](int fd) {
+    QueuedRequest& request = queued_requests_[connected_clients_[fd].get()];
+    if (!request.large_create || remote_tokens_ > 0) {
+      return false;
+    }
+    // The client saves up nothing while the bucket is empty.
+    if (!request.waited_for_tokens) {
+      request.waited_for_tokens = true;
+      num_waited_for_tokens_ += 1;
+    }
+    return true;
+  });
+  if (fd != -1) {
+    Client* client = connected_clients_[fd].get();
+    QueuedRequest& request = queued_requests_[client];
+    input_buffer_.swap(request.message);
+    Status s = ProcessRequest(client, request.type);
+    if (!s.ok()) {
+      ARROW_LOG(FATAL) << "Failed to process file event: " << s;
+    }
+    auto it = connected_clients_.find(fd);
+    if (it != connected_clients_.end() && it->second.get() == client) {
+      const bool more = HasInput(fd);
+      fair_queue_.Done(fd, more);
+      if (more) {
+        // The client keeps its turn while it can pay for its next request.
+        s = QueueMessage(client);
+        if (!s.ok()) {
+          ARROW_LOG(FATAL) << "Failed to process file event: " << s;
+        }
+      } else {
+        loop_->AddFileEvent(fd, kEventLoopRead, [this, client](int events) {
+          Status s = QueueMessage(client);
+          if (!s.ok()) {
+            ARROW_LOG(FATAL) << "Failed to process file event: " << s;
+          }
+        });
+      }
+    }
+  }
+  if (fair_queue_.empty()) {
+    dispatch_sleeps_ = true;
+    return kDispatchIdleMs;
+  }
+  if (fd == -1) {
+    // Only large creates are left, which wait until the bucket is positive
+    // again, unless a request that does not need tokens arrives.
+    dispatch_sleeps_ = true;
+    return static_cast<int>((1 - remote_tokens_) * 1000 /
+                                scheduling_.remote_bytes_per_second +
+                            1);
+  }
+  return 0;
+}
+
+void PlasmaStore::FinishCreateRequest(Client* client, const CreateRequest& request,
+                                      bool exists_remotely) {
+  const ObjectID& object_id = request.object_id;
+  PlasmaObject object = {};
+  PlasmaError error_code = PlasmaError::ObjectExists;
+  if (exists_remotely) {
+    // The object is in the remote store, so ignore this request.
+  } else if (request.type == fb::MessageType::PlasmaCreateRequest) {
+    // Objects that do not fit go to the remote region before anything is
+    // evicted for them, if the client can write there.
+    const bool place_remotely =
+        remote_allocation_ && client->remote_memory && request.device_num == 0;
+    error_code = CreateObject(object_id, request.evict_if_full && !place_remotely,
+                              request.data_size, request.metadata_size,
+                              request.device_num, client, &object);
+    if (error_code == PlasmaError::OutOfMemory && place_remotely) {
+      error_code = CreateRemoteObject(object_id, request.data_size, request.metadata_size,
+                                      client, &object);
+      if (error_code == PlasmaError::OK && scheduling_.remote_bytes_per_second > 0) {
+        remote_tokens_ -= request.data_size + request.metadata_size;
+        remote_bytes_admitted_ += request.data_size + request.metadata_size;
+      }
+      if (error_code == PlasmaError::OutOfMemory && request.evict_if_full) {
+        error_code = CreateObject(object_id, request.evict_if_full, request.data_size,
+                                  request.metadata_size, request.device_num, client,
+                                  &object);
+      }
+    }
+  } else {
+    error_code = CreateStream(object_id, request.evict_if_full, request.data_size,
+                              request.metadata_size, client, &object);
+  }
+  int64_t mmap_size = 0;
+  // Objects in the remote region have no file descriptor to send.
+  const bool has_fd =
+      error_code == PlasmaError::OK && request.device_num == 0 && object.store_fd != -1;
+  if (has_fd) {
+    mmap_size = GetMmapSize(object.store_fd);
+  }
+  Status s = SendCreateReply(client->fd, object_id, &object, error_code, mmap_size,
+                             request.request_id);
+  WarnIfSigpipe(s.ok() ? 0 : -1, client->fd);
+  // Only send the file descriptor if it hasn't been sent (see analogous
+  // logic in GetStoreFd in client.cc). Similar in ReturnFromGet.
+  if (s.ok() && has_fd &&
+      client->used_fds.find(object.store_fd) == client->used_fds.end()) {
+    WarnIfSigpipe(send_fd(client->fd, object.store_fd), client->fd);
+    client->used_fds.insert(object.store_fd);
+  }
+}
+
+void PlasmaStore::FinishCreateAndSealRequest(Client* client,
+                                             const CreateAndSealRequest& request,
+                                             bool exists_remotely) {
+  const auto& object_ids = request.object_ids;
+  // CreateAndSeal currently only supports device_num = 0, which corresponds
+  // to the host.
+  int device_num = 0;
+  PlasmaObject object = {};
+  PlasmaError error_code = exists_remotely ? PlasmaError::ObjectExists : PlasmaError::OK;
+  size_t num_created = 0;
+  while (error_code == PlasmaError::OK && num_created < object_ids.size()) {
+    error_code = CreateObject(object_ids[num_created], request.evict_if_full,
+                              request.data[num_created].size(),
+                              request.metadata[num_created].size(), device_num, client,
+                              &object);
+    if (error_code == PlasmaError::OK) {
+      num_created++;
+    }
+  }
+
+  // if OK, seal all the objects,
+  // if error, abort the objects created before immediately
+  if (error_code == PlasmaError::OK) {
+    for (size_t i = 0; i < object_ids.size(); i++) {
+      auto entry = GetObjectTableEntry(&store_info_, object_ids[i]);
+      ARROW_CHECK(entry != nullptr);
+      // Write the inlined data and metadata into the allocated object.
+      uint8_t* object_pointer = entry->pointer + entry->offset;
+      std::memcpy(object_pointer, request.data[i].data(), request.data[i].size());
+      std::memcpy(object_pointer + request.data[i].size(), request.metadata[i].data(),
+                  request.metadata[i].size());
+    }
+
+    SealObjects(object_ids, request.digests);
+    // Remove the client from the object's array of clients because the
+    // object is not being used by any client. The client was added to the
+    // object's array of clients in CreateObject. This is analogous to the
+    // Release call that happens in the client's Seal method.
+    for (size_t i = 0; i < object_ids.size(); i++) {
+      auto entry = GetObjectTableEntry(&store_info_, object_ids[i]);
+      ARROW_CHECK(RemoveFromClientObjectIds(object_ids[i], entry, client) == 1);
+    }
+  } else {
+    for (size_t i = 0; i < num_created; i++) {
+      AbortObject(object_ids[i], client);
+    }
+  }
+
+  Status s = request.batch ? SendCreateAndSealBatchReply(client->fd, error_code)
+                           : SendCreateAndSealReply(client->fd, error_code);
+  WarnIfSigpipe(s.ok() ? 0 : -1, client->fd);
+}
+
 Status PlasmaStore::ProcessMessage(Client* client) {
   fb::MessageType type;
   Status s = ReadMessage(client->fd, &type, &input_buffer_);
   ARROW_CHECK(s.ok() || s.IsIOError());
+  return ProcessRequest(client, type);
+}
 
+Status PlasmaStore::ProcessRequest(Client* client, fb::MessageType type) {
   uint8_t* input = input_buffer_.data();
   size_t input_size = input_buffer_.size();
   ObjectID object_id;
-  PlasmaObject object = {};
 
   // Process the different types of requests.
   switch (type) {
-    case fb::MessageType::PlasmaCreateRequest: {
-      bool evict_if_full;
-      int64_t data_size;
-      int64_t metadata_size;
-      int device_num;
-      RETURN_NOT_OK(ReadCreateRequest(input, input_size, &object_id, &evict_if_full,
-                                      &data_size, &metadata_size, &device_num));
-      PlasmaError error_code = CreateObject(object_id, evict_if_full, data_size,
-                                            metadata_size, device_num, client, &object);
-      int64_t mmap_size = 0;
-      if (error_code == PlasmaError::OK && device_num == 0) {
-        mmap_size = GetMmapSize(object.store_fd);
+    case fb::MessageType::PlasmaCreateRequest:
+    case fb::MessageType::PlasmaCreateStreamRequest: {
+      CreateRequest request = {};
+      request.type = type;
+      if (type == fb::MessageType::PlasmaCreateRequest) {
+        RETURN_NOT_OK(ReadCreateRequest(input, input_size, &request.object_id,
+                                        &request.evict_if_full, &request.data_size,
+                                        &request.metadata_size, &request.device_num,
+                                        &request.request_id));
+      } else {
+        RETURN_NOT_OK(ReadCreateStreamRequest(input, input_size, &request.object_id,
+                                              &request.evict_if_full, &request.data_size,
+                                              &request.metadata_size));
       }
-      HANDLE_SIGPIPE(
-          SendCreateReply(client->fd, object_id, &object, error_code, mmap_size),
-          client->fd);
-      // Only send the file descriptor if it hasn't been sent (see analogous
-      // logic in GetStoreFd in client.cc). Similar in ReturnFromGet.
-      if (error_code == PlasmaError::OK && device_num == 0 &&
-          client->used_fds.find(object.store_fd) == client->used_fds.end()) {
-        WarnIfSigpipe(send_fd(client->fd, object.store_fd), client->fd);
-        client->used_fds.insert(object.store_fd);
+      if (trace_ != nullptr) {
+        trace_->Record(client->fd, TraceOp::Create, request.object_id, request.data_size,
+                       request.metadata_size);
       }
+      LookupBeforeCreate(client, {request.object_id},
+                         [this, client, request](bool exists_remotely) {
+                           FinishCreateRequest(client, request, exists_remotely);
+                         });
     } break;
     case fb::MessageType::PlasmaCreateAndSealRequest: {
-      bool evict_if_full;
-      std::string data;
-      std::string metadata;
-      std::string digest;
-      digest.reserve(kDigestSize);
-      RETURN_NOT_OK(ReadCreateAndSealRequest(input, input_size, &object_id,
-                                             &evict_if_full, &data, &metadata, &digest));
-      // CreateAndSeal currently only supports device_num = 0, which corresponds
-      // to the host.
-      int device_num = 0;
-      PlasmaError error_code = CreateObject(object_id, evict_if_full, data.size(),
-                                            metadata.size(), device_num, client, &object);
-
-      // If the object was successfully created, fill out the object data and seal it.
-      if (error_code == PlasmaError::OK) {
-        auto entry = GetObjectTableEntry(&store_info_, object_id);
-        ARROW_CHECK(entry != nullptr);
-        // Write the inlined data and metadata into the allocated object.
-        std::memcpy(entry->pointer, data.data(), data.size());
-        std::memcpy(entry->pointer + data.size(), metadata.data(), metadata.size());
-        SealObjects({object_id}, {digest});
-        // Remove the client from the object's array of clients because the
-        // object is not being used by any client. The client was added to the
-        // object's array of clients in CreateObject. This is analogous to the
-        // Release call that happens in the client's Seal method.
-        ARROW_CHECK(RemoveFromClientObjectIds(object_id, entry, client) == 1);
+      auto request = std::make_shared<CreateAndSealRequest>();
+      request->batch = false;
+      request->object_ids.resize(1);
+      request->data.resize(1);
+      request->metadata.resize(1);
+      request->digests.resize(1);
+      request->digests[0].reserve(kDigestSize);
+      RETURN_NOT_OK(ReadCreateAndSealRequest(
+          input, input_size, &request->object_ids[0], &request->evict_if_full,
+          &request->data[0], &request->metadata[0], &request->digests[0]));
+      if (trace_ != nullptr) {
+        // The client does not release what it created and sealed in one
+        // request, the store does it for it.
+        trace_->Record(client->fd, TraceOp::Create, request->object_ids[0],
+                       request->data[0].size(), request->metadata[0].size());
+        trace_->Record(client->fd, TraceOp::Seal, request->object_ids[0]);
+        trace_->Record(client->fd, TraceOp::Release, request->object_ids[0]);
       }
-
-      // Reply to the client.
-      HANDLE_SIGPIPE(SendCreateAndSealReply(client->fd, error_code), client->fd);
+      LookupBeforeCreate(client, request->object_ids,
+                         [this, client, request](bool exists_remotely) {
+                           FinishCreateAndSealRequest(client, *request, exists_remotely);
+                         });
     } break;
     case fb::MessageType::PlasmaCreateAndSealBatchRequest: {
-      bool evict_if_full;
-      std::vector<ObjectID> object_ids;
-      std::vector<std::string> data;
-      std::vector<std::string> metadata;
-      std::vector<std::string> digests;
-
+      auto request = std::make_shared<CreateAndSealRequest>();
+      request->batch = true;
       RETURN_NOT_OK(ReadCreateAndSealBatchRequest(
-          input, input_size, &object_ids, &evict_if_full, &data, &metadata, &digests));
-
-      // CreateAndSeal currently only supports device_num = 0, which corresponds
-      // to the host.
-      int device_num = 0;
-      size_t i = 0;
-      PlasmaError error_code = PlasmaError::OK;
-      for (i = 0; i < object_ids.size(); i++) {
-        error_code = CreateObject(object_ids[i], evict_if_full, data[i].size(),
-                                  metadata[i].size(), device_num, client, &object);
-        if (error_code != PlasmaError::OK) {
-          break;
-        }
-      }
-
-      // if OK, seal all the objects,
-      // if error, abort the previous i objects immediately
-      if (error_code == PlasmaError::OK) {
-        for (i = 0; i < object_ids.size(); i++) {
-          auto entry = GetObjectTableEntry(&store_info_, object_ids[i]);
-          ARROW_CHECK(entry != nullptr);
-          // Write the inlined data and metadata into the allocated object.
-          std::memcpy(entry->pointer, data[i].data(), data[i].size());
-          std::memcpy(entry->pointer + data[i].size(), metadata[i].data(),
-                      metadata[i].size());
-        }
-
-        SealObjects(object_ids, digests);
-        // Remove the client from the object's array of clients because the
-        // object is not being used by any client. The client was added to the
-        // object's array of clients in CreateObject. This is analogous to the
-        // Release call that happens in the client's Seal method.
-        for (i = 0; i < object_ids.size(); i++) {
-          auto entry = GetObjectTableEntry(&store_info_, object_ids[i]);
-          ARROW_CHECK(RemoveFromClientObjectIds(object_ids[i], entry, client) == 1);
-        }
-      } else {
-        for (size_t j = 0; j < i; j++) {
-          AbortObject(object_ids[j], client);
+          input, input_size, &request->object_ids, &request->evict_if_full,
+          &request->data, &request->metadata, &request->digests));
+      if (trace_ != nullptr) {
+        for (size_t j = 0; j < request->object_ids.size(); j++) {
+          trace_->Record(client->fd, TraceOp::Create, request->object_ids[j],
+                         request->data[j].size(), request->metadata[j].size());
+          trace_->Record(client->fd, TraceOp::Seal, request->object_ids[j]);
+          trace_->Record(client->fd, TraceOp::Release, request->object_ids[j]);
         }
       }
-
-      HANDLE_SIGPIPE(SendCreateAndSealBatchReply(client->fd, error_code), client->fd);
+      LookupBeforeCreate(client, request->object_ids,
+                         [this, client, request](bool exists_remotely) {
+                           FinishCreateAndSealRequest(client, *request, exists_remotely);
+                         });
+    } break;
+    case fb::MessageType::PlasmaCreateViewRequest: {
+      ObjectID parent_id;
+      int64_t offset;
+      int64_t length;
+      RETURN_NOT_OK(ReadCreateViewRequest(input, input_size, &parent_id, &offset, &length,
+                                          &object_id));
+      PlasmaError error_code = CreateView(parent_id, offset, length, object_id, client);
+      HANDLE_SIGPIPE(SendCreateViewReply(client->fd, error_code), client->fd);
     } break;
     case fb::MessageType::PlasmaAbortRequest: {
       RETURN_NOT_OK(ReadAbortRequest(input, input_size, &object_id));
+      if (trace_ != nullptr) {
+        trace_->Record(client->fd, TraceOp::Abort, object_id);
+      }
+      auto remote_create = remote_creates_.find(object_id);
+      if (remote_create != remote_creates_.end()) {
+        ARROW_CHECK(remote_create->second.client == client && !remote_create->second.sealed)
+            << "To abort an object, the only client currently using it must be the "
+               "creator.";
+        if (!rpc_client_.AbortObjects({object_id})) {
+          ARROW_LOG(WARNING) << "the remote store did not abort " << object_id.hex();
+        }
+        remote_creates_.erase(remote_create);
+        HANDLE_SIGPIPE(SendAbortReply(client->fd, object_id), client->fd);
+        break;
+      }
       ARROW_CHECK(AbortObject(object_id, client) == 1) << "To abort an object, the only "
                                                           "client currently using it "
                                                           "must be the creator.";
       HANDLE_SIGPIPE(SendAbortReply(client->fd, object_id), client->fd);
     } break;
     case fb::MessageType::PlasmaGetRequest: {
-      std::vector<ObjectID> object_ids_to_get;
       int64_t timeout_ms;
-      RETURN_NOT_OK(ReadGetRequest(input, input_size, object_ids_to_get, &timeout_ms));
-      ProcessGetRequest(client, object_ids_to_get, timeout_ms);
+      uint64_t request_id;
+      RETURN_NOT_OK(ReadGetRequest(input, input_size, get_object_ids_, &timeout_ms,
+                                   &request_id));
+      if (trace_ != nullptr) {
+        for (const auto& get_object_id : get_object_ids_) {
+          trace_->Record(client->fd, TraceOp::Get, get_object_id, timeout_ms, 0,
+                         static_cast<int32_t>(get_object_ids_.size()));
+        }
+      }
+      ProcessGetRequest(client, get_object_ids_, timeout_ms, request_id);
+    } break;
+    case fb::MessageType::PlasmaWaitRequest: {
+      std::vector<ObjectID> object_ids_to_wait_for;
+      int64_t num_ready_objects;
+      int64_t timeout_ms;
+      RETURN_NOT_OK(ReadWaitRequest(input, input_size, &object_ids_to_wait_for,
+                                    &num_ready_objects, &timeout_ms));
+      ProcessWaitRequest(client, object_ids_to_wait_for, num_ready_objects, timeout_ms);
     } break;
     case fb::MessageType::PlasmaReleaseRequest: {
       RETURN_NOT_OK(ReadReleaseRequest(input, input_size, &object_id));
+      if (trace_ != nullptr) {
+        trace_->Record(client->fd, TraceOp::Release, object_id);
+      }
+      auto remote_create = remote_creates_.find(object_id);
+      if (remote_create != remote_creates_.end() &&
+          remote_create->second.client == client) {
+        // The remote store holds no reference for the client, so there is
+        // nothing left to release.
+        remote_creates_.erase(remote_create);
+        break;
+      }
       ReleaseObject(object_id, client);
     } break;
     case fb::MessageType::PlasmaDeleteRequest: {
       std::vector<ObjectID> object_ids;
       std::vector<PlasmaError> error_codes;
       RETURN_NOT_OK(ReadDeleteRequest(input, input_size, &object_ids));
+      if (trace_ != nullptr) {
+        for (const auto& delete_object_id : object_ids) {
+          trace_->Record(client->fd, TraceOp::Delete, delete_object_id, 0, 0,
+                         static_cast<int32_t>(object_ids.size()));
+        }
+      }
       error_codes.reserve(object_ids.size());
       for (auto& object_id : object_ids) {
         error_codes.push_back(DeleteObject(object_id));
@@ -1155,21 +3380,47 @@ Status PlasmaStore::ProcessMessage(Client* client) {
     } break;
     case fb::MessageType::PlasmaContainsRequest: {
       RETURN_NOT_OK(ReadContainsRequest(input, input_size, &object_id));
-      if (ContainsObject(object_id) == ObjectStatus::OBJECT_FOUND) {
-        HANDLE_SIGPIPE(SendContainsReply(client->fd, object_id, 1), client->fd);
-      } else {
-        HANDLE_SIGPIPE(SendContainsReply(client->fd, object_id, 0), client->fd);
-      }
+      ProcessContainsRequest(client, object_id);
     } break;
     case fb::MessageType::PlasmaListRequest: {
-      RETURN_NOT_OK(ReadListRequest(input, input_size));
-      HANDLE_SIGPIPE(SendListReply(client->fd, store_info_.objects), client->fd);
+      ObjectListFilter filter;
+      int64_t page_size;
+      uint64_t cursor;
+      RETURN_NOT_OK(ReadListRequest(input, input_size, &filter, &page_size, &cursor));
+      ProcessListRequest(client, filter, page_size, cursor);
     } break;
     case fb::MessageType::PlasmaSealRequest: {
-      std::string digest;
-      RETURN_NOT_OK(ReadSealRequest(input, input_size, &object_id, &digest));
-      SealObjects({object_id}, {digest});
-      HANDLE_SIGPIPE(SendSealReply(client->fd, object_id, PlasmaError::OK), client->fd);
+      uint64_t request_id;
+      seal_object_ids_.resize(1);
+      seal_digests_.resize(1);
+      RETURN_NOT_OK(ReadSealRequest(input, input_size, &seal_object_ids_[0],
+                                    &seal_digests_[0], &request_id));
+      if (trace_ != nullptr) {
+        trace_->Record(client->fd, TraceOp::Seal, seal_object_ids_[0]);
+      }
+      PlasmaError error_code = PlasmaError::OK;
+      if (remote_creates_.count(seal_object_ids_[0]) > 0) {
+        if (!SealRemoteObject(seal_object_ids_[0])) {
+          error_code = PlasmaError::ObjectNotFound;
+        }
+      } else {
+        SealObjects(seal_object_ids_, seal_digests_);
+      }
+      HANDLE_SIGPIPE(
+          SendSealReply(client->fd, seal_object_ids_[0], error_code, request_id),
+          client->fd);
+    } break;
+    case fb::MessageType::PlasmaPublishRequest: {
+      int64_t stream_size;
+      RETURN_NOT_OK(ReadPublishRequest(input, input_size, &object_id, &stream_size));
+      PublishStream(object_id, stream_size, client);
+    } break;
+    case fb::MessageType::PlasmaWaitStreamRequest: {
+      int64_t stream_size;
+      int64_t timeout_ms;
+      RETURN_NOT_OK(ReadWaitStreamRequest(input, input_size, &object_id, &stream_size,
+                                          &timeout_ms));
+      ProcessWaitStreamRequest(client, object_id, stream_size, timeout_ms);
     } break;
     case fb::MessageType::PlasmaEvictRequest: {
       // This code path should only be used for testing.
@@ -1181,16 +3432,28 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       EvictObjects(objects_to_evict);
       HANDLE_SIGPIPE(SendEvictReply(client->fd, num_bytes_evicted), client->fd);
     } break;
+    case fb::MessageType::PlasmaGrowRegionRequest: {
+      int64_t memory_capacity;
+      RETURN_NOT_OK(ReadGrowRegionRequest(input, input_size, &memory_capacity));
+      PlasmaError error = GrowRegion(memory_capacity);
+      HANDLE_SIGPIPE(
+          SendGrowRegionReply(client->fd, error, PlasmaAllocator::GetFootprintLimit()),
+          client->fd);
+    } break;
     case fb::MessageType::PlasmaRefreshLRURequest: {
       std::vector<ObjectID> object_ids;
       RETURN_NOT_OK(ReadRefreshLRURequest(input, input_size, &object_ids));
       eviction_policy_.RefreshObjects(object_ids);
       HANDLE_SIGPIPE(SendRefreshLRUReply(client->fd), client->fd);
     } break;
-    case fb::MessageType::PlasmaSubscribeRequest:
-      SubscribeToUpdates(client);
-      break;
+    case fb::MessageType::PlasmaSubscribeRequest: {
+      bool notification_ring;
+      RETURN_NOT_OK(ReadSubscribeRequest(input, input_size, &notification_ring));
+      SubscribeToUpdates(client, notification_ring);
+    } break;
     case fb::MessageType::PlasmaConnectRequest: {
+      RETURN_NOT_OK(ReadConnectRequest(input, input_size, &client->numa_node,
+                                       &client->remote_memory));
       HANDLE_SIGPIPE(SendConnectReply(client->fd, PlasmaAllocator::GetFootprintLimit()),
                      client->fd);
     } break;
@@ -1201,16 +3464,33 @@ Status PlasmaStore::ProcessMessage(Client* client) {
     case fb::MessageType::PlasmaSetOptionsRequest: {
       std::string client_name;
       int64_t output_memory_quota;
-      RETURN_NOT_OK(
-          ReadSetOptionsRequest(input, input_size, &client_name, &output_memory_quota));
+      int weight;
+      RETURN_NOT_OK(ReadSetOptionsRequest(input, input_size, &client_name,
+                                          &output_memory_quota, &weight));
       client->name = client_name;
-      bool success = eviction_policy_.SetClientQuota(client, output_memory_quota);
+      bool success = true;
+      if (weight > 0) {
+        client->weight = weight;
+      }
+      // A weight can be set without a quota.
+      if (output_memory_quota != 0 || weight == 0) {
+        success = eviction_policy_.SetClientQuota(client, output_memory_quota);
+      }
       HANDLE_SIGPIPE(SendSetOptionsReply(client->fd, success ? PlasmaError::OK
                                                              : PlasmaError::OutOfMemory),
                      client->fd);
     } break;
     case fb::MessageType::PlasmaGetDebugStringRequest: {
-      HANDLE_SIGPIPE(SendGetDebugStringReply(client->fd, eviction_policy_.DebugString()),
+      HANDLE_SIGPIPE(SendGetDebugStringReply(
+                         client->fd, eviction_policy_.DebugString() +
+                                         WatermarkDebugString() +
+                                         CompressionDebugString() + DedupDebugString() +
+                                         NumaDebugString() + HeapDebugString() +
+                                         remote_lookups_.DebugString() +
+                                         RemoteAllocationDebugString() +
+                                         SchedulingDebugString() +
+                                         NotificationDebugString() +
+                                         RegionDebugString() + ListDebugString()),
                      client->fd);
     } break;
     default:
@@ -1226,11 +3506,18 @@ class PlasmaStoreRunner {
 
   void Start(char* socket_name, std::string directory, bool hugepages_enabled,
              std::shared_ptr<ExternalStore> external_store,
-             const std::string& local_address, const std::string& remote_address) {
+             const CompressionTierOptions& compression, bool deduplicate,
+             bool recover, int64_t lookup_window_ms, bool remote_allocation,
+             const EvictionWatermarks& watermarks, const SchedulingOptions& scheduling,
+             const std::string& trace_path, const std::string& local_address,
+             const std::string& remote_address) {
     // Create the event loop.
     loop_.reset(new EventLoop);
     store_.reset(new PlasmaStore(loop_.get(), directory, hugepages_enabled, socket_name,
-                                 external_store, local_address, remote_address));
+                                 external_store, compression, deduplicate, recover,
+                                 lookup_window_ms, remote_allocation, watermarks,
+                                 scheduling, trace_path, local_address,
+                                 remote_address));
     plasma_config = store_->GetPlasmaStoreInfo();
 
     int socket = BindIpcSock(socket_name, true);
@@ -1269,7 +3556,11 @@ void HandleSignal(int signal) {
 
 void StartServer(char* socket_name, std::string plasma_directory, bool hugepages_enabled,
                  std::shared_ptr<ExternalStore> external_store,
-                 const std::string& local_address, const std::string& remote_address) {
+                 const CompressionTierOptions& compression, bool deduplicate,
+                 bool recover, int64_t lookup_window_ms, bool remote_allocation,
+                 const EvictionWatermarks& watermarks, const SchedulingOptions& scheduling,
+                 const std::string& trace_path, const std::string& local_address,
+                 const std::string& remote_address) {
   // Ignore SIGPIPE signals. If we don't do this, then when we attempt to write
   // to a client that has already died, the store could die.
   signal(SIGPIPE, SIG_IGN);
@@ -1277,7 +3568,8 @@ void StartServer(char* socket_name, std::string plasma_directory, bool hugepages
   g_runner.reset(new PlasmaStoreRunner());
   signal(SIGTERM, HandleSignal);
   g_runner->Start(socket_name, plasma_directory, hugepages_enabled, external_store,
-                  local_address, remote_address);
+                  compression, deduplicate, recover, lookup_window_ms, remote_allocation,
+                  watermarks, scheduling, trace_path, local_address, remote_address);
 }
 
 // Function to use (instead of ARROW_LOG(FATAL)) for usage, etc. errors before
@@ -1306,8 +3598,45 @@ DEFINE_string(s, "",
               "socket name where the Plasma store will listen for requests, required");
 DEFINE_string(m, "", "amount of memory in bytes to use for Plasma store, required");
 DEFINE_string(v, "", "local shared memory location, required");
+DEFINE_string(g, "",
+              "amount of memory in bytes the -v region may grow to while the store "
+              "runs, at least the one of -m; the file must be extendable (e.g. on "
+              "tmpfs), optional");
 DEFINE_string(l, "", "gRPC; local listening address (ip:port), required");
 DEFINE_string(r, "", "gRPC; address of remote plasma store (ip:port), required");
+DEFINE_string(z, "",
+              "codec (e.g. lz4, zstd) to compress cold objects with instead of "
+              "evicting them, optional");
+DEFINE_double(c, 0.5,
+              "fraction of the memory that objects compressed with -z may take up");
+DEFINE_bool(u, false, "whether sealed objects with the same contents share their memory");
+DEFINE_bool(p, false,
+            "whether to keep serving the objects a previous store left in the -v "
+            "region, e.g. after it crashed");
+DEFINE_string(n, "",
+              "comma-separated NUMA nodes (e.g. 0,1) to split the -v region "
+              "between, so that clients create objects on their own node, optional");
+DEFINE_int32(w, 0,
+             "milliseconds to gather lookups of objects in the remote store for, "
+             "to send them in one RPC; -1 sends each lookup on its own");
+DEFINE_bool(a, false,
+            "whether to create objects in the region of the remote store when they "
+            "do not fit in the local one, for clients that mapped it");
+DEFINE_double(H, 0,
+              "fraction of the memory in use above which objects are evicted in the "
+              "background, optional");
+DEFINE_double(L, 0.8,
+              "fraction of the memory in use that background eviction with -H "
+              "evicts down to");
+DEFINE_bool(q, false,
+            "whether to schedule the requests of the clients by the weights they "
+            "set, instead of in the order they arrive");
+DEFINE_int64(b, 0,
+             "bytes per second at which large objects may be created in the region "
+             "of the remote store with -a; implies -q, optional");
+DEFINE_string(t, "",
+              "file to record the requests of the clients to, for bench_replay, "
+              "optional");
 
 int main(int argc, char* argv[]) {
   ArrowLog::StartArrowLog(argv[0], ArrowLogLevel::ARROW_INFO);
@@ -1348,13 +3677,19 @@ int main(int argc, char* argv[]) {
                     << static_cast<double>(system_memory) / 1000000000 << "GB of memory.";
   }
 
-  // Initialize shared memory at specified location.
-  mem_location = FLAGS_v;
-  ARROW_LOG(INFO) << "Initializing shared memory at location " << mem_location;
-  int fd = open(mem_location.c_str(), O_RDWR | O_SYNC);
-  void* base_pointer = mmap(0, plasma::PlasmaAllocator::GetFootprintLimit(), 
-                            PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
-  plasma::PlasmaAllocator::Init(fd, base_pointer);
+  if (!FLAGS_g.empty()) {
+    int64_t max_memory;
+    char extra;
+    int scanned = sscanf(FLAGS_g.c_str(), "%" SCNd64 "%c", &max_memory, &extra);
+    if (scanned != 1 || max_memory < system_memory) {
+      plasma::ExitWithUsageError(
+          "-g switch takes memory in bytes, at least the one of -m, with no letter "
+          "suffix allowed");
+    }
+    plasma::PlasmaAllocator::SetMaxFootprintLimit(static_cast<size_t>(max_memory));
+    ARROW_LOG(INFO) << "Allowing the region to grow to "
+                    << static_cast<double>(max_memory) / 1000000000 << "GB of memory.";
+  }
 
   // Sanity check command line options.
   if (socket_name == nullptr && system_memory == -1) {
@@ -1374,6 +3709,39 @@ int main(int argc, char* argv[]) {
         "if you want to use hugepages, please specify path to huge pages "
         "filesystem with -d");
   }
+
+  // Initialize shared memory at specified location.
+  mem_location = FLAGS_v;
+  ARROW_LOG(INFO) << "Initializing shared memory at location " << mem_location;
+  int fd = open(mem_location.c_str(), O_RDWR | O_SYNC);
+  // The region is mapped at the size it may grow to, so that it never moves.
+  void* base_pointer = mmap(0, plasma::PlasmaAllocator::GetMaxFootprintLimit(),
+                            PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ARROW_CHECK(base_pointer != MAP_FAILED)
+      << "failed to map shared memory at " << mem_location;
+  // The start of the region holds the directory of the objects in it and the
+  // leases on them.
+  int64_t header_capacity = plasma::ObjectDirectory::CapacityForRegion(
+      plasma::PlasmaAllocator::GetMaxFootprintLimit());
+  int64_t header_size = plasma::ObjectDirectory::RequiredSize(header_capacity) +
+                        plasma::LeaseTable::RequiredSize(header_capacity);
+  plasma::PlasmaAllocator::Init(fd, base_pointer, header_size);
+  if (!FLAGS_n.empty()) {
+    std::vector<int> numa_nodes;
+    std::stringstream nodes(FLAGS_n);
+    std::string node;
+    while (std::getline(nodes, node, ',')) {
+      char* end;
+      long value = strtol(node.c_str(), &end, 10);
+      if (node.empty() || *end != '\0' || value < 0 || value >= 64) {
+        std::ostringstream error_msg;
+        error_msg << "invalid NUMA node \"" << node << "\" in -n";
+        plasma::ExitWithUsageError(error_msg.str().c_str());
+      }
+      numa_nodes.push_back(static_cast<int>(value));
+    }
+    plasma::PlasmaAllocator::SetNumaNodes(numa_nodes);
+  }
   ARROW_CHECK(!plasma_directory.empty());
   ARROW_LOG(INFO) << "Starting object store with directory " << plasma_directory
                   << " and huge page support "
@@ -1423,12 +3791,58 @@ int main(int argc, char* argv[]) {
     ARROW_CHECK_OK(external_store->Connect(external_store_endpoint));
   }
 
+  // Get the codec of the compression tier
+  plasma::CompressionTierOptions compression;
+  if (!FLAGS_z.empty()) {
+    auto type = arrow::util::Codec::GetCompressionType(FLAGS_z);
+    if (!type.ok() || !arrow::util::Codec::IsAvailable(*type)) {
+      std::ostringstream error_msg;
+      error_msg << "compression codec \"" << FLAGS_z << "\" is not available";
+      plasma::ExitWithUsageError(error_msg.str().c_str());
+    }
+    if (FLAGS_c <= 0 || FLAGS_c >= 1) {
+      plasma::ExitWithUsageError("-c switch takes a fraction between 0 and 1");
+    }
+    ARROW_CHECK_OK(arrow::util::Codec::Create(*type).Value(&compression.codec));
+    compression.capacity = static_cast<int64_t>(FLAGS_c * system_memory);
+    ARROW_LOG(INFO) << "Compressing cold objects with " << FLAGS_z << " into up to "
+                    << compression.capacity << " bytes";
+  }
+
   std::string local_address = FLAGS_l;
   std::string remote_address = FLAGS_r;
+  if (FLAGS_w < -1) {
+    plasma::ExitWithUsageError("-w switch takes a number of milliseconds, or -1");
+  }
+  plasma::EvictionWatermarks watermarks;
+  if (FLAGS_H != 0) {
+    if (!(FLAGS_H > 0 && FLAGS_H <= 1 && FLAGS_L >= 0 && FLAGS_L < FLAGS_H)) {
+      plasma::ExitWithUsageError(
+          "-H switch takes a fraction of the memory above the one of -L, at most 1");
+    }
+    watermarks.high = FLAGS_H;
+    watermarks.low = FLAGS_L;
+    ARROW_LOG(INFO) << "Evicting objects in the background from " << FLAGS_H * 100
+                    << "% of the memory in use down to " << FLAGS_L * 100 << "%";
+  }
+
+  plasma::SchedulingOptions scheduling;
+  if (FLAGS_b < 0) {
+    plasma::ExitWithUsageError("-b switch takes a number of bytes per second");
+  }
+  if (FLAGS_b > 0 && !FLAGS_a) {
+    plasma::ExitWithUsageError("-b switch limits creates in the remote region, with -a");
+  }
+  scheduling.fair_queuing = FLAGS_q || FLAGS_b > 0;
+  scheduling.remote_bytes_per_second = FLAGS_b;
+  if (scheduling.fair_queuing) {
+    ARROW_LOG(INFO) << "Scheduling the requests of the clients by their weights";
+  }
 
   ARROW_LOG(DEBUG) << "starting server listening on " << socket_name;
   plasma::StartServer(socket_name, plasma_directory, hugepages_enabled, external_store,
-                      local_address, remote_address);
+                      compression, FLAGS_u, FLAGS_p, FLAGS_w, FLAGS_a, watermarks,
+                      scheduling, FLAGS_t, local_address, remote_address);
   plasma::g_runner->Shutdown();
   plasma::g_runner = nullptr;
 
@@ -17,7 +17,9 @@
 
 #pragma once
 
+#include <chrono>
 #include <deque>
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -28,13 +30,21 @@
 #include "plasma/common.h"
 #include "plasma/events.h"
 #include "plasma/external_store.h"
+#include "plasma/fair_queue.h"
+#include "plasma/lease_table.h"
+#include "plasma/notification_ring.h"
+#include "plasma/object_directory.h"
 #include "plasma/plasma.h"
 #include "plasma/protocol.h"
 #include "plasma/quota_aware_policy.h"
 #include "plasma/rpc/rpc.h"
+#include "plasma/trace.h"
 
 namespace arrow {
 class Status;
+namespace util {
+class Codec;
+}  // namespace util
 }  // namespace arrow
 
 namespace plasma {
@@ -42,6 +52,7 @@ namespace plasma {
 class RpcClient;
 
 namespace flatbuf {
+struct ObjectInfo;
 struct ObjectInfoT;
 enum class PlasmaError;
 }  // namespace flatbuf
@@ -49,15 +60,69 @@ enum class PlasmaError;
 using flatbuf::ObjectInfoT;
 using flatbuf::PlasmaError;
 
+struct CreateAndSealRequest;
+struct CreateRequest;
 struct GetRequest;
+struct LoopTask;
+struct StreamWaitRequest;
+struct WaitRequest;
+
+/// A notification that is waiting for room in the ring of a subscriber.
+struct RingNotification {
+  ObjectID object_id;
+  /// The sizes of the object, or -1 for a deletion.
+  int64_t data_size;
+  int64_t metadata_size;
+};
 
 struct NotificationQueue {
   /// The object notifications for clients. We notify the client about the
   /// objects in the order that the objects were sealed or deleted.
-  std::deque<std::unique_ptr<uint8_t[]>> object_notifications;
+  std::deque<std::vector<uint8_t>> object_notifications;
+  /// Buffers of notifications that were sent, reused for the next ones.
+  std::vector<std::vector<uint8_t>> free_buffers;
+  /// The ring in shared memory the subscriber reads notifications from, if it
+  /// asked for one instead of the socket. The queue is then keyed by the
+  /// eventfd that wakes the subscriber.
+  std::unique_ptr<NotificationRing> ring;
+  uint8_t* ring_pointer = nullptr;
+  int64_t ring_size = 0;
+  /// Notifications that did not fit into the ring yet, in order.
+  std::deque<RingNotification> ring_overflow;
+};
+
+/// Settings of the tier that keeps cold objects compressed in the region
+/// instead of evicting them.
+struct CompressionTierOptions {
+  /// The codec to compress objects with, or null to evict them as usual.
+  std::shared_ptr<arrow::util::Codec> codec;
+  /// How many bytes of the region compressed objects may take up.
+  int64_t capacity = 0;
+};
+
+/// Fractions of the memory in use between which objects are evicted in the
+/// background, so that creates rarely have to evict.
+struct EvictionWatermarks {
+  /// Background eviction starts when more than this fraction is in use. With
+  /// 0, objects are only evicted when a create does not fit.
+  double high = 0;
+  /// Background eviction stops when this fraction is in use.
+  double low = 0;
+};
+
+/// How the store orders the requests of its clients, so that a client that
+/// creates large objects does not hold up the others.
+struct SchedulingOptions {
+  /// Whether requests wait for their turn in a deficit round robin over the
+  /// clients, by the weights the clients set. Otherwise they are processed as
+  /// they arrive.
+  bool fair_queuing = false;
+  /// The rate at which large objects may be created in the remote region,
+  /// which fair queuing enforces with a token bucket. 0 for no limit.
+  int64_t remote_bytes_per_second = 0;
 };
 
-class PlasmaStore {
+class PlasmaStore : public PeerObjectHandler {
  public:
   using NotificationMap = std::unordered_map<int, NotificationQueue>;
 
@@ -65,7 +130,11 @@ class PlasmaStore {
   PlasmaStore(EventLoop* loop, std::string directory, bool hugepages_enabled,
               const std::string& socket_name,
               std::shared_ptr<ExternalStore> external_store,
-              const std::string& local_address, const std::string& remote_address);
+              const CompressionTierOptions& compression, bool deduplicate,
+              bool recover, int64_t lookup_window_ms, bool remote_allocation,
+              const EvictionWatermarks& watermarks, const SchedulingOptions& scheduling,
+              const std::string& trace_path, const std::string& local_address,
+              const std::string& remote_address);
 
   ~PlasmaStore();
 
@@ -73,7 +142,9 @@ class PlasmaStore {
   const PlasmaStoreInfo* GetPlasmaStoreInfo();
 
   /// Create a new object. The client must do a call to release_object to tell
-  /// the store when it is done with the object.
+  /// the store when it is done with the object. Only this store is checked for
+  /// an object with the same ID; requests of clients ask the remote store
+  /// first, through LookupBeforeCreate.
   ///
   /// \param object_id Object ID of the object to be created.
   /// \param evict_if_full If this is true, then when the object store is full,
@@ -101,6 +172,61 @@ class PlasmaStore {
                            int64_t data_size, int64_t metadata_size, int device_num,
                            Client* client, PlasmaObject* result);
 
+  /// Create a stream object. A stream is an object that readers can get and map
+  /// before it is sealed. Its writer publishes how much of it they may read,
+  /// and readers wait for it to grow with ProcessWaitStreamRequest.
+  ///
+  /// \param object_id Object ID of the stream to be created.
+  /// \param evict_if_full See CreateObject.
+  /// \param capacity The number of data bytes reserved for the stream.
+  /// \param metadata_size Size in bytes of the stream metadata.
+  /// \param client The client that writes the stream.
+  /// \param result The object that has been created.
+  /// \return The error codes of CreateObject.
+  PlasmaError CreateStream(const ObjectID& object_id, bool evict_if_full,
+                           int64_t capacity, int64_t metadata_size, Client* client,
+                           PlasmaObject* result);
+
+  /// Create a sealed object whose data is a range of the data of a sealed
+  /// object, in the same memory. The parent counts as used until the view is
+  /// deleted or evicted.
+  ///
+  /// \param parent_id Object ID of the parent.
+  /// \param offset Where the view starts in the data of the parent.
+  /// \param length The number of bytes in the view.
+  /// \param object_id Object ID of the view.
+  /// \param client The client that created the view.
+  /// \return One of the following error codes:
+  ///  - PlasmaError::OK, if the view was created.
+  ///  - PlasmaError::ObjectExists, if an object with the ID of the view is
+  ///    already present in the store.
+  ///  - PlasmaError::ObjectNotFound, if the parent is not in the local store.
+  ///  - PlasmaError::ObjectNotSealed, if the parent is not sealed yet.
+  ///  - PlasmaError::InvalidView, if the range is not within the data of the
+  ///    parent, or the parent is not in host memory.
+  PlasmaError CreateView(const ObjectID& parent_id, int64_t offset, int64_t length,
+                         const ObjectID& object_id, Client* client);
+
+  /// Let the readers of a stream read its first stream_size bytes. Publishing
+  /// less than has already been published does nothing.
+  ///
+  /// \param object_id Object ID of the stream.
+  /// \param stream_size The number of data bytes that are ready.
+  /// \param client The client making this request, which must be the writer.
+  void PublishStream(const ObjectID& object_id, int64_t stream_size, Client* client);
+
+  /// Process a request to wait until more than stream_size bytes of an object
+  /// are published or until it is sealed. For an object that is not a stream,
+  /// this waits for it to be sealed. The reply is sent right away if the object
+  /// does not exist.
+  ///
+  /// \param client The client making this request.
+  /// \param object_id Object ID of the stream.
+  /// \param stream_size The number of bytes the client has seen already.
+  /// \param timeout_ms The timeout for the request in milliseconds.
+  void ProcessWaitStreamRequest(Client* client, const ObjectID& object_id,
+                                int64_t stream_size, int64_t timeout_ms);
+
   /// Abort a created but unsealed object. If the client is not the
   /// creator, then the abort will fail.
   ///
@@ -124,6 +250,24 @@ class PlasmaStore {
   /// \param object_ids Object IDs of the objects to be evicted.
   void EvictObjects(const std::vector<ObjectID>& object_ids);
 
+  /// Process a request to list one page of the objects that match a filter.
+  /// Each page looks at a bounded number of objects, so that listing a large
+  /// table does not keep the other clients waiting.
+  ///
+  /// \param client The client making this request.
+  /// \param filter Which objects to list.
+  /// \param page_size The most objects to send, or 0 to send all of them.
+  /// \param cursor 0 to start the listing, or the cursor of the last page.
+  void ProcessListRequest(Client* client, const ObjectListFilter& filter,
+                          int64_t page_size, uint64_t cursor);
+
+  /// The pages listed, for the debug string.
+  std::string ListDebugString() const;
+
+  /// The index of the name of a client in owner_names_, which is added if it
+  /// is not there yet. -1 for no client.
+  int32_t OwnerIndex(const Client* client);
+
   /// Process a get request from a client. This method assumes that we will
   /// eventually have these objects sealed. If one of the objects has not yet
   /// been sealed, the client that requested the object will be notified when it
@@ -135,8 +279,24 @@ class PlasmaStore {
   /// \param client The client making this request.
   /// \param object_ids Object IDs of the objects to be gotten.
   /// \param timeout_ms The timeout for the get request in milliseconds.
+  /// \param request_id The client's ID for this request, sent back in the reply.
   void ProcessGetRequest(Client* client, const std::vector<ObjectID>& object_ids,
-                         int64_t timeout_ms);
+                         int64_t timeout_ms, uint64_t request_id);
+
+  /// Process a request to wait until num_ready_objects of a list of objects are
+  /// sealed, in this store or in the remote one, or until the timeout. Objects
+  /// in the local store are ready as soon as they are sealed. The remote store
+  /// is asked about the others without blocking the loop, first together with
+  /// the other lookups and then by PollRemoteObjects while any client waits.
+  /// The reply lists the ready objects, which are not referenced for the
+  /// client.
+  ///
+  /// \param client The client making this request.
+  /// \param object_ids Object IDs of the objects to wait for.
+  /// \param num_ready_objects The number of objects that must be ready.
+  /// \param timeout_ms The timeout for the request in milliseconds.
+  void ProcessWaitRequest(Client* client, const std::vector<ObjectID>& object_ids,
+                          int64_t num_ready_objects, int64_t timeout_ms);
 
   /// Seal a vector of objects. The objects are now immutable and can be accessed with
   /// get.
@@ -147,23 +307,19 @@ class PlasmaStore {
   void SealObjects(const std::vector<ObjectID>& object_ids,
                    const std::vector<std::string>& digests);
 
-  /// Check if the plasma store contains an object:
-  ///
-  /// \param object_id Object ID that will be checked.
-  /// \return OBJECT_FOUND if the object is in the store, OBJECT_NOT_FOUND if
-  /// not
-  ObjectStatus ContainsObject(const ObjectID& object_id);
-
   /// Record the fact that a particular client is no longer using an object.
   ///
   /// \param object_id The object ID of the object that is being released.
   /// \param client The client making this request.
   void ReleaseObject(const ObjectID& object_id, Client* client);
 
-  /// Subscribe a file descriptor to updates about new sealed objects.
+  /// Subscribe a file descriptor, or a ring in shared memory, to updates about
+  /// new sealed objects.
   ///
   /// \param client The client making this request.
-  void SubscribeToUpdates(Client* client);
+  /// \param notification_ring Whether the client sends a ring and an eventfd
+  /// instead of a socket.
+  void SubscribeToUpdates(Client* client, bool notification_ring);
 
   /// Connect a new client to the PlasmaStore.
   ///
@@ -179,13 +335,72 @@ class PlasmaStore {
 
   arrow::Status ProcessMessage(Client* client);
 
+  /// Process the request of type in input_buffer_.
+  arrow::Status ProcessRequest(Client* client, MessageType type);
+
+  /// Read a request of client and queue it until its turn, with fair
+  /// queuing. The client is not read from again until then.
+  arrow::Status QueueMessage(Client* client);
+
+  /// Process the queued requests whose turn has come, in a round of deficit
+  /// round robin, and more rounds until one request was processed.
+  ///
+  /// \return The time until the next round.
+  int DispatchRequests();
+
+  /// Make sure DispatchRequests runs on the next iteration of the loop.
+  void ScheduleDispatch();
+
+  /// Add the tokens of the time since the last refill to the bucket of
+  /// creates in the remote region.
+  void RefillRemoteTokens();
+
+  /// Queued requests and token bucket, for the debug string.
+  std::string SchedulingDebugString() const;
+
+  /// Write notifications into the ring of a subscriber after the ones that
+  /// did not fit before, and wake the subscriber if it had read all of them.
+  /// Notifications that do not fit are kept for RetryRingNotifications.
+  void PushToRing(int wakeup_fd, NotificationQueue* queue,
+                  const ObjectInfoT* object_info, size_t num_objects);
+
+  /// Move notifications that did not fit into the rings of subscribers that
+  /// read some since, and return when to try again.
+  int RetryRingNotifications();
+
+  /// Make sure RetryRingNotifications runs soon.
+  void ScheduleRingRetry();
+
+  /// Subscribers on rings and their wakeups, for the debug string.
+  std::string NotificationDebugString() const;
+
+  /// Create an object for the remote store, which its client writes through
+  /// its mapping of this region. Like the other requests of the remote store,
+  /// this runs on the event loop and gives up if the loop is busy for longer
+  /// than kPeerRequestTimeoutMs. The object is not evicted until it is sealed.
+  void AllocateForPeer(const ObjectID& object_id, int64_t data_size,
+                       int64_t metadata_size, plasmaRPC::ObjectDetails* details) override;
+
+  /// Seal an object that AllocateForPeer created, with an empty digest.
+  bool SealForPeer(const ObjectID& object_id) override;
+
+  /// Free an object that AllocateForPeer created and that was not sealed.
+  bool AbortForPeer(const ObjectID& object_id) override;
+
  private:
   void PushNotification(ObjectInfoT* object_notification);
 
   void PushNotifications(std::vector<ObjectInfoT>& object_notifications);
 
+  void PushNotifications(const ObjectInfoT* object_notifications, size_t num_objects);
+
   void PushNotification(ObjectInfoT* object_notification, int client_fd);
 
+  /// Build a notification about the objects in notification_builder_, which is
+  /// reused by every notification, and return the builder.
+  flatbuffers::FlatBufferBuilder& BuildNotification(const ObjectInfoT* object_info,
+                                                    size_t num_objects);
+
   void AddToClientObjectIds(const ObjectID& object_id, ObjectTableEntry* entry,
                             Client* client);
 
@@ -193,7 +408,84 @@ class PlasmaStore {
                                       uint8_t* pointer, int fd, int64_t map_size, ptrdiff_t offset, 
                                       int device_num, PlasmaObject* result);
 
-  bool ObjectExists(const ObjectID& object_id);
+  /// Ask the remote store whether one of object_ids exists there and call
+  /// create with the answer, without blocking the event loop. If one of them
+  /// is here, the create fails on it anyway and is called right away.
+  void LookupBeforeCreate(Client* client, const std::vector<ObjectID>& object_ids,
+                          std::function<void(bool exists_remotely)> create);
+
+  /// Create the object of a create or create stream request and reply to the
+  /// client.
+  void FinishCreateRequest(Client* client, const CreateRequest& request,
+                           bool exists_remotely);
+
+  /// Create, fill and seal the objects of a create and seal request, or of a
+  /// batch of them, and reply to the client.
+  void FinishCreateAndSealRequest(Client* client, const CreateAndSealRequest& request,
+                                  bool exists_remotely);
+
+  /// Create an object in the region of the remote store for a client that
+  /// mapped it. The remote store keeps the object; this one only remembers
+  /// which client created it, to seal or abort it there.
+  ///
+  /// \return The error codes of CreateObject.
+  PlasmaError CreateRemoteObject(const ObjectID& object_id, int64_t data_size,
+                                 int64_t metadata_size, Client* client,
+                                 PlasmaObject* result);
+
+  /// Seal an object that CreateRemoteObject created and hand it to the get
+  /// requests waiting for it.
+  ///
+  /// \return False if the remote store no longer has the object.
+  bool SealRemoteObject(const ObjectID& object_id);
+
+  /// Run task on the event loop, from another thread, and wait for it.
+  ///
+  /// \return False if the loop did not get to the task within timeout_ms, in
+  ///         which case it never runs.
+  bool RunOnLoop(const std::function<void()>& task, int64_t timeout_ms);
+
+  /// Run the tasks RunOnLoop queued.
+  void RunLoopTasks();
+
+  /// Statistics of objects created in the other store's region, for the debug
+  /// string.
+  std::string RemoteAllocationDebugString() const;
+
+  /// Evict objects nobody uses until the low watermark, if more memory than
+  /// the high watermark is in use.
+  ///
+  /// \return The time until the next check.
+  int EvictToLowWatermark();
+
+  /// The watermarks and what was evicted for them, for the debug string.
+  std::string WatermarkDebugString() const;
+
+  /// Grow the region to a new size while the store keeps running. The file of
+  /// the region is extended if it is smaller, and the new memory becomes free
+  /// memory of the allocator and capacity of the eviction policy.
+  ///
+  /// \param memory_capacity The new size of the region in bytes. A size the
+  ///        region already has is not an error.
+  /// \return PlasmaError::OutOfMemory if the size is beyond the one the region
+  ///         was mapped at, or if the file could not be extended.
+  PlasmaError GrowRegion(int64_t memory_capacity);
+
+  /// The size of the region and how often it grew, for the debug string.
+  std::string RegionDebugString() const;
+
+  /// Write the buffered records of the trace to its file.
+  ///
+  /// \return The time until the next flush.
+  int FlushTrace();
+
+  /// Reply to a ContainsRequest, after asking the remote store if the object
+  /// is not here.
+  void ProcessContainsRequest(Client* client, const ObjectID& object_id);
+
+  /// Take a GetRequest from the pool, or make one if the pool is empty.
+  GetRequest* NewGetRequest(Client* client, const std::vector<ObjectID>& object_ids,
+                            uint64_t request_id);
 
   /// Remove a GetRequest and clean up the relevant data structures.
   ///
@@ -207,11 +499,132 @@ class PlasmaStore {
 
   void ReturnFromGet(GetRequest* get_req);
 
+  /// Return from a GetRequest whose objects were all looked up, if it is
+  /// satisfied or does not wait, or set its timer.
+  void FinishGetRequest(GetRequest* get_req, int64_t timeout_ms);
+
   void UpdateObjectGetRequests(const ObjectID& object_id);
 
+  /// Seal a stream where its writer left off, e.g. when the writer went away.
+  void CloseStream(const ObjectID& object_id);
+
+  /// Reply to a StreamWaitRequest and remove it.
+  void ReturnFromWaitStream(StreamWaitRequest* wait_request);
+
+  /// Reply to the StreamWaitRequests of an object that are satisfied, because
+  /// the object grew, was sealed or went away.
+  void UpdateStreamWaitRequests(const ObjectID& object_id);
+
+  void RemoveStreamWaitRequestsForClient(Client* client);
+
+  /// Reply to a WaitRequest and remove it.
+  void ReturnFromWait(WaitRequest* wait_request);
+
+  /// Record that an object is sealed for the WaitRequests that wait for it.
+  void UpdateObjectWaitRequests(const ObjectID& object_id);
+
+  void RemoveWaitRequestsForClient(Client* client);
+
+  /// Ask the remote store about the objects WaitRequests wait for that are not
+  /// in this store, unless the last poll is still waiting for its answer.
+  ///
+  /// \return The time until the next poll, or kEventLoopTimerDone when no
+  ///         requests are left.
+  int PollRemoteObjects();
+
   int RemoveFromClientObjectIds(const ObjectID& object_id, ObjectTableEntry* entry,
                                 Client* client);
 
+  /// Drop a reference to an object, held by a client or by a view of it.
+  void DropReference(const ObjectID& object_id, ObjectTableEntry* entry);
+
+  /// Make a sealed object visible in the object directory of the region.
+  void PublishToDirectory(const ObjectID& object_id, const ObjectTableEntry* entry);
+
+  /// Add the objects a previous store left in the directory to the object
+  /// table, and mark their memory as allocated. Objects whose location does
+  /// not make sense in this region are dropped from the directory.
+  void RecoverObjects(const std::vector<ObjectDirectory::RecoveredObject>& objects);
+
+  /// Grant a client a lease on a sealed object it just got a reference to.
+  ///
+  /// \return The lease, or kNoLease if the client already has one or the
+  ///         lease table is full.
+  int64_t GrantLease(const ObjectID& object_id, Client* client);
+
+  /// Give up the lease of a client on an object, if it has one.
+  void DropLease(const ObjectID& object_id, Client* client);
+
+  /// Take back the idle leases on an object, along with the references of
+  /// their clients.
+  ///
+  /// \return The number of leases taken back.
+  int64_t RevokeIdleLeases(const ObjectID& object_id);
+
+  /// Take back all idle leases, so that the eviction policy can evict the
+  /// objects that nobody uses anymore.
+  ///
+  /// \return The number of leases taken back.
+  int64_t RevokeAllIdleLeases();
+
+  /// Compress the objects the eviction policy chose to evict, if the
+  /// compression tier is enabled, and take them out of object_ids.
+  void CompressObjects(std::vector<ObjectID>* object_ids);
+
+  /// Replace a sealed object by a compressed copy in the region.
+  ///
+  /// \return False if the object should be evicted as usual.
+  bool CompressObject(const ObjectID& object_id, ObjectTableEntry* entry);
+
+  /// Bring a compressed object back into its original form, so that a client
+  /// can get it. On failure the object stays compressed.
+  ///
+  /// \return OutOfMemory if there is no memory to decompress it into, or the
+  ///         error of the codec.
+  arrow::Status DecompressObject(const ObjectID& object_id, ObjectTableEntry* entry,
+                                 Client* client);
+
+  /// Decompress the compressed copy of an object into out, which has room for
+  /// the object.
+  arrow::Status DecompressInto(const ObjectTableEntry* entry, uint8_t* out);
+
+  /// Write a compressed object to the external store in its original form.
+  arrow::Status PutCompressedObject(const ObjectID& object_id,
+                                    const ObjectTableEntry* entry);
+
+  /// Free at least num_bytes of compressed objects, coldest first. They move to
+  /// the external store if there is one and are deleted otherwise, or if they
+  /// cannot be written to it.
+  ///
+  /// \return The number of bytes freed.
+  int64_t DropCompressedObjects(int64_t num_bytes);
+
+  /// Statistics of the compression tier, for the debug string.
+  std::string CompressionDebugString();
+
+  /// Let a sealed object that no client uses share the memory of an earlier
+  /// object with the same bytes, and free its own. The first object with a
+  /// digest becomes the one later objects are compared against.
+  void DeduplicateObject(const ObjectID& object_id, ObjectTableEntry* entry);
+
+  /// Forget about an object whose memory is about to be freed or moved.
+  ///
+  /// \return True if other objects still share the memory, which must then
+  ///         not be freed.
+  bool DetachFromSharedMemory(const ObjectID& object_id, const ObjectTableEntry* entry);
+
+  /// Statistics of deduplication, for the debug string.
+  std::string DedupDebugString() const;
+
+  /// Memory use per NUMA node, for the debug string.
+  std::string NumaDebugString() const;
+
+  /// Heap allocations of the store process, for the debug string.
+  std::string HeapDebugString() const;
+
+  /// Copy a notification into the queue of a subscriber.
+  void QueueNotification(NotificationQueue* queue, const uint8_t* data, size_t size);
+
   void EraseFromObjectTable(const ObjectID& object_id);
 
   uint8_t* AllocateMemory(size_t size, bool evict_if_full, int* fd, int64_t* map_size,
@@ -231,10 +644,38 @@ class PlasmaStore {
   PlasmaStoreInfo store_info_;
 
   RpcClient rpc_client_;
+  /// Gathers the lookups of objects in the remote store into fewer RPCs.
+  RemoteLookupBatcher remote_lookups_;
+  /// The GetRequests that wait for a remote lookup.
+  std::unordered_set<GetRequest*> remote_lookup_gets_;
 
   std::thread rpc_thread_;
   std::mutex mutex_;
   RpcServiceImpl rpc_service_;
+  /// The tasks of the RPC thread for the event loop, and the eventfd that
+  /// wakes the loop up for them.
+  std::deque<std::shared_ptr<LoopTask>> loop_tasks_;
+  std::mutex loop_tasks_mutex_;
+  int loop_tasks_fd_;
+
+  /// Whether objects that do not fit in the region can be created in the
+  /// region of the remote store.
+  bool remote_allocation_;
+  /// An object created in the remote region, where its creator writes it.
+  struct RemoteCreate {
+    Client* client;
+    PlasmaObject object;
+    bool sealed;
+  };
+  /// The objects created in the remote region whose creator still holds them.
+  std::unordered_map<ObjectID, RemoteCreate> remote_creates_;
+  /// The client that holds the objects created for the remote store until
+  /// they are sealed.
+  Client peer_client_;
+  int64_t num_remote_allocations_;
+  int64_t num_peer_allocations_;
+  /// Requests of the remote store that gave up waiting for the event loop.
+  int64_t num_peer_timeouts_;
   /// The state that is managed by the eviction policy.
   QuotaAwarePolicy eviction_policy_;
   /// Input buffer. This is allocated only once to avoid mallocs for every
@@ -243,6 +684,36 @@ class PlasmaStore {
   /// A hash table mapping object IDs to a vector of the get requests that are
   /// waiting for the object to arrive.
   std::unordered_map<ObjectID, std::vector<GetRequest*>> object_get_requests_;
+  /// Get requests that were answered, reused for later ones so that a get
+  /// does not allocate.
+  std::vector<GetRequest*> get_request_pool_;
+  /// The object IDs of the get request being processed, reused like
+  /// input_buffer_.
+  std::vector<ObjectID> get_object_ids_;
+  /// The object and digest of the seal request being processed, reused like
+  /// input_buffer_.
+  std::vector<ObjectID> seal_object_ids_;
+  std::vector<std::string> seal_digests_;
+  /// The builder of notifications to subscribers on sockets and the offsets of
+  /// their object infos, reused like input_buffer_.
+  flatbuffers::FlatBufferBuilder notification_builder_;
+  std::vector<flatbuffers::Offset<flatbuf::ObjectInfo>> notification_infos_;
+  /// A hash table mapping object IDs to the requests that wait for the object
+  /// to grow or to be sealed.
+  std::unordered_map<ObjectID, std::vector<StreamWaitRequest*>> stream_wait_requests_;
+  /// The writer of each stream that is not sealed yet.
+  std::unordered_map<ObjectID, Client*> stream_writers_;
+  /// The parent of each view. A view holds a reference to its parent.
+  std::unordered_map<ObjectID, ObjectID> view_parents_;
+  /// A hash table mapping object IDs to the wait requests that are waiting for
+  /// the object to be sealed.
+  std::unordered_map<ObjectID, std::vector<WaitRequest*>> object_wait_requests_;
+  /// The timer polling the remote store for object_wait_requests_, or -1.
+  int64_t remote_poll_timer_;
+  /// The time until the next poll, which backs off while nothing turns up.
+  int64_t remote_poll_interval_ms_;
+  /// Whether the lookup of the last poll has not been answered yet.
+  bool remote_poll_in_flight_;
   /// The pending notifications that have not been sent to subscribers because
   /// the socket send buffers were full. This is a hash table from client file
   /// descriptor to an array of object_ids to send to that client.
@@ -254,9 +725,116 @@ class PlasmaStore {
 
   std::unordered_set<ObjectID> deletion_cache_;
 
+  /// The directory of sealed objects in the header of the shared memory
+  /// region, which lets processes that map the region find objects on their own.
+  std::unique_ptr<ObjectDirectory> object_directory_;
+  /// The leases on objects, in the region header after the directory.
+  std::unique_ptr<LeaseTable> lease_table_;
+  /// The leases of each object, by client.
+  std::unordered_map<ObjectID, std::unordered_map<Client*, int64_t>> object_leases_;
+
   /// Manages worker threads for handling asynchronous/multi-threaded requests
   /// for reading/writing data to/from external store.
   std::shared_ptr<ExternalStore> external_store_;
+
+  CompressionTierOptions compression_;
+  /// The compressed objects in LRU order, with their compressed sizes.
+  LRUCache compressed_objects_;
+  /// Scratch space to compress objects into before they are copied back into
+  /// the region.
+  std::vector<uint8_t> compression_buffer_;
+  int64_t num_compressions_;
+  int64_t num_decompressions_;
+  /// Objects that did not compress well enough to be kept compressed.
+  int64_t num_incompressible_;
+  /// Objects that were evicted since there was no memory for their
+  /// compressed copy.
+  int64_t num_compressions_without_room_;
+
+  /// Whether sealed objects with the same bytes share their memory.
+  bool deduplicate_;
+  /// For each digest, the sealed object that later objects with the digest are
+  /// compared against.
+  std::unordered_map<uint64_t, ObjectID> objects_by_digest_;
+  /// Sealed objects to deduplicate once no client uses them anymore.
+  std::unordered_set<ObjectID> dedup_candidates_;
+  /// The objects that share each piece of memory used by more than one
+  /// object, by the offset of the memory.
+  std::unordered_map<ptrdiff_t, std::vector<ObjectID>> shared_memory_;
+  int64_t num_deduplicated_;
+  int64_t dedup_bytes_saved_;
+  /// Objects whose digest matched an earlier object with different bytes.
+  int64_t num_digest_collisions_;
+
+  /// Objects created in the arena of the NUMA node of their client, and
+  /// objects that had to go to another node because that arena was full.
+  int64_t num_node_local_allocations_;
+  int64_t num_node_remote_allocations_;
+
+  EvictionWatermarks watermarks_;
+  /// The timer that evicts down to the low watermark, or -1.
+  int64_t watermark_timer_;
+  int64_t num_background_evictions_;
+  int64_t background_bytes_evicted_;
+  /// Creates that had to evict objects before they fit.
+  int64_t num_inline_evictions_;
+
+  /// Where the requests of the clients are recorded, or nullptr.
+  std::unique_ptr<TraceWriter> trace_;
+
+  /// A request read from a client that waits for its turn.
+  struct QueuedRequest {
+    MessageType type;
+    std::vector<uint8_t> message;
+    int64_t cost = 0;
+    /// Whether it creates a large object that the token bucket has to let
+    /// through.
+    bool large_create = false;
+    bool waited_for_tokens = false;
+  };
+
+  SchedulingOptions scheduling_;
+  /// The request of each client that has one queued. The entries of clients
+  /// whose request was processed are kept for their buffer.
+  std::unordered_map<Client*, QueuedRequest> queued_requests_;
+  /// The clients with a queued request, in the order of the round robin, and
+  /// what each saved up in it.
+  FairQueue fair_queue_;
+  /// The timer that runs DispatchRequests, or -1.
+  int64_t dispatch_timer_;
+  /// Whether the dispatch timer is set for later, because no request is
+  /// queued or the queued ones wait for the token bucket.
+  bool dispatch_sleeps_;
+  /// Bytes that may still be created in the remote region. Creates are let
+  /// through while it is positive and may take it below 0.
+  int64_t remote_tokens_;
+  std::chrono::steady_clock::time_point last_refill_;
+  int64_t num_queued_requests_;
+  /// Creates that waited for the token bucket.
+  int64_t num_waited_for_tokens_;
+  int64_t remote_bytes_admitted_;
+
+  /// The timer that runs RetryRingNotifications, or -1.
+  int64_t ring_retry_timer_;
+  /// Whether the retry timer is set for later, because all notifications
+  /// fit into their rings.
+  bool ring_retry_sleeps_;
+  int64_t num_ring_notifications_;
+  int64_t num_ring_wakeups_;
+
+  /// The number of times the region grew, and by how many bytes in total.
+  int64_t num_region_grows_;
+  int64_t region_bytes_grown_;
+
+  /// The names of the clients that created objects, which ObjectTableEntry
+  /// refers to by index, and the index of each name.
+  std::vector<std::string> owner_names_;
+  std::unordered_map<std::string, int32_t> owner_indices_;
+  /// Pages of listings sent, the objects in them, and the listings that started
+  /// over because the object table was rehashed.
+  int64_t num_list_pages_;
+  int64_t num_listed_objects_;
+  int64_t num_list_restarts_;
 };
 
 }  // namespace plasma
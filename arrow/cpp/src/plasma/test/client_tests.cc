@@ -16,12 +16,16 @@
 // under the License.
 
 #include <assert.h>
+#include <fcntl.h>
+#include <poll.h>
 #include <signal.h>
 #include <stdlib.h>
+#include <sys/mman.h>
 #include <sys/time.h>
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <atomic>
 #include <memory>
 #include <thread>
 
@@ -32,6 +36,7 @@
 
 #include "plasma/client.h"
 #include "plasma/common.h"
+#include "plasma/object_directory.h"
 #include "plasma/plasma.h"
 #include "plasma/protocol.h"
 #include "plasma/test_util.h"
@@ -191,6 +196,81 @@ TEST_F(TestPlasmaStore, BatchNotificationTest) {
   ARROW_CHECK_OK(local_client.Disconnect());
 }
 
+TEST_F(TestPlasmaStore, RingNotificationTest) {
+  PlasmaClient local_client, local_client2;
+
+  ARROW_CHECK_OK(local_client.Connect(store_socket_name_, ""));
+  ARROW_CHECK_OK(local_client2.Connect(store_socket_name_, ""));
+
+  // The ring is smaller than the number of objects, so that some notifications
+  // have to wait in the store for room.
+  int fd = -1;
+  ARROW_CHECK_OK(local_client2.Subscribe(&fd, 2));
+  ASSERT_GT(fd, 0);
+
+  std::vector<ObjectID> object_ids;
+  for (int64_t i = 0; i < 5; i++) {
+    object_ids.push_back(random_object_id());
+    std::shared_ptr<Buffer> data;
+    ARROW_CHECK_OK(local_client.Create(object_ids.back(), i + 1, nullptr, 0, &data));
+    ARROW_CHECK_OK(local_client.Seal(object_ids.back()));
+    ARROW_CHECK_OK(local_client.Release(object_ids.back()));
+  }
+
+  // The eventfd tells that there are notifications to read.
+  struct pollfd pfd = {fd, POLLIN, 0};
+  ASSERT_EQ(poll(&pfd, 1, 1000), 1);
+
+  ObjectID object_id;
+  int64_t data_size = 0;
+  int64_t metadata_size = 0;
+  for (int64_t i = 0; i < 5; i++) {
+    ARROW_CHECK_OK(
+        local_client2.GetNotification(fd, &object_id, &data_size, &metadata_size));
+    ASSERT_EQ(object_id, object_ids[i]);
+    ASSERT_EQ(data_size, i + 1);
+    ASSERT_EQ(metadata_size, 0);
+  }
+  // Once all notifications are read, the eventfd is not readable anymore.
+  ASSERT_EQ(poll(&pfd, 1, 0), 0);
+
+  ARROW_CHECK_OK(local_client.Delete(object_ids[0]));
+  ARROW_CHECK_OK(
+      local_client2.GetNotification(fd, &object_id, &data_size, &metadata_size));
+  ASSERT_EQ(object_id, object_ids[0]);
+  ASSERT_EQ(-1, data_size);
+  ASSERT_EQ(-1, metadata_size);
+
+  ARROW_CHECK_OK(local_client2.Disconnect());
+  ARROW_CHECK_OK(local_client.Disconnect());
+}
+
+TEST_F(TestPlasmaStore, RingNotificationWaitTest) {
+  int fd = -1;
+  ARROW_CHECK_OK(client2_.Subscribe(&fd, 2));
+
+  ObjectID object_id;
+  int64_t data_size = 0;
+  int64_t metadata_size = 0;
+  std::thread reader([&]() {
+    ARROW_CHECK_OK(client2_.GetNotification(fd, &object_id, &data_size, &metadata_size));
+  });
+  // The reader waits for the ring without holding on to the client, which can
+  // subscribe again meanwhile.
+  int fd2 = -1;
+  ARROW_CHECK_OK(client2_.Subscribe(&fd2, 2));
+
+  ObjectID sealed_id = random_object_id();
+  std::shared_ptr<Buffer> data;
+  ARROW_CHECK_OK(client_.Create(sealed_id, 1, nullptr, 0, &data));
+  ARROW_CHECK_OK(client_.Seal(sealed_id));
+  ARROW_CHECK_OK(client_.Release(sealed_id));
+  reader.join();
+  ASSERT_EQ(object_id, sealed_id);
+  ARROW_CHECK_OK(client2_.GetNotification(fd2, &object_id, &data_size, &metadata_size));
+  ASSERT_EQ(object_id, sealed_id);
+}
+
 TEST_F(TestPlasmaStore, SealErrorsTest) {
   ObjectID object_id = random_object_id();
 
@@ -591,6 +671,165 @@ TEST_F(TestPlasmaStore, ContainsTest) {
   ASSERT_TRUE(has_object);
 }
 
+TEST_F(TestPlasmaStore, GetRequestsArePooled) {
+  std::vector<ObjectBuffer> object_buffers;
+  // Every get is answered before the next one arrives, so they all use the
+  // same request.
+  for (int i = 0; i < 3; ++i) {
+    ARROW_CHECK_OK(client_.Get({random_object_id()}, 0, &object_buffers));
+    ASSERT_FALSE(object_buffers[0].data);
+  }
+  ASSERT_TRUE(client_.DebugString().find("(store) pooled get requests: 1") !=
+              std::string::npos);
+}
+
+TEST_F(TestPlasmaStore, RemoteLookupsAreBatched) {
+  std::vector<ObjectBuffer> object_buffers;
+  // All the objects that are not here are looked up in the remote store in
+  // one RPC.
+  ARROW_CHECK_OK(client_.Get({random_object_id(), random_object_id(), random_object_id()},
+                             0, &object_buffers));
+  ASSERT_EQ(object_buffers.size(), 3);
+  for (const auto& object_buffer : object_buffers) {
+    ASSERT_FALSE(object_buffer.data);
+  }
+  std::string debug_string = client_.DebugString();
+  ASSERT_TRUE(debug_string.find("(remote) lookups: 1") != std::string::npos);
+  ASSERT_TRUE(debug_string.find("(remote) lookup rpcs: 1") != std::string::npos);
+}
+
+TEST_F(TestPlasmaStore, CreatesThatEvictAreCounted) {
+  // Without -H, nothing is evicted in the background, so the creates have to
+  // evict to fit three of these in the store's capacity of 10 MB.
+  std::vector<uint8_t> data(4000000, 1);
+  for (int i = 0; i < 3; i++) {
+    CreateObject(client_, random_object_id(), {}, data);
+  }
+  std::string debug_string = client_.DebugString();
+  ASSERT_TRUE(debug_string.find("(watermarks) high: 0\n") != std::string::npos);
+  ASSERT_TRUE(debug_string.find("(watermarks) objects evicted in the background: 0") !=
+              std::string::npos);
+  ASSERT_TRUE(debug_string.find("(watermarks) creates that evicted: 0") ==
+              std::string::npos);
+}
+
+TEST_F(TestPlasmaStore, RemoteAllocationNeedsRemoteMemory) {
+  // The client did not map the remote region, so an object that does not fit
+  // here is not placed there.
+  ObjectID object_id = random_object_id();
+  std::shared_ptr<Buffer> data;
+  Status s = client_.Create(object_id, 20000000, nullptr, 0, &data);
+  ASSERT_TRUE(IsPlasmaStoreFull(s));
+  ASSERT_TRUE(client_.DebugString().find(
+                  "(remote) objects created in the remote region: 0") !=
+              std::string::npos);
+  bool has_object;
+  ARROW_CHECK_OK(client_.Contains(object_id, &has_object));
+  ASSERT_FALSE(has_object);
+}
+
+TEST_F(TestPlasmaStore, WeightWithoutQuota) {
+  // A weight alone sets no quota, so the objects of the client stay in the
+  // store like those of any other client.
+  ARROW_CHECK_OK(client_.SetClientOptions("reader", 0, 4));
+  ObjectID object_id = random_object_id();
+  std::vector<uint8_t> data(1000000, 1);
+  CreateObject(client_, object_id, {}, data);
+  bool has_object;
+  ARROW_CHECK_OK(client_.Contains(object_id, &has_object));
+  ASSERT_TRUE(has_object);
+  ASSERT_TRUE(client_.DebugString().find("(scheduling) fair queuing: off") !=
+              std::string::npos);
+}
+
+TEST_F(TestPlasmaStore, GrowRegionNeedsReservation) {
+  // The store was started without -g, so the region can not grow past -m.
+  const int64_t capacity = client_.store_capacity();
+  ARROW_CHECK_OK(client_.GrowRegion(capacity));
+  Status s = client_.GrowRegion(2 * capacity);
+  ASSERT_TRUE(IsPlasmaStoreFull(s));
+  ASSERT_EQ(client_.store_capacity(), capacity);
+  ASSERT_TRUE(client_.DebugString().find("(region) times grown: 0") !=
+              std::string::npos);
+}
+
+TEST_F(TestPlasmaStore, ListWithCursorTest) {
+  ARROW_CHECK_OK(client_.SetClientOptions("writer", 0, 1));
+  std::vector<ObjectID> small_ids;
+  for (int i = 0; i < 5; i++) {
+    small_ids.push_back(random_object_id());
+    CreateObject(client_, small_ids.back(), {}, std::vector<uint8_t>(100, 1));
+    CreateObject(client2_, random_object_id(), {}, std::vector<uint8_t>(1000, 2));
+  }
+  ObjectID unsealed_id = random_object_id();
+  std::shared_ptr<Buffer> data;
+  ARROW_CHECK_OK(client_.Create(unsealed_id, 10, nullptr, 0, &data));
+
+  auto list_all = [this](const ObjectListFilter& filter, int64_t page_size,
+                         ObjectTable* objects) {
+    uint64_t cursor = 0;
+    int num_pages = 0;
+    do {
+      const size_t num_objects = objects->size();
+      ARROW_CHECK_OK(client_.List(filter, page_size, &cursor, objects));
+      EXPECT_LE(static_cast<int64_t>(objects->size() - num_objects), page_size);
+      num_pages += 1;
+    } while (cursor != 0);
+    return num_pages;
+  };
+
+  ObjectTable objects;
+  ASSERT_GE(list_all(ObjectListFilter(), 2, &objects), 6);
+  ASSERT_EQ(objects.size(), 11);
+
+  ObjectListFilter filter;
+  filter.owner = "writer";
+  filter.state_mask = 1 << static_cast<int>(ObjectState::PLASMA_SEALED);
+  objects.clear();
+  list_all(filter, 100, &objects);
+  ASSERT_EQ(objects.size(), 5);
+  for (const auto& object_id : small_ids) {
+    ASSERT_EQ(objects.count(object_id), 1);
+  }
+
+  filter = ObjectListFilter();
+  filter.min_size = 500;
+  filter.max_age = 3600;
+  objects.clear();
+  list_all(filter, 100, &objects);
+  ASSERT_EQ(objects.size(), 5);
+
+  // A client of that name created nothing, and the remote region was not
+  // mapped, so there is nothing to list.
+  filter = ObjectListFilter();
+  filter.owner = "nobody";
+  filter.include_remote = true;
+  objects.clear();
+  ASSERT_EQ(list_all(filter, 100, &objects), 1);
+  ASSERT_TRUE(objects.empty());
+
+  // The List without a cursor still returns everything.
+  objects.clear();
+  ARROW_CHECK_OK(client_.List(&objects));
+  ASSERT_EQ(objects.size(), 11);
+  ASSERT_EQ(objects[unsealed_id]->state, ObjectState::PLASMA_CREATED);
+  ARROW_CHECK_OK(client_.Seal(unsealed_id));
+  ARROW_CHECK_OK(client_.Release(unsealed_id));
+}
+
+TEST_F(TestPlasmaStore, PrefetchTest) {
+  ObjectID object_id = random_object_id();
+  std::vector<uint8_t> data = {1, 2, 3, 4};
+  CreateObject(client_, object_id, {}, data);
+
+  // Without a remote region there is nothing to prefetch, and neither local
+  // nor missing objects are affected.
+  ARROW_CHECK_OK(client_.Prefetch({object_id, random_object_id()}));
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client_.Get({object_id}, 0, &object_buffers));
+  AssertObjectBufferEqual(object_buffers[0], {}, data);
+}
+
 TEST_F(TestPlasmaStore, GetTest) {
   std::vector<ObjectBuffer> object_buffers;
 
@@ -626,6 +865,47 @@ TEST_F(TestPlasmaStore, GetTest) {
   EXPECT_FALSE(client_.IsInUse(object_id));
 }
 
+TEST_F(TestPlasmaStore, LocalObjectIsNotReadFromRemoteRegion) {
+  // A remote region whose directory lists one object that the local store
+  // also has, with other contents, and one that only the remote region has.
+  const int64_t capacity = 64;
+  const int64_t data_offset = ObjectDirectory::RequiredSize(capacity);
+  const int64_t region_size = data_offset + 4096;
+  std::string region_file = temp_dir_->path().ToString() + "remote";
+  int fd = open(region_file.c_str(), O_RDWR | O_CREAT, 0600);
+  ASSERT_GE(fd, 0);
+  ASSERT_EQ(ftruncate(fd, region_size), 0);
+  void* pointer = mmap(nullptr, region_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  ASSERT_NE(pointer, MAP_FAILED);
+  uint8_t* region = static_cast<uint8_t*>(pointer);
+  auto directory = ObjectDirectory::Create(region, capacity);
+  ASSERT_TRUE(directory);
+  region[data_offset] = 7;
+  region[data_offset + 1] = 8;
+
+  ObjectID local_id = random_object_id();
+  ObjectID remote_id = random_object_id();
+  PlasmaObject object = {};
+  object.data_offset = data_offset;
+  object.metadata_offset = data_offset + 2;
+  object.data_size = 2;
+  ASSERT_TRUE(directory->Publish(local_id, object));
+  ASSERT_TRUE(directory->Publish(remote_id, object));
+  ARROW_CHECK_OK(client_.MmapRemoteMemory(region_file));
+
+  CreateObject(client2_, local_id, {}, {1, 2});
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client_.Get({local_id, remote_id}, 0, &object_buffers));
+  ASSERT_EQ(object_buffers.size(), 2);
+  AssertObjectBufferEqual(object_buffers[0], {}, {1, 2});
+  AssertObjectBufferEqual(object_buffers[1], {}, {7, 8});
+  object_buffers.clear();
+  EXPECT_FALSE(client_.IsInUse(local_id));
+  EXPECT_FALSE(client_.IsInUse(remote_id));
+  munmap(pointer, region_size);
+}
+
 TEST_F(TestPlasmaStore, LegacyGetTest) {
   // Test for old non-releasing Get() variant
   ObjectID object_id = random_object_id();
@@ -675,6 +955,139 @@ TEST_F(TestPlasmaStore, MultipleGetTest) {
   ASSERT_EQ(object_buffers[1].data->data()[0], 2);
 }
 
+TEST_F(TestPlasmaStore, AsyncTest) {
+  ObjectID object_id1 = random_object_id();
+  ObjectID object_id2 = random_object_id();
+  uint8_t metadata[] = {5};
+  int64_t metadata_size = sizeof(metadata);
+
+  // This get waits in the store until object_id1 is sealed, so the create and
+  // the seal below complete before it.
+  auto get1 = client_.GetAsync({object_id1}, -1);
+
+  auto create1 = client_.CreateAsync(object_id1, 4, metadata, metadata_size);
+  auto create2 = client_.CreateAsync(object_id2, 4, metadata, metadata_size);
+  ASSERT_OK_AND_ASSIGN(auto data1, create1.result());
+  ASSERT_OK_AND_ASSIGN(auto data2, create2.result());
+  data1->mutable_data()[0] = 1;
+  data2->mutable_data()[0] = 2;
+  ASSERT_FALSE(get1.is_finished());
+
+  auto seal2 = client_.SealAsync(object_id2);
+  auto seal1 = client_.SealAsync(object_id1);
+  ASSERT_OK(seal2.status());
+  ASSERT_OK(seal1.status());
+
+  ASSERT_OK_AND_ASSIGN(auto object_buffers, get1.result());
+  ASSERT_EQ(object_buffers[0].data->data()[0], 1);
+  AssertBufferEqual(*object_buffers[0].metadata, std::string{5});
+
+  // Objects the client holds are served without a request.
+  auto get2 = client_.GetAsync({object_id1, object_id2}, 0);
+  ASSERT_OK_AND_ASSIGN(auto object_buffers2, get2.result());
+  ASSERT_EQ(object_buffers2[0].data->data()[0], 1);
+  ASSERT_EQ(object_buffers2[1].data->data()[0], 2);
+
+  // Synchronous and asynchronous calls can be mixed.
+  std::vector<ObjectBuffer> object_buffers3;
+  ARROW_CHECK_OK(client_.Get({object_id2}, -1, &object_buffers3));
+  ASSERT_EQ(object_buffers3[0].data->data()[0], 2);
+
+  object_buffers.clear();
+  object_buffers2.clear();
+  object_buffers3.clear();
+  data1.reset();
+  data2.reset();
+  EXPECT_FALSE(client_.IsInUse(object_id1));
+  EXPECT_FALSE(client_.IsInUse(object_id2));
+}
+
+TEST_F(TestPlasmaStore, StreamTest) {
+  ObjectID object_id = random_object_id();
+  uint8_t metadata[] = {7};
+  std::shared_ptr<Buffer> data;
+  ARROW_CHECK_OK(client_.CreateStream(object_id, 8, metadata, sizeof(metadata), &data));
+
+  // Readers can get the stream before it is sealed.
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client2_.Get({object_id}, 0, &object_buffers));
+  ASSERT_EQ(object_buffers[0].data->size(), 8);
+  AssertBufferEqual(*object_buffers[0].metadata, std::string{7});
+  int64_t published;
+  bool closed;
+  ARROW_CHECK_OK(client2_.WaitStream(object_id, 0, 0, &published, &closed));
+  ASSERT_EQ(published, 0);
+  ASSERT_FALSE(closed);
+
+  ARROW_CHECK_OK(client_.Append(object_id, reinterpret_cast<const uint8_t*>("abc"), 3));
+  ARROW_CHECK_OK(client2_.WaitStream(object_id, 0, -1, &published, &closed));
+  ASSERT_EQ(published, 3);
+  ASSERT_FALSE(closed);
+  ASSERT_EQ(std::string(reinterpret_cast<const char*>(object_buffers[0].data->data()), 3),
+            "abc");
+
+  // A waiting reader wakes up when the stream grows.
+  std::thread reader([&]() {
+    ARROW_CHECK_OK(client2_.WaitStream(object_id, 3, -1, &published, &closed));
+  });
+  data->mutable_data()[3] = 'd';
+  ARROW_CHECK_OK(client_.Publish(object_id, 4));
+  reader.join();
+  ASSERT_EQ(published, 4);
+  ASSERT_EQ(object_buffers[0].data->data()[3], 'd');
+
+  ASSERT_RAISES(CapacityError,
+                client_.Append(object_id, reinterpret_cast<const uint8_t*>("efghi"), 5));
+  ASSERT_RAISES(Invalid, client_.Publish(object_id, 2));
+
+  // Once sealed, the stream reads like an object of the size published.
+  ARROW_CHECK_OK(client_.Seal(object_id));
+  ARROW_CHECK_OK(client_.Release(object_id));
+  ARROW_CHECK_OK(client2_.WaitStream(object_id, 4, -1, &published, &closed));
+  ASSERT_EQ(published, 4);
+  ASSERT_TRUE(closed);
+  ASSERT_RAISES(Invalid, client_.Append(object_id, reinterpret_cast<const uint8_t*>("e"), 1));
+  std::vector<ObjectBuffer> sealed_buffers;
+  ARROW_CHECK_OK(client_.Get({object_id}, -1, &sealed_buffers));
+  AssertObjectBufferEqual(sealed_buffers[0], {7}, {'a', 'b', 'c', 'd'});
+
+  // Waiting for an object that does not exist fails right away.
+  ASSERT_TRUE(IsPlasmaObjectNotFound(
+      client_.WaitStream(random_object_id(), 0, -1, &published, &closed)));
+}
+
+TEST_F(TestPlasmaStore, WaitTest) {
+  ObjectID object_id1 = random_object_id();
+  ObjectID object_id2 = random_object_id();
+  ObjectID object_id3 = random_object_id();
+  std::vector<ObjectID> object_ids = {object_id1, object_id2, object_id3};
+  std::vector<ObjectID> ready_ids;
+
+  ASSERT_RAISES(Invalid, client_.Wait(object_ids, 0, 0, &ready_ids));
+  ASSERT_RAISES(Invalid, client_.Wait(object_ids, 4, 0, &ready_ids));
+
+  // Nothing is ready yet, so a poll returns an empty list.
+  ARROW_CHECK_OK(client_.Wait(object_ids, 1, 0, &ready_ids));
+  ASSERT_TRUE(ready_ids.empty());
+
+  CreateObject(client2_, object_id2, {42}, {1, 2, 3});
+  ARROW_CHECK_OK(client_.Wait(object_ids, 1, 0, &ready_ids));
+  ASSERT_EQ(ready_ids, std::vector<ObjectID>{object_id2});
+  // Waiting does not map the object into the caller.
+  ASSERT_FALSE(client_.IsInUse(object_id2));
+
+  // A wait that times out returns whatever is ready.
+  ARROW_CHECK_OK(client_.Wait(object_ids, 2, 50, &ready_ids));
+  ASSERT_EQ(ready_ids, std::vector<ObjectID>{object_id2});
+
+  // A blocked wait returns once enough objects are sealed, in request order.
+  std::thread waiter(
+      [&]() { ARROW_CHECK_OK(client_.Wait(object_ids, 2, -1, &ready_ids)); });
+  CreateObject(client2_, object_id1, {42}, {4, 5, 6});
+  waiter.join();
+  ASSERT_EQ(ready_ids, (std::vector<ObjectID>{object_id1, object_id2}));
+}
+
 TEST_F(TestPlasmaStore, BatchCreateTest) {
   ObjectID object_id1 = random_object_id();
   ObjectID object_id2 = random_object_id();
@@ -699,6 +1112,37 @@ TEST_F(TestPlasmaStore, BatchCreateTest) {
   ASSERT_STREQ(out2.c_str(), "world");
 }
 
+TEST_F(TestPlasmaStore, CreateViewTest) {
+  ObjectID parent_id = random_object_id();
+  ObjectID view_id = random_object_id();
+  ARROW_CHECK_OK(client_.CreateAndSeal(parent_id, "hello world", "meta"));
+
+  ASSERT_RAISES(Invalid, client_.CreateView(parent_id, 6, 6, view_id));
+  ASSERT_RAISES(Invalid, client_.CreateView(parent_id, -1, 2, view_id));
+  ASSERT_TRUE(IsPlasmaObjectNotFound(
+      client_.CreateView(random_object_id(), 0, 1, view_id)));
+
+  ARROW_CHECK_OK(client_.CreateView(parent_id, 6, 5, view_id));
+  ASSERT_TRUE(IsPlasmaObjectExists(client_.CreateView(parent_id, 0, 5, view_id)));
+  {
+    std::vector<ObjectBuffer> object_buffers;
+    ARROW_CHECK_OK(client2_.Get({view_id}, -1, &object_buffers));
+    arrow::AssertBufferEqual(*object_buffers[0].data, "world");
+    ASSERT_EQ(object_buffers[0].metadata->size(), 0);
+  }
+
+  // The view keeps its parent alive.
+  ARROW_CHECK_OK(client_.Delete(parent_id));
+  bool has_object;
+  ARROW_CHECK_OK(client_.Contains(parent_id, &has_object));
+  ASSERT_TRUE(has_object);
+  ARROW_CHECK_OK(client_.Delete(view_id));
+  ARROW_CHECK_OK(client_.Contains(view_id, &has_object));
+  ASSERT_FALSE(has_object);
+  ARROW_CHECK_OK(client_.Contains(parent_id, &has_object));
+  ASSERT_FALSE(has_object);
+}
+
 TEST_F(TestPlasmaStore, AbortTest) {
   ObjectID object_id = random_object_id();
   std::vector<ObjectBuffer> object_buffers;
@@ -811,6 +1255,102 @@ TEST_F(TestPlasmaStore, MultipleClientTest) {
   ASSERT_TRUE(has_object);
 }
 
+TEST_F(TestPlasmaStore, MultiThreadedCreateGetReleaseTest) {
+  constexpr int kNumThreads = 8;
+  constexpr int kObjectsPerThread = 20;
+  PlasmaClient client;
+  ARROW_CHECK_OK(client.Connect(store_socket_name_, "", 0, -1, 4));
+
+  std::vector<std::vector<ObjectID>> object_ids(kNumThreads);
+  for (auto& ids : object_ids) {
+    for (int i = 0; i < kObjectsPerThread; ++i) {
+      ids.push_back(random_object_id());
+    }
+  }
+  // How many of its objects each thread sealed. The others only get those, so
+  // that none of them gets an object the client created and did not seal.
+  std::vector<std::atomic<int>> num_sealed(kNumThreads);
+  for (auto& count : num_sealed) {
+    count = 0;
+  }
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&, t]() {
+      for (int i = 0; i < kObjectsPerThread; ++i) {
+        const ObjectID& object_id = object_ids[t][i];
+        std::shared_ptr<Buffer> data;
+        ARROW_CHECK_OK(client.Create(object_id, 64, nullptr, 0, &data));
+        memset(data->mutable_data(), t, 64);
+        ARROW_CHECK_OK(client.Seal(object_id));
+        ARROW_CHECK_OK(client.Release(object_id));
+        num_sealed[t] += 1;
+        // Get and release what every thread sealed so far, while the others
+        // do the same with the same objects.
+        for (int u = 0; u < kNumThreads; ++u) {
+          const int sealed = num_sealed[u];
+          for (int j = 0; j < sealed; ++j) {
+            ObjectBuffer object_buffer;
+            ARROW_CHECK_OK(client.Get(&object_ids[u][j], 1, -1, &object_buffer));
+            ARROW_CHECK(object_buffer.data->size() == 64);
+            ARROW_CHECK(object_buffer.data->data()[63] == u);
+            ARROW_CHECK_OK(client.Release(object_ids[u][j]));
+          }
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (const auto& ids : object_ids) {
+    for (const auto& object_id : ids) {
+      ASSERT_FALSE(client.IsInUse(object_id));
+    }
+  }
+  ARROW_CHECK_OK(client.Disconnect());
+}
+
+TEST_F(TestPlasmaStore, ReleaseDuringPendingGetTest) {
+  PlasmaClient client;
+  ARROW_CHECK_OK(client.Connect(store_socket_name_, "", 0, -1, 4));
+  ObjectID held_id = random_object_id();
+  ObjectID pending_id = random_object_id();
+  CreateObject(client2_, held_id, {1}, {1, 2, 3});
+
+  // The getter waits in the store for an object that does not exist yet,
+  // while the client gets and releases other objects, and the object itself
+  // once it is there.
+  ObjectBuffer pending_buffer;
+  std::thread getter([&]() {
+    ARROW_CHECK_OK(client.Get(&pending_id, 1, -1, &pending_buffer));
+    for (int i = 0; i < 100; ++i) {
+      ObjectBuffer object_buffer;
+      ARROW_CHECK_OK(client.Get(&pending_id, 1, -1, &object_buffer));
+      ARROW_CHECK_OK(client.Release(pending_id));
+    }
+  });
+  for (int i = 0; i < 100; ++i) {
+    ObjectBuffer object_buffer;
+    ARROW_CHECK_OK(client.Get(&held_id, 1, -1, &object_buffer));
+    ARROW_CHECK_OK(client.Release(held_id));
+  }
+  CreateObject(client2_, pending_id, {2}, {4, 5, 6});
+  for (int i = 0; i < 100; ++i) {
+    ObjectBuffer object_buffer;
+    ARROW_CHECK_OK(client.Get(&pending_id, 1, -1, &object_buffer));
+    ARROW_CHECK_OK(client.Release(pending_id));
+  }
+  getter.join();
+
+  AssertObjectBufferEqual(pending_buffer, {2}, {4, 5, 6});
+  ARROW_CHECK_OK(client.Release(pending_id));
+  ASSERT_FALSE(client.IsInUse(held_id));
+  ASSERT_FALSE(client.IsInUse(pending_id));
+  ARROW_CHECK_OK(client.Disconnect());
+}
+
 TEST_F(TestPlasmaStore, ManyObjectTest) {
   // Create many objects on the first client. Seal one third, abort one third,
   // and leave the last third unsealed.
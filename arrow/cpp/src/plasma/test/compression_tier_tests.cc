@@ -0,0 +1,143 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+
+#include "plasma/client.h"
+#include "plasma/common.h"
+#include "plasma/test/store_fixture.h"
+#include "plasma/test_util.h"
+
+namespace plasma {
+
+class TestPlasmaStoreWithCompression : public PlasmaStoreFixture {
+ public:
+  TestPlasmaStoreWithCompression() : PlasmaStoreFixture("-z lz4 -c 0.5") {}
+};
+
+class TestPlasmaStoreWithCompressionAndExternal : public PlasmaStoreFixture {
+ public:
+  TestPlasmaStoreWithCompressionAndExternal()
+      : PlasmaStoreFixture("-z lz4 -c 0.5 -e hashtable://test") {}
+};
+
+TEST_F(TestPlasmaStoreWithCompression, CompressInsteadOfEvict) {
+  // Twice as much data as fits uncompressed, but it compresses very well.
+  std::vector<ObjectID> object_ids;
+  std::vector<std::string> data;
+  std::string metadata = "meta";
+  for (int i = 0; i < 20; i++) {
+    object_ids.push_back(random_object_id());
+    data.push_back(std::string(100 * 1024, static_cast<char>('a' + i)));
+    ARROW_CHECK_OK(client_.CreateAndSeal(object_ids[i], data[i], metadata));
+  }
+
+  std::string debug_string = client_.DebugString();
+  ASSERT_TRUE(debug_string.find("(compression) codec: lz4") != std::string::npos);
+  ASSERT_TRUE(debug_string.find("(compression) num compressions: 0") ==
+              std::string::npos);
+
+  // All objects are still there, the cold ones only compressed.
+  for (int i = 0; i < 20; i++) {
+    bool has_object;
+    ARROW_CHECK_OK(client_.Contains(object_ids[i], &has_object));
+    ASSERT_TRUE(has_object);
+    std::vector<ObjectBuffer> object_buffers;
+    ARROW_CHECK_OK(client_.Get({object_ids[i]}, -1, &object_buffers));
+    ASSERT_TRUE(object_buffers[0].data);
+    arrow::AssertBufferEqual(*object_buffers[0].data, data[i]);
+    arrow::AssertBufferEqual(*object_buffers[0].metadata, metadata);
+  }
+  ASSERT_TRUE(client_.DebugString().find("(compression) num decompressions: 0") ==
+              std::string::npos);
+
+  // Compressed objects can be deleted like any other.
+  ARROW_CHECK_OK(client_.Delete(object_ids));
+  for (int i = 0; i < 20; i++) {
+    bool has_object;
+    ARROW_CHECK_OK(client_.Contains(object_ids[i], &has_object));
+    ASSERT_FALSE(has_object);
+  }
+}
+
+TEST_F(TestPlasmaStoreWithCompression, GetCompressedObjectWhenFull) {
+  ObjectID object_id = random_object_id();
+  std::string data(100 * 1024, 'a');
+  ARROW_CHECK_OK(client_.CreateAndSeal(object_id, data, ""));
+  // Fill the store with objects the client holds until the first one, the only
+  // one that can make room, is compressed.
+  std::vector<ObjectID> held_ids;
+  while (client_.DebugString().find("(compression) num compressions: 1") ==
+         std::string::npos) {
+    held_ids.push_back(random_object_id());
+    std::shared_ptr<Buffer> buffer;
+    ARROW_CHECK_OK(client_.Create(held_ids.back(), data.size(), nullptr, 0, &buffer));
+    ARROW_CHECK_OK(client_.Seal(held_ids.back()));
+  }
+
+  // There is no room to decompress the object into, so it is reported missing
+  // instead of being waited for.
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client_.Get({object_id}, -1, &object_buffers));
+  ASSERT_FALSE(object_buffers[0].data);
+
+  // Once there is room, it can be got.
+  for (const auto& held_id : held_ids) {
+    ARROW_CHECK_OK(client_.Release(held_id));
+  }
+  ARROW_CHECK_OK(client_.Get({object_id}, -1, &object_buffers));
+  ASSERT_TRUE(object_buffers[0].data);
+  arrow::AssertBufferEqual(*object_buffers[0].data, data);
+}
+
+TEST_F(TestPlasmaStoreWithCompressionAndExternal, RestoreEvictedWhenFull) {
+  // Random data does not compress, so these objects are evicted to the
+  // external store when the compressible ones below need room.
+  std::mt19937 gen(42);
+  std::vector<ObjectID> evicted_ids;
+  std::vector<std::string> evicted_data;
+  for (int i = 0; i < 5; i++) {
+    std::string data(100 * 1024, 0);
+    for (auto& c : data) {
+      c = static_cast<char>(gen());
+    }
+    evicted_ids.push_back(random_object_id());
+    evicted_data.push_back(data);
+    ARROW_CHECK_OK(client_.CreateAndSeal(evicted_ids[i], data, ""));
+  }
+  for (int i = 0; i < 10; i++) {
+    ARROW_CHECK_OK(client_.CreateAndSeal(
+        random_object_id(), std::string(100 * 1024, static_cast<char>('a' + i)), ""));
+  }
+
+  // The store is full, so bringing the evicted objects back compresses other
+  // objects to make room.
+  for (int i = 0; i < 5; i++) {
+    std::vector<ObjectBuffer> object_buffers;
+    ARROW_CHECK_OK(client_.Get({evicted_ids[i]}, -1, &object_buffers));
+    ASSERT_TRUE(object_buffers[0].data);
+    arrow::AssertBufferEqual(*object_buffers[0].data, evicted_data[i]);
+  }
+}
+
+}  // namespace plasma
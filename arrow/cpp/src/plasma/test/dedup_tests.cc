@@ -0,0 +1,78 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+
+#include "plasma/client.h"
+#include "plasma/common.h"
+#include "plasma/test/store_fixture.h"
+#include "plasma/test_util.h"
+
+namespace plasma {
+
+class TestPlasmaStoreWithDedup : public PlasmaStoreFixture {
+ public:
+  TestPlasmaStoreWithDedup() : PlasmaStoreFixture("-u") {}
+};
+
+TEST_F(TestPlasmaStoreWithDedup, IdenticalObjectsShareMemory) {
+  std::vector<ObjectID> object_ids;
+  std::string data(100 * 1024, 'x');
+  std::string metadata = "meta";
+  for (int i = 0; i < 3; i++) {
+    object_ids.push_back(random_object_id());
+    ARROW_CHECK_OK(client_.CreateAndSeal(object_ids[i], data, metadata));
+  }
+  ObjectID other_id = random_object_id();
+  ARROW_CHECK_OK(client_.CreateAndSeal(other_id, std::string(100 * 1024, 'y'), metadata));
+
+  std::string debug_string = client_.DebugString();
+  ASSERT_TRUE(debug_string.find("(dedup) num objects deduplicated: 2") !=
+              std::string::npos);
+  ASSERT_TRUE(debug_string.find("(dedup) bytes saved: " +
+                                std::to_string(2 * (data.size() + metadata.size()))) !=
+              std::string::npos);
+
+  {
+    std::vector<ObjectBuffer> object_buffers;
+    ARROW_CHECK_OK(client_.Get(object_ids, -1, &object_buffers));
+    for (const auto& object_buffer : object_buffers) {
+      ASSERT_TRUE(object_buffer.data);
+      arrow::AssertBufferEqual(*object_buffer.data, data);
+      arrow::AssertBufferEqual(*object_buffer.metadata, metadata);
+    }
+  }
+
+  // The other objects keep the memory when the first one goes away.
+  ARROW_CHECK_OK(client_.Delete(object_ids[0]));
+  for (int i = 1; i < 3; i++) {
+    std::vector<ObjectBuffer> object_buffers;
+    ARROW_CHECK_OK(client_.Get({object_ids[i]}, -1, &object_buffers));
+    ASSERT_TRUE(object_buffers[0].data);
+    arrow::AssertBufferEqual(*object_buffers[0].data, data);
+  }
+  ARROW_CHECK_OK(client_.Delete({object_ids[1], object_ids[2]}));
+  ASSERT_TRUE(client_.DebugString().find("(dedup) num shared regions: 0") !=
+              std::string::npos);
+}
+
+}  // namespace plasma
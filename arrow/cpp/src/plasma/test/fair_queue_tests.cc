@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <map>
+
+#include <gtest/gtest.h>
+
+#include "plasma/fair_queue.h"
+
+namespace plasma {
+
+constexpr int64_t kQuantum = 1 << 20;
+
+bool SkipNone(int fd) { return false; }
+
+TEST(FairQueue, ServedBytesFollowWeights) {
+  FairQueue queue(kQuantum);
+  // The clients send requests of very different costs, and always have
+  // another one waiting.
+  const std::map<int, int> weights = {{3, 1}, {4, 2}, {5, 4}};
+  const std::map<int, int64_t> costs = {{3, 4096}, {4, 3 * kQuantum / 2}, {5, 100000}};
+  std::map<int, int64_t> served;
+  for (const auto& client : weights) {
+    queue.Push(client.first, client.second, costs.at(client.first));
+  }
+  for (int i = 0; i < 100000; ++i) {
+    int fd = queue.Pop(SkipNone);
+    ASSERT_NE(fd, -1);
+    served[fd] += costs.at(fd);
+    queue.Done(fd, true);
+    queue.Push(fd, weights.at(fd), costs.at(fd));
+  }
+  // Each client is within one request and one turn of its share.
+  const double per_weight = static_cast<double>(served[3]) / weights.at(3);
+  for (const auto& client : weights) {
+    const double share = static_cast<double>(served[client.first]) / client.second;
+    ASSERT_NEAR(share / per_weight, 1.0, 0.01) << "client " << client.first;
+  }
+}
+
+TEST(FairQueue, IdleClientLosesWhatItSavedUp) {
+  FairQueue queue(100);
+  queue.Push(3, 1, 10);
+  ASSERT_EQ(queue.Pop(SkipNone), 3);
+  // The client had 90 left, which it loses when it has nothing more to send.
+  queue.Done(3, false);
+  queue.Push(3, 1, 190);
+  queue.Push(4, 1, 100);
+  ASSERT_EQ(queue.Pop(SkipNone), 4);
+  ASSERT_EQ(queue.num_waited(), 1);
+}
+
+TEST(FairQueue, BackloggedClientKeepsItsTurn) {
+  FairQueue queue(100);
+  queue.Push(3, 1, 40);
+  queue.Push(4, 1, 40);
+  ASSERT_EQ(queue.Pop(SkipNone), 3);
+  queue.Done(3, true);
+  queue.Push(3, 1, 40);
+  // 3 can pay for a second request in its turn, but not for a third.
+  ASSERT_EQ(queue.Pop(SkipNone), 3);
+  queue.Done(3, true);
+  queue.Push(3, 1, 40);
+  ASSERT_EQ(queue.Pop(SkipNone), 4);
+  queue.Done(4, false);
+  // 3 kept the 20 it did not spend, so its turn pays for three requests.
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(queue.Pop(SkipNone), 3);
+    queue.Done(3, true);
+    queue.Push(3, 1, 40);
+  }
+  queue.Push(4, 1, 40);
+  ASSERT_EQ(queue.Pop(SkipNone), 4);
+}
+
+TEST(FairQueue, SkippedClientsPassTheirTurn) {
+  FairQueue queue(100);
+  queue.Push(3, 1, 50);
+  queue.Push(4, 1, 50);
+  ASSERT_EQ(queue.Pop([](int fd) { return fd == 3; }), 4);
+  queue.Done(4, false);
+  ASSERT_EQ(queue.Pop([](int fd) { return true; }), -1);
+  ASSERT_FALSE(queue.empty());
+  ASSERT_EQ(queue.Pop(SkipNone), 3);
+  queue.Done(3, false);
+  ASSERT_TRUE(queue.empty());
+}
+
+TEST(FairQueue, RemovedClientIsNotServed) {
+  FairQueue queue(100);
+  queue.Push(3, 1, 50);
+  queue.Push(4, 1, 50);
+  queue.Remove(3);
+  ASSERT_EQ(queue.Pop(SkipNone), 4);
+  queue.Done(4, false);
+  ASSERT_TRUE(queue.empty());
+}
+
+}  // namespace plasma
@@ -0,0 +1,125 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "plasma/lease_table.h"
+
+namespace plasma {
+
+constexpr int64_t kCapacity = 4;
+constexpr int64_t kAlignment = 64;
+
+class TestLeaseTable : public ::testing::Test {
+ public:
+  void SetUp() {
+    region_.resize(LeaseTable::RequiredSize(kCapacity) + kAlignment);
+    table_ = LeaseTable::Create(Region(), kCapacity);
+    client_ = LeaseTable::Open(Region(), LeaseTable::RequiredSize(kCapacity));
+  }
+
+  uint8_t* Region() {
+    auto address = reinterpret_cast<uintptr_t>(region_.data());
+    return region_.data() + (kAlignment - address % kAlignment) % kAlignment;
+  }
+
+ protected:
+  std::vector<uint8_t> region_;
+  // The store's view of the table, and a client's.
+  std::unique_ptr<LeaseTable> table_;
+  std::unique_ptr<LeaseTable> client_;
+};
+
+TEST_F(TestLeaseTable, OpenChecksHeader) {
+  ASSERT_NE(client_, nullptr);
+  ASSERT_EQ(client_->capacity(), kCapacity);
+  ASSERT_EQ(LeaseTable::Open(Region(), 8), nullptr);
+  ASSERT_EQ(LeaseTable::Open(Region(), LeaseTable::RequiredSize(kCapacity) - 1),
+            nullptr);
+  std::vector<uint8_t> empty(LeaseTable::RequiredSize(kCapacity) + kAlignment);
+  ASSERT_EQ(LeaseTable::Open(empty.data(), LeaseTable::RequiredSize(kCapacity)),
+            nullptr);
+}
+
+TEST_F(TestLeaseTable, ActiveLeasesCannotBeRevoked) {
+  int64_t lease = table_->Grant();
+  ASSERT_NE(lease, kNoLease);
+  // A new lease is active, and so is one the client acquired again.
+  ASSERT_FALSE(table_->Revoke(lease));
+  ASSERT_FALSE(client_->Acquire(lease));
+  client_->Release(lease);
+  ASSERT_TRUE(client_->Acquire(lease));
+  ASSERT_FALSE(table_->Revoke(lease));
+  client_->Release(lease);
+  ASSERT_TRUE(table_->Revoke(lease));
+  // Once revoked, the client can not use the lease anymore.
+  ASSERT_FALSE(client_->Acquire(lease));
+  table_->Free(lease);
+  ASSERT_FALSE(client_->Acquire(lease));
+}
+
+TEST_F(TestLeaseTable, SlotsAreReused) {
+  std::vector<int64_t> leases;
+  for (int64_t i = 0; i < kCapacity; ++i) {
+    leases.push_back(table_->Grant());
+    ASSERT_NE(leases.back(), kNoLease);
+  }
+  ASSERT_EQ(table_->Grant(), kNoLease);
+
+  // A lease given up through the store frees its slot, and the lease that
+  // takes the slot over is not mistaken for the old one.
+  client_->Release(leases[0]);
+  table_->Free(leases[0]);
+  int64_t lease = table_->Grant();
+  ASSERT_NE(lease, kNoLease);
+  ASSERT_NE(lease, leases[0]);
+  client_->Release(lease);
+  ASSERT_FALSE(client_->Acquire(leases[0]));
+  ASSERT_FALSE(table_->Revoke(leases[0]));
+  ASSERT_TRUE(client_->Acquire(lease));
+}
+
+TEST_F(TestLeaseTable, RevokeRacesAcquire) {
+  constexpr int kRounds = 10000;
+  int64_t lease = table_->Grant();
+  client_->Release(lease);
+  std::atomic<bool> revoked(false);
+  std::atomic<int> in_use(0);
+  std::thread store([&]() {
+    while (!table_->Revoke(lease)) {
+    }
+    // Nobody may use the object once its lease is revoked.
+    ASSERT_EQ(in_use.load(), 0);
+    revoked = true;
+  });
+  for (int i = 0; i < kRounds && !revoked; ++i) {
+    if (!client_->Acquire(lease)) {
+      break;
+    }
+    in_use++;
+    in_use--;
+    client_->Release(lease);
+  }
+  store.join();
+  ASSERT_FALSE(client_->Acquire(lease));
+}
+
+}  // namespace plasma
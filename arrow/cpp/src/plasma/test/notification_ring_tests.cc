@@ -0,0 +1,155 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "plasma/common.h"
+#include "plasma/notification_ring.h"
+#include "plasma/test_util.h"
+
+namespace plasma {
+
+constexpr int64_t kCapacity = 4;
+constexpr int64_t kAlignment = 64;
+
+class TestNotificationRing : public ::testing::Test {
+ public:
+  void SetUp() {
+    region_.resize(NotificationRing::RequiredSize(kCapacity) + kAlignment);
+    subscriber_ = NotificationRing::Create(Region(), kCapacity);
+    store_ = NotificationRing::Open(Region(), NotificationRing::RequiredSize(kCapacity));
+  }
+
+  uint8_t* Region() {
+    auto address = reinterpret_cast<uintptr_t>(region_.data());
+    return region_.data() + (kAlignment - address % kAlignment) % kAlignment;
+  }
+
+ protected:
+  std::vector<uint8_t> region_;
+  // The subscriber formats the ring, and the store attaches to it.
+  std::unique_ptr<NotificationRing> subscriber_;
+  std::unique_ptr<NotificationRing> store_;
+};
+
+TEST_F(TestNotificationRing, OpenChecksHeader) {
+  ASSERT_NE(store_, nullptr);
+  ASSERT_EQ(store_->capacity(), kCapacity);
+  ASSERT_EQ(NotificationRing::Open(Region(), 8), nullptr);
+  ASSERT_EQ(
+      NotificationRing::Open(Region(), NotificationRing::RequiredSize(kCapacity) - 1),
+      nullptr);
+  std::vector<uint8_t> empty(NotificationRing::RequiredSize(kCapacity) + kAlignment);
+  ASSERT_EQ(NotificationRing::Open(empty.data(), NotificationRing::RequiredSize(kCapacity)),
+            nullptr);
+}
+
+TEST_F(TestNotificationRing, NotificationsAreReadAfterPublish) {
+  ObjectID sealed = random_object_id();
+  ObjectID deleted = random_object_id();
+  ASSERT_TRUE(store_->Push(sealed, 100, 10));
+  ASSERT_TRUE(store_->Push(deleted, -1, -1));
+
+  ObjectID object_id;
+  int64_t data_size;
+  int64_t metadata_size;
+  ASSERT_FALSE(subscriber_->Pop(&object_id, &data_size, &metadata_size));
+  // The subscriber had read everything, so it has to be woken.
+  ASSERT_TRUE(store_->Publish());
+  ASSERT_FALSE(subscriber_->Empty());
+
+  ASSERT_TRUE(subscriber_->Pop(&object_id, &data_size, &metadata_size));
+  ASSERT_EQ(object_id, sealed);
+  ASSERT_EQ(data_size, 100);
+  ASSERT_EQ(metadata_size, 10);
+  ASSERT_TRUE(subscriber_->Pop(&object_id, &data_size, &metadata_size));
+  ASSERT_EQ(object_id, deleted);
+  ASSERT_EQ(data_size, -1);
+  ASSERT_EQ(metadata_size, -1);
+  ASSERT_TRUE(subscriber_->Empty());
+  ASSERT_FALSE(subscriber_->Pop(&object_id, &data_size, &metadata_size));
+}
+
+TEST_F(TestNotificationRing, WakeupOnlyWhenCaughtUp) {
+  ObjectID object_id = random_object_id();
+  ASSERT_FALSE(store_->Publish());
+  ASSERT_TRUE(store_->Push(object_id, 1, 0));
+  ASSERT_TRUE(store_->Publish());
+  // The subscriber has not read the first notification yet.
+  ASSERT_TRUE(store_->Push(object_id, 2, 0));
+  ASSERT_FALSE(store_->Publish());
+
+  int64_t data_size;
+  int64_t metadata_size;
+  ASSERT_TRUE(subscriber_->Pop(&object_id, &data_size, &metadata_size));
+  ASSERT_TRUE(subscriber_->Pop(&object_id, &data_size, &metadata_size));
+  ASSERT_TRUE(store_->Push(object_id, 3, 0));
+  ASSERT_TRUE(store_->Publish());
+}
+
+TEST_F(TestNotificationRing, FullRingRejectsPush) {
+  ObjectID object_id = random_object_id();
+  for (int64_t i = 0; i < kCapacity; ++i) {
+    ASSERT_TRUE(store_->Push(object_id, i, 0));
+  }
+  ASSERT_FALSE(store_->Push(object_id, kCapacity, 0));
+  store_->Publish();
+
+  // Reading an entry makes room for one more, which wraps around.
+  int64_t data_size;
+  int64_t metadata_size;
+  ASSERT_TRUE(subscriber_->Pop(&object_id, &data_size, &metadata_size));
+  ASSERT_EQ(data_size, 0);
+  ASSERT_TRUE(store_->Push(object_id, kCapacity, 0));
+  ASSERT_FALSE(store_->Push(object_id, kCapacity + 1, 0));
+  store_->Publish();
+  for (int64_t i = 1; i <= kCapacity; ++i) {
+    ASSERT_TRUE(subscriber_->Pop(&object_id, &data_size, &metadata_size));
+    ASSERT_EQ(data_size, i);
+  }
+}
+
+TEST_F(TestNotificationRing, ConcurrentProducerAndConsumer) {
+  constexpr int64_t kNotifications = 100000;
+  ObjectID object_id = random_object_id();
+  std::thread store([&]() {
+    for (int64_t i = 0; i < kNotifications; ++i) {
+      while (!store_->Push(object_id, i, 0)) {
+        store_->Publish();
+        std::this_thread::yield();
+      }
+      store_->Publish();
+    }
+  });
+  int64_t data_size;
+  int64_t metadata_size;
+  for (int64_t i = 0; i < kNotifications; ++i) {
+    ObjectID read_id;
+    while (!subscriber_->Pop(&read_id, &data_size, &metadata_size)) {
+      std::this_thread::yield();
+    }
+    ASSERT_EQ(read_id, object_id);
+    ASSERT_EQ(data_size, i);
+  }
+  store.join();
+  ASSERT_TRUE(subscriber_->Empty());
+}
+
+}  // namespace plasma
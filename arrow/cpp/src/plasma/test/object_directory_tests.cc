@@ -0,0 +1,245 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "plasma/common.h"
+#include "plasma/object_directory.h"
+#include "plasma/test_util.h"
+
+namespace plasma {
+
+constexpr int64_t kCapacity = 1024;
+constexpr int64_t kAlignment = 64;
+
+class TestObjectDirectory : public ::testing::Test {
+ public:
+  void SetUp() {
+    region_.resize(RegionSize() + kAlignment);
+    directory_ = ObjectDirectory::Create(Region(), kCapacity);
+  }
+
+  // The region starts at a cache line, as a mapping would.
+  uint8_t* Region() {
+    auto address = reinterpret_cast<uintptr_t>(region_.data());
+    return region_.data() + (kAlignment - address % kAlignment) % kAlignment;
+  }
+  int64_t RegionSize() { return ObjectDirectory::RequiredSize(kCapacity); }
+
+  static PlasmaObject MakeObject(int64_t offset, int64_t data_size) {
+    PlasmaObject object = {};
+    object.data_offset = offset;
+    object.metadata_offset = offset + data_size;
+    object.data_size = data_size;
+    object.metadata_size = 1;
+    object.device_num = 0;
+    return object;
+  }
+
+ protected:
+  std::vector<uint8_t> region_;
+  std::unique_ptr<ObjectDirectory> directory_;
+};
+
+TEST_F(TestObjectDirectory, PublishLookupRemove) {
+  ObjectID object_id = random_object_id();
+  PlasmaObject object;
+  ASSERT_FALSE(directory_->Lookup(object_id, &object));
+
+  ASSERT_TRUE(directory_->Publish(object_id, MakeObject(4096, 100)));
+  uint64_t version1;
+  ASSERT_TRUE(directory_->Lookup(object_id, &object, &version1));
+  ASSERT_EQ(object.data_offset, 4096);
+  ASSERT_EQ(object.metadata_offset, 4196);
+  ASSERT_EQ(object.data_size, 100);
+  ASSERT_EQ(object.metadata_size, 1);
+
+  // Republishing the object moves it and changes its version.
+  ASSERT_TRUE(directory_->Publish(object_id, MakeObject(8192, 10)));
+  uint64_t version2;
+  ASSERT_TRUE(directory_->Lookup(object_id, &object, &version2));
+  ASSERT_EQ(object.data_offset, 8192);
+  ASSERT_NE(version1, version2);
+
+  directory_->Remove(object_id);
+  ASSERT_FALSE(directory_->Lookup(object_id, &object));
+  directory_->Remove(object_id);
+}
+
+TEST_F(TestObjectDirectory, OpenFromAnotherMapping) {
+  ObjectID object_id = random_object_id();
+  ASSERT_TRUE(directory_->Publish(object_id, MakeObject(64, 8)));
+
+  auto reader = ObjectDirectory::Open(Region(), RegionSize());
+  ASSERT_NE(reader, nullptr);
+  ASSERT_EQ(reader->capacity(), kCapacity);
+  PlasmaObject object;
+  ASSERT_TRUE(reader->Lookup(object_id, &object));
+  ASSERT_EQ(object.data_offset, 64);
+
+  // A region that is too small or was never formatted has no directory.
+  ASSERT_EQ(ObjectDirectory::Open(Region(), RegionSize() - 1), nullptr);
+  std::fill(region_.begin(), region_.end(), 0);
+  ASSERT_EQ(ObjectDirectory::Open(Region(), RegionSize()), nullptr);
+}
+
+TEST_F(TestObjectDirectory, RecoverAfterRestart) {
+  ObjectID kept_id = random_object_id();
+  ObjectID removed_id = random_object_id();
+  const unsigned char digest[kDigestSize] = {1, 2, 3, 4, 5, 6, 7, 8};
+  ASSERT_TRUE(directory_->Publish(kept_id, MakeObject(4096, 100), digest));
+  ASSERT_TRUE(directory_->Publish(removed_id, MakeObject(8192, 10)));
+  directory_->Remove(removed_id);
+  directory_.reset();
+
+  // A store restarting on the region gets the sealed objects back.
+  std::vector<ObjectDirectory::RecoveredObject> objects;
+  auto recovered = ObjectDirectory::Recover(Region(), kCapacity, &objects);
+  ASSERT_NE(recovered, nullptr);
+  ASSERT_EQ(objects.size(), 1);
+  ASSERT_EQ(objects[0].object_id, kept_id);
+  ASSERT_EQ(objects[0].object.data_offset, 4096);
+  ASSERT_EQ(objects[0].object.data_size, 100);
+  ASSERT_EQ(std::memcmp(objects[0].digest, digest, kDigestSize), 0);
+  PlasmaObject object;
+  ASSERT_TRUE(recovered->Lookup(kept_id, &object));
+
+  // A directory with another capacity belongs to a differently sized store.
+  ASSERT_EQ(ObjectDirectory::Recover(Region(), kCapacity * 2, &objects), nullptr);
+  std::fill(region_.begin(), region_.end(), 0);
+  ASSERT_EQ(ObjectDirectory::Recover(Region(), kCapacity, &objects), nullptr);
+}
+
+TEST_F(TestObjectDirectory, ScanInPieces) {
+  std::vector<ObjectID> object_ids;
+  for (int64_t i = 0; i < 100; i++) {
+    object_ids.push_back(random_object_id());
+    ASSERT_TRUE(directory_->Publish(object_ids.back(), MakeObject(64 * i, i)));
+  }
+  directory_->Remove(object_ids[0]);
+
+  // Scanning ten objects at a time finds each sealed object once.
+  std::vector<std::pair<ObjectID, PlasmaObject>> objects;
+  int64_t cursor = 0;
+  while (cursor < directory_->capacity()) {
+    size_t before = objects.size();
+    cursor = directory_->Scan(cursor, 10, &objects);
+    ASSERT_LE(objects.size() - before, 10);
+  }
+  ASSERT_EQ(objects.size(), 99);
+  std::unordered_map<ObjectID, PlasmaObject> found(objects.begin(), objects.end());
+  ASSERT_EQ(found.size(), 99);
+  ASSERT_EQ(found.count(object_ids[0]), 0);
+  ASSERT_EQ(found[object_ids[42]].data_offset, 64 * 42);
+  ASSERT_EQ(found[object_ids[42]].data_size, 42);
+}
+
+TEST_F(TestObjectDirectory, MaxRegionSize) {
+  auto reader = ObjectDirectory::Open(Region(), RegionSize());
+  ASSERT_NE(reader, nullptr);
+  ASSERT_EQ(reader->max_region_size(), 0);
+  // A reader sees the size the store may grow the region to.
+  directory_->SetMaxRegionSize(int64_t(1) << 30);
+  ASSERT_EQ(reader->max_region_size(), int64_t(1) << 30);
+
+  std::vector<ObjectDirectory::RecoveredObject> objects;
+  directory_.reset();
+  auto recovered = ObjectDirectory::Recover(Region(), kCapacity, &objects);
+  ASSERT_NE(recovered, nullptr);
+  ASSERT_EQ(recovered->max_region_size(), int64_t(1) << 30);
+}
+
+TEST_F(TestObjectDirectory, FullDirectoryAndChurn) {
+  // The directory fills up to 7/8 of its slots at most, and may turn objects
+  // away before that if their part of it is crowded.
+  std::vector<ObjectID> object_ids;
+  for (;;) {
+    ObjectID object_id = random_object_id();
+    if (!directory_->Publish(object_id, MakeObject(object_ids.size() * 64, 64))) {
+      break;
+    }
+    object_ids.push_back(object_id);
+  }
+  ASSERT_LE(object_ids.size(), kCapacity / 8 * 7);
+  ASSERT_GE(object_ids.size(), kCapacity / 2);
+  PlasmaObject object;
+  ASSERT_FALSE(directory_->Lookup(random_object_id(), &object));
+
+  // Removing objects makes room again, and the others can still be found
+  // after the objects behind them moved.
+  const int64_t num_objects = object_ids.size();
+  for (int64_t i = 0; i < num_objects; i += 2) {
+    directory_->Remove(object_ids[i]);
+  }
+  for (int round = 0; round < 10; round++) {
+    std::vector<ObjectID> churn;
+    for (int64_t i = 0; i < kCapacity / 4; i++) {
+      churn.push_back(random_object_id());
+      ASSERT_TRUE(directory_->Publish(churn.back(), MakeObject(0, 1)));
+    }
+    for (const auto& object_id : churn) {
+      directory_->Remove(object_id);
+    }
+  }
+  for (int64_t i = 0; i < num_objects; i++) {
+    ASSERT_EQ(directory_->Lookup(object_ids[i], &object), i % 2 == 1);
+    if (i % 2 == 1) {
+      ASSERT_EQ(object.data_offset, i * 64);
+    }
+  }
+
+  // Once everything is removed, the directory takes as many objects as before.
+  for (int64_t i = 1; i < num_objects; i += 2) {
+    directory_->Remove(object_ids[i]);
+  }
+  for (int64_t i = 0; i < kCapacity / 2; i++) {
+    ASSERT_TRUE(directory_->Publish(random_object_id(), MakeObject(0, 1)));
+  }
+}
+
+TEST_F(TestObjectDirectory, ConcurrentReader) {
+  ObjectID object_id = random_object_id();
+  ASSERT_TRUE(directory_->Publish(object_id, MakeObject(0, 0)));
+  std::atomic<bool> done(false);
+  std::atomic<bool> torn(false);
+  std::thread reader([&]() {
+    PlasmaObject object;
+    while (!done) {
+      // The writer keeps data_size and the metadata offset in step, so a
+      // reader that sees them disagree read a half-written slot.
+      if (directory_->Lookup(object_id, &object) &&
+          object.metadata_offset != object.data_offset + object.data_size) {
+        torn = true;
+      }
+    }
+  });
+  for (int64_t i = 0; i < 100000; i++) {
+    ASSERT_TRUE(directory_->Publish(object_id, MakeObject(i, i)));
+  }
+  done = true;
+  reader.join();
+  ASSERT_FALSE(torn);
+}
+
+}  // namespace plasma
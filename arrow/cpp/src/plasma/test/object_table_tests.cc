@@ -0,0 +1,143 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <unordered_set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "plasma/common.h"
+#include "plasma/flat_object_table.h"
+#include "plasma/test_util.h"
+
+namespace plasma {
+
+TEST(FlatObjectTable, InsertFindErase) {
+  FlatObjectTable table;
+  ObjectID object_id = random_object_id();
+  ASSERT_TRUE(table.find(object_id) == table.end());
+
+  auto result = table.emplace(object_id);
+  ASSERT_TRUE(result.second);
+  result.first->second.data_size = 42;
+  ASSERT_EQ(table.size(), 1);
+
+  // Inserting the same ID again returns the existing entry.
+  result = table.emplace(object_id);
+  ASSERT_FALSE(result.second);
+  ASSERT_EQ(result.first->second.data_size, 42);
+  ASSERT_EQ(table.size(), 1);
+
+  auto it = table.find(object_id);
+  ASSERT_TRUE(it != table.end());
+  ASSERT_EQ(it->first, object_id);
+  ASSERT_EQ(it->second.data_size, 42);
+
+  ASSERT_EQ(table.erase(object_id), 1);
+  ASSERT_EQ(table.erase(object_id), 0);
+  ASSERT_TRUE(table.find(object_id) == table.end());
+  ASSERT_TRUE(table.empty());
+}
+
+TEST(FlatObjectTable, GrowAndIterate) {
+  FlatObjectTable table;
+  std::vector<ObjectID> object_ids;
+  for (int i = 0; i < 10000; i++) {
+    object_ids.push_back(random_object_id());
+    table.emplace(object_ids.back()).first->second.data_size = i;
+  }
+  ASSERT_EQ(table.size(), 10000);
+  for (int i = 0; i < 10000; i++) {
+    auto it = table.find(object_ids[i]);
+    ASSERT_TRUE(it != table.end());
+    ASSERT_EQ(it->second.data_size, i);
+  }
+
+  std::unordered_set<ObjectID> seen;
+  for (const auto& entry : table) {
+    ASSERT_TRUE(seen.insert(entry.first).second);
+  }
+  ASSERT_EQ(seen.size(), 10000);
+}
+
+TEST(FlatObjectTable, EraseKeepsOtherEntries) {
+  FlatObjectTable table;
+  std::vector<ObjectID> object_ids;
+  for (int i = 0; i < 1000; i++) {
+    object_ids.push_back(random_object_id());
+    table.emplace(object_ids.back());
+  }
+  // Erasing must not move the remaining entries.
+  std::vector<ObjectTableEntry*> entries;
+  for (int i = 0; i < 1000; i++) {
+    entries.push_back(&table.find(object_ids[i])->second);
+  }
+  for (int i = 0; i < 1000; i += 2) {
+    ASSERT_EQ(table.erase(object_ids[i]), 1);
+  }
+  ASSERT_EQ(table.size(), 500);
+  for (int i = 0; i < 1000; i++) {
+    auto it = table.find(object_ids[i]);
+    if (i % 2 == 0) {
+      ASSERT_TRUE(it == table.end());
+    } else {
+      ASSERT_EQ(&it->second, entries[i]);
+    }
+  }
+}
+
+TEST(FlatObjectTable, ScanWithCursor) {
+  FlatObjectTable table;
+  for (int i = 0; i < 1000; i++) {
+    table.emplace(random_object_id());
+  }
+  const int64_t generation = table.generation();
+  // Scanning in pieces from slot indices visits every entry once.
+  std::unordered_set<ObjectID> seen;
+  int64_t cursor = 0;
+  while (cursor < table.capacity()) {
+    auto it = table.begin_at(cursor);
+    for (int i = 0; i < 100 && it != table.end(); i++, ++it) {
+      ASSERT_TRUE(seen.insert(it->first).second);
+    }
+    cursor = it.index();
+  }
+  ASSERT_EQ(seen.size(), 1000);
+
+  // Erasing keeps the cursors, growing the table does not.
+  table.erase(*seen.begin());
+  ASSERT_EQ(table.generation(), generation);
+  table.reserve(4 * table.capacity());
+  ASSERT_GT(table.generation(), generation);
+}
+
+TEST(FlatObjectTable, ChurnDoesNotGrowUnbounded) {
+  FlatObjectTable table;
+  table.reserve(100);
+  int64_t capacity = table.capacity();
+  // Repeatedly inserting and erasing leaves tombstones, which must be cleaned
+  // up by rehashing in place rather than by growing the table.
+  for (int i = 0; i < 100000; i++) {
+    ObjectID object_id = random_object_id();
+    table.emplace(object_id);
+    ASSERT_EQ(table.erase(object_id), 1);
+  }
+  ASSERT_TRUE(table.empty());
+  ASSERT_EQ(table.capacity(), capacity);
+}
+
+}  // namespace plasma
@@ -27,6 +27,7 @@
 
 #include "plasma/common.h"
 #include "plasma/io.h"
+#include "plasma/lease_table.h"
 #include "plasma/plasma.h"
 #include "plasma/protocol.h"
 #include "plasma/test_util.h"
@@ -162,6 +163,75 @@ TEST_F(TestPlasmaSerialization, SealReply) {
   close(fd);
 }
 
+TEST_F(TestPlasmaSerialization, ConnectRequest) {
+  int fd = CreateTemporaryFile();
+  ASSERT_OK(SendConnectRequest(fd, 1, true));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaConnectRequest);
+  int numa_node;
+  bool remote_memory;
+  ASSERT_OK(ReadConnectRequest(data.data(), data.size(), &numa_node, &remote_memory));
+  ASSERT_EQ(numa_node, 1);
+  ASSERT_TRUE(remote_memory);
+  close(fd);
+}
+
+TEST_F(TestPlasmaSerialization, SetOptionsRequest) {
+  int fd = CreateTemporaryFile();
+  ASSERT_OK(SendSetOptionsRequest(fd, "reader", 1024, 4));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaSetOptionsRequest);
+  std::string client_name;
+  int64_t output_memory_quota;
+  int weight;
+  ASSERT_OK(ReadSetOptionsRequest(data.data(), data.size(), &client_name,
+                                  &output_memory_quota, &weight));
+  ASSERT_EQ(client_name, "reader");
+  ASSERT_EQ(output_memory_quota, 1024);
+  ASSERT_EQ(weight, 4);
+  close(fd);
+}
+
+TEST_F(TestPlasmaSerialization, SubscribeRequest) {
+  int fd = CreateTemporaryFile();
+  ASSERT_OK(SendSubscribeRequest(fd, true));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaSubscribeRequest);
+  bool notification_ring;
+  ASSERT_OK(ReadSubscribeRequest(data.data(), data.size(), &notification_ring));
+  ASSERT_TRUE(notification_ring);
+  close(fd);
+}
+
+TEST_F(TestPlasmaSerialization, CreateViewRequest) {
+  int fd = CreateTemporaryFile();
+  ObjectID parent_id1 = random_object_id();
+  ObjectID object_id1 = random_object_id();
+  ASSERT_OK(SendCreateViewRequest(fd, parent_id1, 16, 32, object_id1));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaCreateViewRequest);
+  ObjectID parent_id2;
+  ObjectID object_id2;
+  int64_t offset;
+  int64_t length;
+  ASSERT_OK(ReadCreateViewRequest(data.data(), data.size(), &parent_id2, &offset,
+                                  &length, &object_id2));
+  ASSERT_EQ(parent_id1, parent_id2);
+  ASSERT_EQ(offset, 16);
+  ASSERT_EQ(length, 32);
+  ASSERT_EQ(object_id1, object_id2);
+  close(fd);
+}
+
+TEST_F(TestPlasmaSerialization, CreateViewReply) {
+  int fd = CreateTemporaryFile();
+  ASSERT_OK(SendCreateViewReply(fd, PlasmaError::InvalidView));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaCreateViewReply);
+  ASSERT_RAISES(Invalid, ReadCreateViewReply(data.data(), data.size()));
+  close(fd);
+}
+
 TEST_F(TestPlasmaSerialization, GetRequest) {
   int fd = CreateTemporaryFile();
   ObjectID object_ids[2];
@@ -216,6 +286,134 @@ TEST_F(TestPlasmaSerialization, GetReply) {
   close(fd);
 }
 
+TEST_F(TestPlasmaSerialization, GetReplyFromArray) {
+  int fd = CreateTemporaryFile();
+  int fd2 = CreateTemporaryFile();
+  ObjectID object_ids[2] = {random_object_id(), random_object_id()};
+  PlasmaObject plasma_objects[2] = {random_plasma_object(), random_plasma_object()};
+  std::vector<int> store_fds = {1, 2};
+  std::vector<int64_t> mmap_sizes = {100, 200};
+  // The second reply is built in the builder of the first one.
+  ASSERT_OK(SendGetReply(fd, object_ids, plasma_objects, 2, store_fds, mmap_sizes, 7));
+  ASSERT_OK(SendGetReply(fd2, &object_ids[1], &plasma_objects[1], 1, {}, {}, 8));
+
+  std::vector<uint8_t> data = read_message_from_file(fd, MessageType::PlasmaGetReply);
+  ObjectID object_ids_return[2];
+  PlasmaObject plasma_objects_return[2];
+  std::vector<int> store_fds_return;
+  std::vector<int64_t> mmap_sizes_return;
+  uint64_t request_id;
+  memset(&plasma_objects_return, 0, sizeof(plasma_objects_return));
+  ASSERT_OK(ReadGetReply(data.data(), data.size(), object_ids_return,
+                         &plasma_objects_return[0], 2, store_fds_return,
+                         mmap_sizes_return, &request_id));
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_EQ(object_ids[i], object_ids_return[i]);
+    ASSERT_EQ(plasma_objects[i], plasma_objects_return[i]);
+  }
+  ASSERT_TRUE(store_fds == store_fds_return);
+  ASSERT_TRUE(mmap_sizes == mmap_sizes_return);
+  ASSERT_EQ(request_id, 7);
+
+  data = read_message_from_file(fd2, MessageType::PlasmaGetReply);
+  std::vector<int> store_fds_return2;
+  std::vector<int64_t> mmap_sizes_return2;
+  ASSERT_OK(ReadGetReply(data.data(), data.size(), object_ids_return,
+                         &plasma_objects_return[0], 1, store_fds_return2,
+                         mmap_sizes_return2, &request_id));
+  ASSERT_EQ(object_ids[1], object_ids_return[0]);
+  ASSERT_EQ(plasma_objects[1], plasma_objects_return[0]);
+  ASSERT_TRUE(store_fds_return2.empty());
+  ASSERT_EQ(request_id, 8);
+  close(fd);
+  close(fd2);
+}
+
+TEST_F(TestPlasmaSerialization, GetReplyLeases) {
+  int fd = CreateTemporaryFile();
+  ObjectID object_ids[2];
+  object_ids[0] = random_object_id();
+  object_ids[1] = random_object_id();
+  std::unordered_map<ObjectID, PlasmaObject> plasma_objects;
+  plasma_objects[object_ids[0]] = random_plasma_object();
+  plasma_objects[object_ids[1]] = random_plasma_object();
+  std::vector<int64_t> leases = {kNoLease, (int64_t(3) << 32) | 7};
+  ASSERT_OK(SendGetReply(fd, object_ids, plasma_objects, 2, {}, {}, 0, leases));
+
+  std::vector<uint8_t> data = read_message_from_file(fd, MessageType::PlasmaGetReply);
+  ObjectID object_ids_return[2];
+  PlasmaObject plasma_objects_return[2];
+  std::vector<int> store_fds_return;
+  std::vector<int64_t> mmap_sizes_return;
+  std::vector<int64_t> leases_return;
+  ASSERT_OK(ReadGetReply(data.data(), data.size(), object_ids_return,
+                         &plasma_objects_return[0], 2, store_fds_return,
+                         mmap_sizes_return, nullptr, &leases_return));
+  ASSERT_TRUE(leases == leases_return);
+  close(fd);
+
+  // A reply without leases leaves the vector empty.
+  fd = CreateTemporaryFile();
+  ASSERT_OK(SendGetReply(fd, object_ids, plasma_objects, 2, {}, {}));
+  data = read_message_from_file(fd, MessageType::PlasmaGetReply);
+  ASSERT_OK(ReadGetReply(data.data(), data.size(), object_ids_return,
+                         &plasma_objects_return[0], 2, store_fds_return,
+                         mmap_sizes_return, nullptr, &leases_return));
+  ASSERT_TRUE(leases_return.empty());
+  close(fd);
+}
+
+TEST_F(TestPlasmaSerialization, RequestIds) {
+  ObjectID object_ids[1] = {random_object_id()};
+  uint64_t request_id;
+
+  int fd = CreateTemporaryFile();
+  ASSERT_OK(SendGetRequest(fd, object_ids, 1, -1, /*request_id=*/17));
+  std::vector<uint8_t> data = read_message_from_file(fd, MessageType::PlasmaGetRequest);
+  std::vector<ObjectID> object_ids_return;
+  int64_t timeout_ms;
+  ASSERT_OK(ReadGetRequest(data.data(), data.size(), object_ids_return, &timeout_ms,
+                           &request_id));
+  ASSERT_EQ(request_id, 17);
+  close(fd);
+
+  fd = CreateTemporaryFile();
+  std::unordered_map<ObjectID, PlasmaObject> plasma_objects;
+  plasma_objects[object_ids[0]] = random_plasma_object();
+  ASSERT_OK(SendGetReply(fd, object_ids, plasma_objects, 1, {}, {}, request_id));
+  data = read_message_from_file(fd, MessageType::PlasmaGetReply);
+  ASSERT_OK(ReadReplyRequestId(MessageType::PlasmaGetReply, data.data(), data.size(),
+                               &request_id));
+  ASSERT_EQ(request_id, 17);
+  close(fd);
+
+  fd = CreateTemporaryFile();
+  PlasmaObject object = random_plasma_object();
+  ASSERT_OK(SendCreateReply(fd, object_ids[0], &object, PlasmaError::OK, 0, 18));
+  data = read_message_from_file(fd, MessageType::PlasmaCreateReply);
+  ASSERT_OK(ReadReplyRequestId(MessageType::PlasmaCreateReply, data.data(), data.size(),
+                               &request_id));
+  ASSERT_EQ(request_id, 18);
+  close(fd);
+
+  fd = CreateTemporaryFile();
+  ASSERT_OK(SendSealReply(fd, object_ids[0], PlasmaError::OK, 19));
+  data = read_message_from_file(fd, MessageType::PlasmaSealReply);
+  ASSERT_OK(ReadReplyRequestId(MessageType::PlasmaSealReply, data.data(), data.size(),
+                               &request_id));
+  ASSERT_EQ(request_id, 19);
+  close(fd);
+
+  // Requests that don't set a request_id default to 0.
+  fd = CreateTemporaryFile();
+  ASSERT_OK(SendSealReply(fd, object_ids[0], PlasmaError::OK));
+  data = read_message_from_file(fd, MessageType::PlasmaSealReply);
+  ObjectID object_id;
+  ASSERT_OK(ReadSealReply(data.data(), data.size(), &object_id, &request_id));
+  ASSERT_EQ(request_id, 0);
+  close(fd);
+}
+
 TEST_F(TestPlasmaSerialization, ReleaseRequest) {
   int fd = CreateTemporaryFile();
   ObjectID object_id1 = random_object_id();
@@ -271,6 +469,59 @@ TEST_F(TestPlasmaSerialization, DeleteReply) {
   close(fd);
 }
 
+TEST_F(TestPlasmaSerialization, ListRequest) {
+  int fd = CreateTemporaryFile();
+  ObjectListFilter filter;
+  filter.state_mask = 1 << static_cast<int>(ObjectState::PLASMA_SEALED);
+  filter.min_size = 100;
+  filter.max_size = 1000;
+  filter.max_age = 60;
+  filter.owner = "writer";
+  ASSERT_OK(SendListRequest(fd, filter, 500, 12345));
+  std::vector<uint8_t> data = read_message_from_file(fd, MessageType::PlasmaListRequest);
+  ObjectListFilter filter_read;
+  int64_t page_size;
+  uint64_t cursor;
+  ASSERT_OK(
+      ReadListRequest(data.data(), data.size(), &filter_read, &page_size, &cursor));
+  ASSERT_EQ(filter_read.state_mask, filter.state_mask);
+  ASSERT_EQ(filter_read.min_size, 100);
+  ASSERT_EQ(filter_read.max_size, 1000);
+  ASSERT_EQ(filter_read.min_age, 0);
+  ASSERT_EQ(filter_read.max_age, 60);
+  ASSERT_EQ(filter_read.owner, "writer");
+  ASSERT_EQ(page_size, 500);
+  ASSERT_EQ(cursor, 12345);
+  close(fd);
+}
+
+TEST_F(TestPlasmaSerialization, ListReply) {
+  int fd = CreateTemporaryFile();
+  FlatObjectTable table;
+  ObjectID object_id = random_object_id();
+  auto& entry = table.emplace(object_id).first->second;
+  entry.data_size = 100;
+  entry.metadata_size = 10;
+  entry.state = ObjectState::PLASMA_SEALED;
+  table.emplace(random_object_id()).first->second.state = ObjectState::PLASMA_CREATED;
+  // Only the page of the first object is sent.
+  std::vector<FlatObjectTable::const_iterator> page = {
+      static_cast<const FlatObjectTable&>(table).find(object_id)};
+  ASSERT_OK(SendListReply(fd, page, 42, true));
+  std::vector<uint8_t> data = read_message_from_file(fd, MessageType::PlasmaListReply);
+  ObjectTable objects;
+  uint64_t cursor;
+  bool restarted;
+  ASSERT_OK(ReadListReply(data.data(), data.size(), &objects, &cursor, &restarted));
+  ASSERT_EQ(objects.size(), 1);
+  ASSERT_EQ(objects[object_id]->data_size, 100);
+  ASSERT_EQ(objects[object_id]->metadata_size, 10);
+  ASSERT_EQ(objects[object_id]->state, ObjectState::PLASMA_SEALED);
+  ASSERT_EQ(cursor, 42);
+  ASSERT_TRUE(restarted);
+  close(fd);
+}
+
 TEST_F(TestPlasmaSerialization, EvictRequest) {
   int fd = CreateTemporaryFile();
   int64_t num_bytes = 111;
@@ -293,6 +544,90 @@ TEST_F(TestPlasmaSerialization, EvictReply) {
   close(fd);
 }
 
+TEST_F(TestPlasmaSerialization, GrowRegionRequest) {
+  int fd = CreateTemporaryFile();
+  ASSERT_OK(SendGrowRegionRequest(fd, 1 << 30));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaGrowRegionRequest);
+  int64_t memory_capacity;
+  ASSERT_OK(ReadGrowRegionRequest(data.data(), data.size(), &memory_capacity));
+  ASSERT_EQ(memory_capacity, 1 << 30);
+  close(fd);
+}
+
+TEST_F(TestPlasmaSerialization, GrowRegionReply) {
+  int fd = CreateTemporaryFile();
+  ASSERT_OK(SendGrowRegionReply(fd, PlasmaError::OutOfMemory, 1 << 20));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaGrowRegionReply);
+  int64_t memory_capacity;
+  Status s = ReadGrowRegionReply(data.data(), data.size(), &memory_capacity);
+  ASSERT_TRUE(IsPlasmaStoreFull(s));
+  // The reply tells the size of the region also when it did not grow.
+  ASSERT_EQ(memory_capacity, 1 << 20);
+  close(fd);
+}
+
+TEST_F(TestPlasmaSerialization, WaitRequest) {
+  int fd = CreateTemporaryFile();
+  std::vector<ObjectID> object_ids1 = {random_object_id(), random_object_id()};
+  ASSERT_OK(SendWaitRequest(fd, object_ids1, 1, 100));
+  std::vector<uint8_t> data = read_message_from_file(fd, MessageType::PlasmaWaitRequest);
+  std::vector<ObjectID> object_ids2;
+  int64_t num_ready_objects;
+  int64_t timeout_ms;
+  ASSERT_OK(ReadWaitRequest(data.data(), data.size(), &object_ids2, &num_ready_objects,
+                            &timeout_ms));
+  ASSERT_EQ(object_ids1, object_ids2);
+  ASSERT_EQ(num_ready_objects, 1);
+  ASSERT_EQ(timeout_ms, 100);
+  close(fd);
+}
+
+TEST_F(TestPlasmaSerialization, WaitReply) {
+  int fd = CreateTemporaryFile();
+  std::vector<ObjectID> object_ids1 = {random_object_id(), random_object_id()};
+  ASSERT_OK(SendWaitReply(fd, object_ids1));
+  std::vector<uint8_t> data = read_message_from_file(fd, MessageType::PlasmaWaitReply);
+  std::vector<ObjectID> object_ids2;
+  ASSERT_OK(ReadWaitReply(data.data(), data.size(), &object_ids2));
+  ASSERT_EQ(object_ids1, object_ids2);
+  close(fd);
+}
+
+TEST_F(TestPlasmaSerialization, WaitStreamRequest) {
+  int fd = CreateTemporaryFile();
+  ObjectID object_id1 = random_object_id();
+  ASSERT_OK(SendWaitStreamRequest(fd, object_id1, 42, 100));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaWaitStreamRequest);
+  ObjectID object_id2;
+  int64_t stream_size;
+  int64_t timeout_ms;
+  ASSERT_OK(ReadWaitStreamRequest(data.data(), data.size(), &object_id2, &stream_size,
+                                  &timeout_ms));
+  ASSERT_EQ(object_id1, object_id2);
+  ASSERT_EQ(stream_size, 42);
+  ASSERT_EQ(timeout_ms, 100);
+  close(fd);
+}
+
+TEST_F(TestPlasmaSerialization, WaitStreamReply) {
+  int fd = CreateTemporaryFile();
+  ObjectID object_id1 = random_object_id();
+  ASSERT_OK(SendWaitStreamReply(fd, object_id1, PlasmaError::OK, 43, true));
+  std::vector<uint8_t> data = read_message_from_file(fd, MessageType::PlasmaWaitStreamReply);
+  ObjectID object_id2;
+  int64_t stream_size;
+  bool closed;
+  ASSERT_OK(
+      ReadWaitStreamReply(data.data(), data.size(), &object_id2, &stream_size, &closed));
+  ASSERT_EQ(object_id1, object_id2);
+  ASSERT_EQ(stream_size, 43);
+  ASSERT_TRUE(closed);
+  close(fd);
+}
+
 TEST_F(TestPlasmaSerialization, DataRequest) {
   int fd = CreateTemporaryFile();
   ObjectID object_id1 = random_object_id();
@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <limits.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+#include "plasma/client.h"
+#include "plasma/test_util.h"
+
+namespace plasma {
+
+/// A test that runs against a plasma-store-server of its own, which is built
+/// next to the test executable and started with the flags the test passes.
+class PlasmaStoreFixture : public ::testing::Test {
+ public:
+  /// \param store_flags The flags of the store besides its socket and its
+  ///        memory, e.g. "-u".
+  explicit PlasmaStoreFixture(std::string store_flags)
+      : store_flags_(std::move(store_flags)) {}
+
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(temp_dir_, arrow::internal::TemporaryDir::Make("store-test-"));
+    store_socket_name_ = temp_dir_->path().ToString() + "store";
+
+    char executable[PATH_MAX];
+    ssize_t length = readlink("/proc/self/exe", executable, sizeof(executable) - 1);
+    ASSERT_GT(length, 0);
+    std::string plasma_directory(executable, length);
+    plasma_directory = plasma_directory.substr(0, plasma_directory.find_last_of('/'));
+    std::string plasma_command = plasma_directory + "/plasma-store-server -m 1024000 " +
+                                 store_flags_ + " -s " + store_socket_name_ +
+                                 " 1> /dev/null 2> /dev/null & " + "echo $! > " +
+                                 store_socket_name_ + ".pid";
+    PLASMA_CHECK_SYSTEM(system(plasma_command.c_str()));
+    ARROW_CHECK_OK(client_.Connect(store_socket_name_, ""));
+  }
+
+  void TearDown() override {
+    ARROW_CHECK_OK(client_.Disconnect());
+    std::string plasma_kill_command =
+        "kill -KILL `cat " + store_socket_name_ + ".pid` || exit 0";
+    PLASMA_CHECK_SYSTEM(system(plasma_kill_command.c_str()));
+  }
+
+ protected:
+  std::string store_flags_;
+  PlasmaClient client_;
+  std::unique_ptr<arrow::internal::TemporaryDir> temp_dir_;
+  std::string store_socket_name_;
+};
+
+}  // namespace plasma
@@ -0,0 +1,107 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+
+#include "plasma/test_util.h"
+#include "plasma/trace.h"
+
+namespace plasma {
+
+using arrow::internal::TemporaryDir;
+
+class TestTrace : public ::testing::Test {
+ public:
+  void SetUp() {
+    ASSERT_OK_AND_ASSIGN(temp_dir_, TemporaryDir::Make("trace-test-"));
+    path_ = temp_dir_->path().ToString() + "trace";
+  }
+
+ protected:
+  std::unique_ptr<TemporaryDir> temp_dir_;
+  std::string path_;
+};
+
+TEST_F(TestTrace, RecordsRoundTrip) {
+  ObjectID object_id1 = random_object_id();
+  ObjectID object_id2 = random_object_id();
+  std::unique_ptr<TraceWriter> writer;
+  ASSERT_OK(TraceWriter::Open(path_, &writer));
+  writer->Record(7, TraceOp::Create, object_id1, 1000, 10);
+  writer->Record(7, TraceOp::Seal, object_id1);
+  writer->Record(8, TraceOp::Get, object_id1, -1, 0, 2);
+  writer->Record(8, TraceOp::Get, object_id2, -1, 0, 2);
+  writer->Record(7, TraceOp::Delete, object_id1);
+  ASSERT_EQ(writer->num_records(), 5);
+  writer.reset();
+
+  std::vector<TraceRecord> records;
+  ASSERT_OK(ReadTrace(path_, &records));
+  ASSERT_EQ(records.size(), 5);
+  ASSERT_EQ(records[0].client, 7);
+  ASSERT_EQ(records[0].op, TraceOp::Create);
+  ASSERT_EQ(records[0].object_id, object_id1);
+  ASSERT_EQ(records[0].data_size, 1000);
+  ASSERT_EQ(records[0].metadata_size, 10);
+  ASSERT_EQ(records[0].batch_size, 1);
+  ASSERT_EQ(records[1].op, TraceOp::Seal);
+  ASSERT_EQ(records[3].client, 8);
+  ASSERT_EQ(records[3].op, TraceOp::Get);
+  ASSERT_EQ(records[3].object_id, object_id2);
+  ASSERT_EQ(records[3].data_size, -1);
+  ASSERT_EQ(records[3].batch_size, 2);
+  ASSERT_EQ(records[4].op, TraceOp::Delete);
+  for (size_t i = 1; i < records.size(); i++) {
+    ASSERT_LE(records[i - 1].time_us, records[i].time_us);
+  }
+}
+
+TEST_F(TestTrace, FlushKeepsTheWriterOpen) {
+  std::unique_ptr<TraceWriter> writer;
+  ASSERT_OK(TraceWriter::Open(path_, &writer));
+  writer->Record(3, TraceOp::Release, random_object_id());
+  ASSERT_OK(writer->Flush());
+  std::vector<TraceRecord> records;
+  ASSERT_OK(ReadTrace(path_, &records));
+  ASSERT_EQ(records.size(), 1);
+  writer->Record(3, TraceOp::Abort, random_object_id());
+  writer.reset();
+  ASSERT_OK(ReadTrace(path_, &records));
+  ASSERT_EQ(records.size(), 2);
+  ASSERT_EQ(records[1].op, TraceOp::Abort);
+}
+
+TEST_F(TestTrace, RejectsOtherFiles) {
+  FILE* file = fopen(path_.c_str(), "wb");
+  ASSERT_NE(file, nullptr);
+  fputs("not a trace", file);
+  fclose(file);
+  std::vector<TraceRecord> records;
+  ASSERT_RAISES(Invalid, ReadTrace(path_, &records));
+  ASSERT_RAISES(IOError, ReadTrace(path_ + "-missing", &records));
+}
+
+}  // namespace plasma
@@ -0,0 +1,149 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "plasma/trace.h"
+
+#include <cerrno>
+#include <cstring>
+
+namespace plasma {
+
+namespace {
+
+constexpr char kTraceMagic[8] = {'P', 'L', 'T', 'R', 'A', 'C', 'E', '1'};
+
+/// time_us, client, op, three reserved bytes, batch_size, the object ID,
+/// data_size and metadata_size.
+constexpr size_t kRecordSize = 8 + 4 + 1 + 3 + 4 + kUniqueIDSize + 8 + 8;
+
+/// Records are written out once this many bytes are buffered.
+constexpr size_t kFlushThreshold = 64 * 1024;
+
+template <typename T>
+uint8_t* Put(uint8_t* out, T value) {
+  // Stores only run on little-endian machines, so the bytes are copied as is.
+  std::memcpy(out, &value, sizeof(value));
+  return out + sizeof(value);
+}
+
+template <typename T>
+const uint8_t* Take(const uint8_t* in, T* value) {
+  std::memcpy(value, in, sizeof(*value));
+  return in + sizeof(*value);
+}
+
+}  // namespace
+
+arrow::Status TraceWriter::Open(const std::string& path,
+                                std::unique_ptr<TraceWriter>* out) {
+  FILE* file = fopen(path.c_str(), "wb");
+  if (file == nullptr) {
+    return arrow::Status::IOError("failed to open trace ", path, ": ",
+                                  std::strerror(errno));
+  }
+  if (fwrite(kTraceMagic, 1, sizeof(kTraceMagic), file) != sizeof(kTraceMagic)) {
+    fclose(file);
+    return arrow::Status::IOError("failed to write trace ", path);
+  }
+  out->reset(new TraceWriter(file));
+  return arrow::Status::OK();
+}
+
+TraceWriter::TraceWriter(FILE* file)
+    : file_(file), start_(std::chrono::steady_clock::now()), num_records_(0) {
+  buffer_.reserve(kFlushThreshold + kRecordSize);
+}
+
+TraceWriter::~TraceWriter() {
+  ARROW_UNUSED(Flush());
+  fclose(file_);
+}
+
+void TraceWriter::Record(int32_t client, TraceOp op, const ObjectID& object_id,
+                         int64_t data_size, int64_t metadata_size, int32_t batch_size) {
+  const int64_t time_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                              std::chrono::steady_clock::now() - start_)
+                              .count();
+  const size_t offset = buffer_.size();
+  buffer_.resize(offset + kRecordSize);
+  uint8_t* out = buffer_.data() + offset;
+  out = Put(out, time_us);
+  out = Put(out, client);
+  out = Put(out, static_cast<uint8_t>(op));
+  out = Put(out, static_cast<uint8_t>(0));
+  out = Put(out, static_cast<uint16_t>(0));
+  out = Put(out, batch_size);
+  std::memcpy(out, object_id.data(), kUniqueIDSize);
+  out += kUniqueIDSize;
+  out = Put(out, data_size);
+  Put(out, metadata_size);
+  num_records_ += 1;
+  if (buffer_.size() >= kFlushThreshold) {
+    ARROW_UNUSED(Flush());
+  }
+}
+
+arrow::Status TraceWriter::Flush() {
+  if (buffer_.empty()) {
+    return arrow::Status::OK();
+  }
+  const size_t size = buffer_.size();
+  const size_t written = fwrite(buffer_.data(), 1, size, file_);
+  buffer_.clear();
+  if (written != size || fflush(file_) != 0) {
+    return arrow::Status::IOError("failed to write trace: ", std::strerror(errno));
+  }
+  return arrow::Status::OK();
+}
+
+arrow::Status ReadTrace(const std::string& path, std::vector<TraceRecord>* records) {
+  FILE* file = fopen(path.c_str(), "rb");
+  if (file == nullptr) {
+    return arrow::Status::IOError("failed to open trace ", path, ": ",
+                                  std::strerror(errno));
+  }
+  char magic[sizeof(kTraceMagic)];
+  if (fread(magic, 1, sizeof(magic), file) != sizeof(magic) ||
+      std::memcmp(magic, kTraceMagic, sizeof(magic)) != 0) {
+    fclose(file);
+    return arrow::Status::Invalid(path, " is not a trace");
+  }
+  records->clear();
+  uint8_t bytes[kRecordSize];
+  // A store that was killed may have left part of a record at the end.
+  while (fread(bytes, 1, kRecordSize, file) == kRecordSize) {
+    TraceRecord record;
+    uint8_t op;
+    const uint8_t* in = bytes;
+    in = Take(in, &record.time_us);
+    in = Take(in, &record.client);
+    in = Take(in, &op);
+    in += 3;
+    in = Take(in, &record.batch_size);
+    std::memcpy(record.object_id.mutable_data(), in, kUniqueIDSize);
+    in += kUniqueIDSize;
+    in = Take(in, &record.data_size);
+    Take(in, &record.metadata_size);
+    record.op = static_cast<TraceOp>(op);
+    records->push_back(record);
+  }
+  fclose(file);
+  return arrow::Status::OK();
+}
+
+}  // namespace plasma
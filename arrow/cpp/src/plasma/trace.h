@@ -0,0 +1,99 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+#include "plasma/common.h"
+
+namespace plasma {
+
+/// The requests a trace records.
+enum class TraceOp : uint8_t {
+  Create = 0,
+  Seal = 1,
+  Get = 2,
+  Release = 3,
+  Delete = 4,
+  Abort = 5,
+};
+
+/// A request of a client of the store, or one object of a request about
+/// several objects.
+struct TraceRecord {
+  /// Microseconds since the trace started.
+  int64_t time_us;
+  /// The connection of the client, which identifies the client for as long as
+  /// it is connected.
+  int32_t client;
+  TraceOp op;
+  /// For the objects of a Get or Delete, how many objects the request has.
+  /// Their records follow each other. 1 for the other requests.
+  int32_t batch_size;
+  ObjectID object_id;
+  /// The data size of a Create, or the timeout in milliseconds of a Get.
+  int64_t data_size;
+  /// The metadata size of a Create.
+  int64_t metadata_size;
+};
+
+/// Writes the requests of the clients of a store to a file, in a compact
+/// binary format: a header, then a fixed-size little-endian record per
+/// request, in the order the store handled them.
+class ARROW_EXPORT TraceWriter {
+ public:
+  /// Create or truncate the trace at path. The clock of the trace starts now.
+  static arrow::Status Open(const std::string& path, std::unique_ptr<TraceWriter>* out);
+
+  ~TraceWriter();
+
+  /// Record a request of client. time_us is filled in.
+  void Record(int32_t client, TraceOp op, const ObjectID& object_id,
+              int64_t data_size = 0, int64_t metadata_size = 0, int32_t batch_size = 1);
+
+  /// Write the records that are buffered to the file.
+  arrow::Status Flush();
+
+  int64_t num_records() const { return num_records_; }
+
+ private:
+  explicit TraceWriter(FILE* file);
+
+  FILE* file_;
+  std::chrono::steady_clock::time_point start_;
+  std::vector<uint8_t> buffer_;
+  int64_t num_records_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(TraceWriter);
+};
+
+/// Read all the records of the trace at path, in order.
+ARROW_EXPORT arrow::Status ReadTrace(const std::string& path,
+                                     std::vector<TraceRecord>* records);
+
+}  // namespace plasma
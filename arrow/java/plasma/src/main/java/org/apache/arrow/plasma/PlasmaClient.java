@@ -33,6 +33,8 @@ import org.apache.arrow.plasma.exceptions.PlasmaOutOfMemoryException;
  */
 public class PlasmaClient implements ObjectStoreLink {
 
+  private static final int OBJECT_ID_SIZE = 20;
+
   private final long conn;
 
   protected void finalize() {
@@ -44,6 +46,18 @@ public class PlasmaClient implements ObjectStoreLink {
     this.conn = PlasmaClientJNI.connect(storeSocketName, managerSocketName, releaseDelay);
   }
 
+  /**
+   * Connect to a plasma store and map the region of its remote store, so that objects in
+   * the remote region can be read and created through the returned ByteBuffers.
+   *
+   * @param remoteMemoryFile the file backing the region of the remote store.
+   */
+  public PlasmaClient(String storeSocketName, String managerSocketName, int releaseDelay,
+      String remoteMemoryFile) {
+    this.conn = PlasmaClientJNI.connectWithRemoteMemory(storeSocketName, managerSocketName,
+        releaseDelay, remoteMemoryFile);
+  }
+
   // interface methods --------------------
 
   @Override
@@ -143,6 +157,64 @@ public class PlasmaClient implements ObjectStoreLink {
     return PlasmaClientJNI.create(conn, objectId, size, metadata);
   }
 
+  /**
+   * Create several objects in Plasma Store with one call, which sends all of the requests
+   * before waiting for the replies. Either all of the objects are created or none is.
+   *
+   * @param objectIds used to identify the objects.
+   * @param sizes size in bytes to be allocated for each object.
+   * @param metadata the metadata of each object. It, or any of its elements, may be null.
+   * @return an off-heap ByteBuffer over the data of each object.
+   */
+  public ByteBuffer[] createBatch(byte[][] objectIds, int[] sizes, byte[][] metadata)
+        throws DuplicateObjectException, PlasmaOutOfMemoryException {
+    return PlasmaClientJNI.createBatch(conn, packObjectIds(objectIds), sizes, metadata);
+  }
+
+  /**
+   * Seal several objects with one call, see {@link #seal(byte[])}.
+   *
+   * @param objectIds used to identify the objects.
+   */
+  public void sealBatch(byte[][] objectIds) {
+    PlasmaClientJNI.sealBatch(conn, packObjectIds(objectIds));
+  }
+
+  /**
+   * Release several objects with one call, see {@link #release(byte[])}.
+   *
+   * @param objectIds used to identify the objects.
+   */
+  public void releaseBatch(byte[][] objectIds) {
+    PlasmaClientJNI.releaseBatch(conn, packObjectIds(objectIds));
+  }
+
+  /**
+   * Get several objects with one call. Unlike {@link #get(byte[][], int)}, the data is not
+   * copied: the ByteBuffers are over the memory the objects are in, which may be the remote
+   * region, and are valid until the objects are released.
+   *
+   * @param objectIds used to identify the objects.
+   * @param timeoutMs time in milliseconds to wait before this request time out.
+   * @return the data and metadata of each object, null for objects that were not found.
+   */
+  public ByteBuffer[][] getBatch(byte[][] objectIds, int timeoutMs) {
+    ByteBuffer[] bufs = PlasmaClientJNI.getBatch(conn, packObjectIds(objectIds), timeoutMs);
+    ByteBuffer[][] ret = new ByteBuffer[objectIds.length][];
+    for (int i = 0; i < objectIds.length; i++) {
+      ret[i] = new ByteBuffer[]{bufs[2 * i], bufs[2 * i + 1]};
+    }
+    return ret;
+  }
+
+  private static byte[] packObjectIds(byte[][] objectIds) {
+    byte[] packed = new byte[objectIds.length * OBJECT_ID_SIZE];
+    for (int i = 0; i < objectIds.length; i++) {
+      System.arraycopy(objectIds[i], 0, packed, i * OBJECT_ID_SIZE, OBJECT_ID_SIZE);
+    }
+    return packed;
+  }
+
   /**
    * Seal the buffer in the PlasmaStore for a particular object ID.
    * Once a buffer has been sealed, the buffer is immutable and can only be accessed through get.
@@ -29,18 +29,32 @@ public class PlasmaClientJNI {
 
   public static native long connect(String storeSocketName, String managerSocketName, int releaseDelay);
 
+  public static native long connectWithRemoteMemory(String storeSocketName, String managerSocketName,
+      int releaseDelay, String remoteMemoryFile);
+
   public static native void disconnect(long conn);
 
   public static native ByteBuffer create(long conn, byte[] objectId, int size, byte[] metadata)
           throws DuplicateObjectException, PlasmaOutOfMemoryException;
 
+  // The batched calls take the IDs of their objects packed one after the other.
+
+  public static native ByteBuffer[] createBatch(long conn, byte[] objectIds, int[] sizes, byte[][] metadata)
+          throws DuplicateObjectException, PlasmaOutOfMemoryException;
+
   public static native byte[] hash(long conn, byte[] objectId);
 
   public static native void seal(long conn, byte[] objectId);
 
+  public static native void sealBatch(long conn, byte[] objectIds);
+
   public static native void release(long conn, byte[] objectId);
 
+  public static native void releaseBatch(long conn, byte[] objectIds);
+
   public static native ByteBuffer[][] get(long conn, byte[][] objectIds, int timeoutMs);
+
+  public static native ByteBuffer[] getBatch(long conn, byte[] objectIds, int timeoutMs);
   
   public static native void delete(long conn, byte[] objectId);
 
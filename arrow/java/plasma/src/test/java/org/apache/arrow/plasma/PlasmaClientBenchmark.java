@@ -0,0 +1,143 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package org.apache.arrow.plasma;
+
+import java.nio.ByteBuffer;
+import java.util.Arrays;
+
+/**
+ * Compares the per-object JNI calls of PlasmaClient with the batched ones, on a store that is
+ * already running. Like a JMH benchmark, each path runs a few warmup iterations before the
+ * measured ones, and the time per object is reported.
+ *
+ * <p>Usage: PlasmaClientBenchmark &lt;store socket&gt; &lt;objects&gt; &lt;object size&gt;
+ * [remote memory file]
+ */
+public class PlasmaClientBenchmark {
+
+  private static final int WARMUP_ITERATIONS = 5;
+
+  private static final int MEASURED_ITERATIONS = 20;
+
+  private final PlasmaClient client;
+
+  private final byte[][] ids;
+
+  private final int size;
+
+  PlasmaClientBenchmark(PlasmaClient client, int numObjects, int size) {
+    this.client = client;
+    this.size = size;
+    ids = new byte[numObjects][20];
+    for (int i = 0; i < numObjects; i++) {
+      Arrays.fill(ids[i], (byte) 0x5a);
+      ids[i][0] = (byte) i;
+      ids[i][1] = (byte) (i >> 8);
+      ids[i][2] = (byte) (i >> 16);
+    }
+  }
+
+  private void putOneByOne() {
+    for (byte[] id : ids) {
+      ByteBuffer buf = client.create(id, size, null);
+      buf.put(0, (byte) 1);
+      client.seal(id);
+      client.release(id);
+    }
+  }
+
+  private void putBatched() {
+    int[] sizes = new int[ids.length];
+    Arrays.fill(sizes, size);
+    ByteBuffer[] bufs = client.createBatch(ids, sizes, null);
+    for (ByteBuffer buf : bufs) {
+      buf.put(0, (byte) 1);
+    }
+    client.sealBatch(ids);
+    client.releaseBatch(ids);
+  }
+
+  private long getOneByOne() {
+    long sum = 0;
+    for (byte[] id : ids) {
+      sum += client.getObjAsByteBuffer(id, -1, false).get(0);
+      client.release(id);
+    }
+    return sum;
+  }
+
+  private long getBatched() {
+    long sum = 0;
+    for (ByteBuffer[] object : client.getBatch(ids, -1)) {
+      sum += object[0].get(0);
+    }
+    client.releaseBatch(ids);
+    return sum;
+  }
+
+  private void deleteAll() {
+    for (byte[] id : ids) {
+      client.delete(id);
+    }
+  }
+
+  /** Returns the mean nanoseconds per object of the measured iterations. */
+  private double measure(Runnable put, Runnable get, boolean measurePut) {
+    long total = 0;
+    for (int i = 0; i < WARMUP_ITERATIONS + MEASURED_ITERATIONS; i++) {
+      long start = System.nanoTime();
+      put.run();
+      long afterPut = System.nanoTime();
+      get.run();
+      long afterGet = System.nanoTime();
+      deleteAll();
+      if (i >= WARMUP_ITERATIONS) {
+        total += measurePut ? afterPut - start : afterGet - afterPut;
+      }
+    }
+    return (double) total / MEASURED_ITERATIONS / ids.length;
+  }
+
+  public static void main(String[] args) {
+    if (args.length < 3) {
+      System.err.println("usage: PlasmaClientBenchmark <store socket> <objects> <object size> "
+          + "[remote memory file]");
+      System.exit(1);
+    }
+    System.loadLibrary("plasma_java");
+    PlasmaClient client = args.length > 3
+        ? new PlasmaClient(args[0], "", 0, args[3])
+        : new PlasmaClient(args[0], "", 0);
+    PlasmaClientBenchmark benchmark =
+        new PlasmaClientBenchmark(client, Integer.parseInt(args[1]), Integer.parseInt(args[2]));
+
+    Runnable putOneByOne = benchmark::putOneByOne;
+    Runnable getOneByOne = benchmark::getOneByOne;
+    Runnable putBatched = benchmark::putBatched;
+    Runnable getBatched = benchmark::getBatched;
+    System.out.println("Benchmark, ns/object");
+    System.out.printf("create+seal+release, one by one, %.1f%n",
+        benchmark.measure(putOneByOne, getOneByOne, true));
+    System.out.printf("create+seal+release, batched, %.1f%n",
+        benchmark.measure(putBatched, getBatched, true));
+    System.out.printf("get+release, one by one, %.1f%n",
+        benchmark.measure(putOneByOne, getOneByOne, false));
+    System.out.printf("get+release, batched, %.1f%n",
+        benchmark.measure(putBatched, getBatched, false));
+  }
+}
@@ -278,6 +278,47 @@ public class PlasmaClientTest {
     client.release(id);
   }
 
+  public void doBatchTest() {
+    System.out.println("Start batch test.");
+    PlasmaClient client = (PlasmaClient) pLink;
+    byte[][] ids = new byte[3][];
+    for (int i = 0; i < ids.length; i++) {
+      ids[i] = getArrayFilledWithValue(20, (byte) (20 + i));
+    }
+    byte[][] metadata = new byte[][]{null, getArrayFilledWithValue(4, (byte) 7), null};
+    ByteBuffer[] bufs = client.createBatch(ids, new int[]{10, 20, 30}, metadata);
+    assert bufs.length == 3;
+    for (int i = 0; i < bufs.length; i++) {
+      assert bufs[i].isDirect();
+      assert bufs[i].limit() == 10 * (i + 1);
+      bufs[i].put(0, (byte) i);
+    }
+    client.sealBatch(ids);
+    client.releaseBatch(ids);
+
+    // Creating an object that exists fails without creating the others.
+    byte[] otherId = getArrayFilledWithValue(20, (byte) 30);
+    try {
+      client.createBatch(new byte[][]{otherId, ids[0]}, new int[]{10, 10}, null);
+      Assert.fail("Created an object that exists.");
+    } catch (DuplicateObjectException e) {
+      assert !client.contains(otherId);
+    }
+
+    byte[][] getIds = new byte[][]{ids[0], ids[1], ids[2], otherId};
+    ByteBuffer[][] objects = client.getBatch(getIds, 0);
+    assert objects.length == 4;
+    for (int i = 0; i < 3; i++) {
+      assert objects[i][0].limit() == 10 * (i + 1);
+      assert objects[i][0].get(0) == (byte) i;
+    }
+    assert objects[1][1].limit() == 4;
+    assert objects[0][1] == null;
+    assert objects[3][0] == null && objects[3][1] == null;
+    client.releaseBatch(ids);
+    System.out.println("Plasma java client batch test success.");
+  }
+
   public void doPlasmaOutOfMemoryExceptionTest() {
     System.out.println("Start PlasmaOutOfMemoryException test.");
     PlasmaClient client = (PlasmaClient) pLink;
@@ -307,6 +348,7 @@ public class PlasmaClientTest {
     PlasmaClientTest plasmaClientTest = new PlasmaClientTest();
     plasmaClientTest.doPlasmaOutOfMemoryExceptionTest();
     plasmaClientTest.doByteBufferTest();
+    plasmaClientTest.doBatchTest();
     plasmaClientTest.doTest();
   }
 
@@ -70,3 +70,34 @@ class SimplePlasmaLatency(object):
         for i in range(1000):
             x = self.plasma_client.put(1)
             self.plasma_client.get(x)
+
+
+class PlasmaZeroCopyRead(object):
+    """Benchmark reading objects through views against copying them."""
+
+    params = [1000, 100000, 10000000]
+
+    timer = timeit.default_timer
+
+    def setup(self, size):
+        self.plasma_store_ctx = plasma.start_plasma_store(
+            plasma_store_memory=10**9)
+        plasma_store_name, p = self.plasma_store_ctx.__enter__()
+        self.plasma_client = plasma.connect(plasma_store_name)
+
+        self.object_ids = [plasma.ObjectID.from_random() for i in range(10)]
+        for object_id in self.object_ids:
+            buf = self.plasma_client.create(object_id, size)
+            np.frombuffer(buf, dtype=np.uint8)[:] = 1
+            self.plasma_client.seal(object_id)
+
+    def teardown(self, size):
+        self.plasma_store_ctx.__exit__(None, None, None)
+
+    def time_plasma_get_ndarrays(self, size):
+        for array in self.plasma_client.get_ndarrays(self.object_ids):
+            array.sum()
+
+    def time_plasma_get_copy(self, size):
+        for buf in self.plasma_client.get_buffers(self.object_ids):
+            np.frombuffer(buf.to_pybytes(), dtype=np.uint8).sum()
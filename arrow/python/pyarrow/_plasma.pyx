@@ -135,6 +135,10 @@ cdef extern from "plasma/client.h" nogil:
 
         CStatus Disconnect()
 
+        CStatus MmapRemoteMemory(const c_string& file)
+
+        CStatus Prefetch(const c_vector[CUniqueID] object_ids)
+
         CStatus Delete(const c_vector[CUniqueID] object_ids)
 
         CStatus SetClientOptions(const c_string& client_name,
@@ -446,6 +450,88 @@ cdef class PlasmaClient(_Weakrefable):
                 result.append((metadata, data))
         return result
 
+    def get_record_batches(self, object_ids, timeout_ms=-1):
+        """
+        Returns the record batches of objects that hold an Arrow IPC stream,
+        without copying them.
+
+        The batches point into the memory of the objects, which is the region
+        of the remote store for remote objects, and keep the objects from
+        being released until they are garbage collected.
+
+        Parameters
+        ----------
+        object_ids : list
+            A list of ObjectIDs used to identify some objects.
+        timeout_ms : int
+            The number of milliseconds that the get call should block before
+            timing out and returning. Pass -1 if the call should block and 0
+            if the call should return immediately.
+
+        Returns
+        -------
+        list
+            For each object, the list of its RecordBatches, or None if the
+            object was not available.
+        """
+        result = []
+        for buf in self.get_buffers(object_ids, timeout_ms):
+            if buf is None:
+                result.append(None)
+            else:
+                result.append(list(pyarrow.ipc.open_stream(buf)))
+        return result
+
+    def get_ndarrays(self, object_ids, dtype="uint8", timeout_ms=-1):
+        """
+        Returns read-only NumPy views of the data of objects, without copying
+        it.
+
+        Like the buffers they are made from, the views keep the objects from
+        being released until they are garbage collected.
+
+        Parameters
+        ----------
+        object_ids : list
+            A list of ObjectIDs used to identify some objects.
+        dtype : numpy.dtype or str
+            The type of the elements of the data.
+        timeout_ms : int
+            The number of milliseconds that the get call should block before
+            timing out and returning. Pass -1 if the call should block and 0
+            if the call should return immediately.
+
+        Returns
+        -------
+        list
+            For each object, a one-dimensional array over its data, or None if
+            the object was not available.
+        """
+        import numpy as np
+        return [None if buf is None else np.frombuffer(buf, dtype=dtype)
+                for buf in self.get_buffers(object_ids, timeout_ms)]
+
+    def prefetch(self, object_ids):
+        """
+        Start bringing the pages of objects in the remote region into memory,
+        so that reading them after a later get does not stall on every page.
+        This returns right away. Objects that are not in the remote region are
+        left alone.
+
+        Parameters
+        ----------
+        object_ids : list
+            A list of ObjectIDs of the objects that will be read soon.
+        """
+        cdef:
+            c_vector[CUniqueID] ids
+            ObjectID object_id
+
+        for object_id in object_ids:
+            ids.push_back(object_id.data)
+        with nogil:
+            plasma_check_status(self.client.get().Prefetch(ids))
+
     def get_metadata(self, object_ids, timeout_ms=-1):
         """
         Returns metadata buffer from the PlasmaStore based on object ID.
@@ -845,7 +931,7 @@ cdef class PlasmaClient(_Weakrefable):
         return self.client.get().store_capacity()
 
 
-def connect(store_socket_name, int num_retries=-1):
+def connect(store_socket_name, int num_retries=-1, remote_memory_file=None):
     """
     Return a new PlasmaClient that is connected a plasma store and
     optionally a manager.
@@ -857,10 +943,22 @@ def connect(store_socket_name, int num_retries=-1):
     num_retries : int, default -1
         Number of times to try to connect to plasma store. Default value of -1
         uses the default (50)
+    remote_memory_file : str, default None
+        The file backing the region of the remote store. If it is given, the
+        region is mapped, so that objects in it are returned by the get calls
+        without copying them, and the store may create objects there.
     """
     cdef PlasmaClient result = PlasmaClient()
     cdef int deprecated_release_delay = 0
+    cdef c_string remote_memory
     result.store_socket_name = store_socket_name.encode()
+    if remote_memory_file is not None:
+        # The region is mapped before connecting, so that the store knows the
+        # client can write there.
+        remote_memory = remote_memory_file.encode()
+        with nogil:
+            plasma_check_status(
+                result.client.get().MmapRemoteMemory(remote_memory))
     with nogil:
         plasma_check_status(
             result.client.get().Connect(result.store_socket_name, b"",
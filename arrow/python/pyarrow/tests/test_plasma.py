@@ -294,6 +294,50 @@ class TestPlasmaClient:
 
         assert read_batch.equals(batch)
 
+    def test_get_record_batches(self):
+        arr = pa.array([1, 12, 23, 3, 34], pa.int32())
+        batch = pa.RecordBatch.from_arrays([arr], ['field1'])
+        sink = pa.BufferOutputStream()
+        writer = pa.RecordBatchStreamWriter(sink, batch.schema)
+        writer.write_batch(batch)
+        writer.write_batch(batch)
+        writer.close()
+        stream = sink.getvalue()
+
+        object_id = random_object_id()
+        buf = self.plasma_client.create(object_id, stream.size)
+        pa.FixedSizeBufferWriter(buf).write(stream)
+        self.plasma_client.seal(object_id)
+        del buf
+
+        missing_id = random_object_id()
+        [batches, missing] = self.plasma_client2.get_record_batches(
+            [object_id, missing_id], timeout_ms=0)
+        assert missing is None
+        assert len(batches) == 2
+        # The batches keep the object alive after the buffer it was read
+        # through is gone.
+        assert batches[1].equals(batch)
+
+    def test_get_ndarrays(self):
+        data = np.arange(100, dtype=np.int64)
+        object_id = random_object_id()
+        buf = self.plasma_client.create(object_id, data.nbytes)
+        np.frombuffer(buf, dtype=np.int64)[:] = data
+        self.plasma_client.seal(object_id)
+        del buf
+
+        [array] = self.plasma_client2.get_ndarrays([object_id],
+                                                   dtype=np.int64)
+        np.testing.assert_equal(array, data)
+        assert not array.flags.writeable
+
+    def test_connect_with_missing_remote_memory(self):
+        import pyarrow.plasma as plasma
+        with pytest.raises(IOError):
+            plasma.connect(self.plasma_store_name, num_retries=1,
+                           remote_memory_file="/nonexistent/remote-memory")
+
     def test_put_and_get(self):
         for value in [["hello", "world", 3, 1.0], None, "hello"]:
             object_id = self.plasma_client.put(value)
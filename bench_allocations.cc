@@ -0,0 +1,105 @@
+#include <plasma/client.h>
+
+#include <arrow/util/logging.h>
+
+#include <atomic>
+#include <bitset>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+using namespace plasma;
+
+// Counts the heap allocations per operation, in the client (counted here) and
+// in the store (read from the "(store) heap allocations" line of the debug
+// string). The store counts them only when built with
+// -DARROW_PLASMA_COUNT_ALLOCATIONS=ON; against any other store the store column
+// reads -1.
+
+static std::atomic<int64_t> client_allocations(0);
+
+void* operator new(std::size_t size) {
+  client_allocations.fetch_add(1, std::memory_order_relaxed);
+  void* pointer = std::malloc(size == 0 ? 1 : size);
+  if (pointer == nullptr) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+void* operator new[](std::size_t size) { return operator new(size); }
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+
+int64_t StoreAllocations(PlasmaClient& client) {
+  const std::string key = "(store) heap allocations: ";
+  std::string debug_string = client.DebugString();
+  size_t pos = debug_string.find(key);
+  if (pos == std::string::npos) {
+    return -1;
+  }
+  return strtoll(debug_string.c_str() + pos + key.size(), nullptr, 10);
+}
+
+// Runs op(i) for i in [0, n) and prints the allocations per call.
+template <typename Op>
+void Measure(PlasmaClient& client, const char* name, size_t n, Op op) {
+  int64_t store_before = StoreAllocations(client);
+  int64_t client_before = client_allocations.load();
+  for (size_t i = 0; i < n; i++) {
+    op(i);
+  }
+  int64_t client_after = client_allocations.load();
+  int64_t store_after = StoreAllocations(client);
+  // The debug string request itself allocates a little in the store, which
+  // the number of operations makes negligible.
+  printf("%s, %.2f, %.2f\n", name,
+         store_before < 0 ? -1.0 : static_cast<double>(store_after - store_before) / n,
+         static_cast<double>(client_after - client_before) / n);
+}
+
+int main(int argc, char** argv) {
+  if (argc != 4) {
+    fprintf(stderr, "usage: %s <socket> <remote memory file> <operations>\n", argv[0]);
+    return 1;
+  }
+  std::string plasma_socket = argv[1];
+  std::string remote_memory_file = argv[2];
+  size_t n = strtol(argv[3], nullptr, 0);
+
+  PlasmaClient client;
+  ARROW_CHECK_OK(client.MmapRemoteMemory(remote_memory_file));
+  ARROW_CHECK_OK(client.Connect(plasma_socket));
+
+  std::vector<ObjectID> object_ids(n);
+  for (size_t i = 0; i < n; i++) {
+    object_ids[i] = ObjectID::from_binary(std::bitset<20>(i).to_string());
+  }
+
+  printf("operation, store allocations per op, client allocations per op\n");
+  std::shared_ptr<Buffer> data;
+  Measure(client, "create", n, [&](size_t i) {
+    ARROW_CHECK_OK(client.Create(object_ids[i], 64, nullptr, 0, &data));
+  });
+  Measure(client, "seal", n,
+          [&](size_t i) { ARROW_CHECK_OK(client.Seal(object_ids[i])); });
+  Measure(client, "release", n,
+          [&](size_t i) { ARROW_CHECK_OK(client.Release(object_ids[i])); });
+  ObjectBuffer buffer;
+  Measure(client, "get", n, [&](size_t i) {
+    ARROW_CHECK_OK(client.Get(&object_ids[i], 1, 0, &buffer));
+  });
+  Measure(client, "release after get", n,
+          [&](size_t i) { ARROW_CHECK_OK(client.Release(object_ids[i])); });
+  Measure(client, "contains", n, [&](size_t i) {
+    bool has_object;
+    ARROW_CHECK_OK(client.Contains(object_ids[i], &has_object));
+  });
+  Measure(client, "delete", n,
+          [&](size_t i) { ARROW_CHECK_OK(client.Delete(object_ids[i])); });
+
+  ARROW_CHECK_OK(client.Disconnect());
+}
@@ -0,0 +1,96 @@
+#include <plasma/client.h>
+
+#include <arrow/util/logging.h>
+
+#include <unistd.h>
+#include <bitset>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace plasma;
+
+using namespace std::chrono;
+
+ObjectID* object_ids;
+
+void CreateObjects(PlasmaClient& client, size_t n, size_t size) {
+  std::string metadata = "";
+  for (size_t i = 0; i < n; i++) {
+    std::shared_ptr<Buffer> data;
+    ARROW_CHECK_OK(client.Create(object_ids[i], size,
+          (uint8_t*) metadata.data(), metadata.size(), &data, 0, true));
+    memset(data->mutable_data(), static_cast<int>(i), size);
+    ARROW_CHECK_OK(client.Seal(object_ids[i]));
+    ARROW_CHECK_OK(client.Release(object_ids[i]));
+  }
+}
+
+// Every thread gets and releases ops objects, one at a time, starting at a
+// different object. Returns the total number of Get/Release pairs per second.
+double RunThreads(PlasmaClient& client, int num_threads, size_t n, size_t ops) {
+  std::vector<std::thread> threads;
+  auto t1 = steady_clock::now();
+  for (int t = 0; t < num_threads; t++) {
+    threads.emplace_back([&client, t, n, ops]() {
+      uint64_t sum = 0;
+      for (size_t i = 0; i < ops; i++) {
+        ObjectBuffer buffer;
+        const ObjectID& id = object_ids[(t * 7919 + i) % n];
+        ARROW_CHECK_OK(client.Get(&id, 1, -1, &buffer));
+        sum += buffer.data->data()[0];
+        ARROW_CHECK_OK(client.Release(id));
+      }
+      ARROW_CHECK(sum != 1);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  auto t2 = steady_clock::now();
+  return num_threads * ops / duration_cast<duration<double>>(t2 - t1).count();
+}
+
+int main(int argc, char** argv) {
+  if (argc != 7) {
+    printf("usage: %s <socket> <remote memory file> <objects> <object size> "
+           "<ops per thread> <connections>\n", argv[0]);
+    return 1;
+  }
+  std::string plasma_socket = argv[1];
+  std::string remote_memory_file = argv[2];
+  size_t n = strtol(argv[3], nullptr, 0);
+  size_t size = strtol(argv[4], nullptr, 0);
+  size_t ops = strtol(argv[5], nullptr, 0);
+  int num_connections = strtol(argv[6], nullptr, 0);
+
+  PlasmaClient client;
+  ARROW_CHECK_OK(client.MmapRemoteMemory(remote_memory_file));
+  ARROW_CHECK_OK(client.Connect(plasma_socket, "", 0, -1, num_connections));
+
+  object_ids = new ObjectID[n];
+  for (size_t i = 0; i < n; i++) {
+    std::string id = std::bitset<20>(i).to_string();
+    object_ids[i] = ObjectID::from_binary(id);
+  }
+  CreateObjects(client, n, size);
+
+  // Cold: nobody holds the objects, so every Get and the last Release go to
+  // the store.
+  printf("threads, cold ops/s, held ops/s\n");
+  std::vector<ObjectBuffer> held(n);
+  for (int num_threads = 1; num_threads <= 64; num_threads *= 2) {
+    double cold = RunThreads(client, num_threads, n, ops);
+    // Held: the main thread keeps a reference to every object, so Get and
+    // Release are served by the client without talking to the store.
+    ARROW_CHECK_OK(client.Get(object_ids, n, -1, held.data()));
+    double hot = RunThreads(client, num_threads, n, ops);
+    for (size_t i = 0; i < n; i++) {
+      ARROW_CHECK_OK(client.Release(object_ids[i]));
+    }
+    printf("%d, %.0f, %.0f\n", num_threads, cold, hot);
+  }
+
+  ARROW_CHECK_OK(client.Delete(std::vector<ObjectID>(object_ids, object_ids + n)));
+  ARROW_CHECK_OK(client.Disconnect());
+}
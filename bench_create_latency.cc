@@ -0,0 +1,74 @@
+#include <plasma/client.h>
+
+#include <arrow/util/logging.h>
+
+#include <algorithm>
+#include <bitset>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace plasma;
+
+using namespace std::chrono;
+
+// Measures the latency of creates in a store that is full, so that objects
+// have to be evicted for them. Run it against a store started with -H, which
+// evicts in the background, and against one without it, which evicts inside
+// the creates.
+
+int main(int argc, char** argv) {
+  if (argc != 6) {
+    printf("usage: %s <socket> <remote memory file> <objects> <object size> "
+           "<microseconds between creates>\n", argv[0]);
+    return 1;
+  }
+  std::string plasma_socket = argv[1];
+  std::string remote_memory_file = argv[2];
+  size_t n = strtol(argv[3], nullptr, 0);
+  int64_t object_size = strtol(argv[4], nullptr, 0);
+  int64_t pause_us = strtol(argv[5], nullptr, 0);
+
+  PlasmaClient client;
+  ARROW_CHECK_OK(client.MmapRemoteMemory(remote_memory_file));
+  ARROW_CHECK_OK(client.Connect(plasma_socket));
+
+  std::vector<uint8_t> data(object_size, 0xab);
+  std::vector<double> latencies(n);
+  for (size_t i = 0; i < n; i++) {
+    ObjectID object_id = ObjectID::from_binary(std::bitset<20>((1 << 19) + i).to_string());
+    auto t1 = steady_clock::now();
+    std::shared_ptr<Buffer> buffer;
+    ARROW_CHECK_OK(client.Create(object_id, object_size, nullptr, 0, &buffer));
+    auto t2 = steady_clock::now();
+    latencies[i] = duration_cast<duration<double, std::micro>>(t2 - t1).count();
+    std::memcpy(buffer->mutable_data(), data.data(), object_size);
+    ARROW_CHECK_OK(client.Seal(object_id));
+    ARROW_CHECK_OK(client.Release(object_id));
+    // Leave the store time between creates, like an application that does
+    // some work on each object.
+    std::this_thread::sleep_for(microseconds(pause_us));
+  }
+
+  std::sort(latencies.begin(), latencies.end());
+  auto percentile = [&latencies](double p) {
+    return latencies[std::min(latencies.size() - 1,
+                              static_cast<size_t>(p * latencies.size()))];
+  };
+  printf("p50 us, p99 us, p99.9 us, max us\n");
+  printf("%.1f, %.1f, %.1f, %.1f\n", percentile(0.5), percentile(0.99),
+         percentile(0.999), latencies.back());
+
+  std::istringstream lines(client.DebugString());
+  std::string line;
+  while (std::getline(lines, line)) {
+    if (line.compare(0, 12, "(watermarks)") == 0) {
+      printf("%s\n", line.c_str());
+    }
+  }
+
+  ARROW_CHECK_OK(client.Disconnect());
+}
@@ -0,0 +1,92 @@
+#include <plasma/client.h>
+
+#include <arrow/util/logging.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bitset>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace plasma;
+
+using namespace std::chrono;
+
+// Measures listing a store with many objects, in pages of a given size (0 for
+// a single reply), with and without a filter that matches one object in ten.
+// While the listing runs, another client keeps asking the store whether an
+// object exists, and the slowest of its answers shows how long the listing
+// blocked the store.
+
+int main(int argc, char** argv) {
+  if (argc != 5) {
+    printf("usage: %s <socket> <remote memory file> <objects> <page size>\n", argv[0]);
+    return 1;
+  }
+  std::string plasma_socket = argv[1];
+  std::string remote_memory_file = argv[2];
+  size_t n = strtol(argv[3], nullptr, 0);
+  int64_t page_size = strtol(argv[4], nullptr, 0);
+
+  PlasmaClient writer;
+  ARROW_CHECK_OK(writer.MmapRemoteMemory(remote_memory_file));
+  ARROW_CHECK_OK(writer.Connect(plasma_socket));
+  PlasmaClient prober;
+  ARROW_CHECK_OK(prober.Connect(plasma_socket));
+
+  std::vector<ObjectID> object_ids(n);
+  for (size_t i = 0; i < n; i++) {
+    object_ids[i] = ObjectID::from_binary(std::bitset<20>(i).to_string());
+    // One object in ten is large enough for the filter.
+    std::string data(i % 10 == 0 ? 1024 : 64, 'x');
+    ARROW_CHECK_OK(writer.CreateAndSeal(object_ids[i], data, ""));
+  }
+
+  printf("filter, objects listed, pages, total ms, slowest probe us\n");
+  for (int filtered = 0; filtered < 2; filtered++) {
+    ObjectListFilter filter;
+    if (filtered) {
+      filter.min_size = 1024;
+    }
+    std::atomic<bool> done(false);
+    double slowest = 0;
+    std::thread probe([&]() {
+      bool has_object;
+      while (!done) {
+        auto start = steady_clock::now();
+        ARROW_CHECK_OK(prober.Contains(object_ids[0], &has_object));
+        slowest = std::max(
+            slowest,
+            duration_cast<duration<double, std::micro>>(steady_clock::now() - start).count());
+      }
+    });
+    auto start = steady_clock::now();
+    ObjectTable objects;
+    uint64_t cursor = 0;
+    int num_pages = 0;
+    do {
+      ARROW_CHECK_OK(writer.List(filter, page_size, &cursor, &objects));
+      num_pages += 1;
+    } while (cursor != 0);
+    double millis = duration_cast<duration<double, std::milli>>(steady_clock::now() - start).count();
+    done = true;
+    probe.join();
+    printf("%s, %zu, %d, %.1f, %.1f\n", filtered ? "min size" : "none", objects.size(),
+           num_pages, millis, slowest);
+  }
+
+  std::istringstream lines(writer.DebugString());
+  std::string line;
+  while (std::getline(lines, line)) {
+    if (line.compare(0, 6, "(list)") == 0) {
+      printf("%s\n", line.c_str());
+    }
+  }
+
+  ARROW_CHECK_OK(writer.Delete(object_ids));
+  ARROW_CHECK_OK(writer.Disconnect());
+  ARROW_CHECK_OK(prober.Disconnect());
+}
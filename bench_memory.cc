@@ -0,0 +1,206 @@
+#include <arrow/util/logging.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono;
+
+// Measures the memory behind a mapping, independent of the store: sequential
+// and random bandwidth, pointer-chasing latency and how they scale with
+// threads, for the file (the -v region, the peer's region or any file in
+// /dev/shm) and for anonymous local memory, each with small and huge pages.
+//
+// The benchmark overwrites the file, so it must not be run on a region that a
+// store is using.
+
+constexpr size_t kCacheLine = 64;
+constexpr size_t kRandomOpsPerThread = 1 << 22;
+
+struct Mapping {
+  std::string name;
+  uint8_t* data;
+  size_t size;
+};
+
+Mapping MapFile(const std::string& path, size_t size) {
+  int fd = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+  ARROW_CHECK(fd >= 0) << "failed to open " << path;
+  struct stat st;
+  ARROW_CHECK(fstat(fd, &st) == 0);
+  // Regular files, like those in /dev/shm, grow to the size. Devices such as
+  // ivshmem have the size they have.
+  if (S_ISREG(st.st_mode) && st.st_size < static_cast<off_t>(size)) {
+    ARROW_CHECK(ftruncate(fd, size) == 0) << "failed to grow " << path;
+  }
+  void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ARROW_CHECK(data != MAP_FAILED) << "failed to map " << size << " bytes of " << path;
+  close(fd);
+  return {path, static_cast<uint8_t*>(data), size};
+}
+
+Mapping MapAnonymous(size_t size) {
+  void* data =
+      mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  ARROW_CHECK(data != MAP_FAILED) << "failed to map " << size << " anonymous bytes";
+  return {"anonymous", static_cast<uint8_t*>(data), size};
+}
+
+// Returns false if the kernel does not support the page size for the mapping,
+// e.g. huge pages on a file system without transparent huge pages.
+bool SetHugePages(const Mapping& mapping, bool huge) {
+  return madvise(mapping.data, mapping.size, huge ? MADV_HUGEPAGE : MADV_NOHUGEPAGE) ==
+         0;
+}
+
+// Starts num_threads threads running fn(thread) at the same time. Returns the
+// seconds until the last one finished.
+template <typename Fn>
+double RunThreads(int num_threads, Fn fn) {
+  std::atomic<int> ready(0);
+  std::atomic<bool> start(false);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; t++) {
+    threads.emplace_back([&, t]() {
+      ready++;
+      while (!start.load(std::memory_order_acquire)) {
+      }
+      fn(t);
+    });
+  }
+  while (ready.load() < num_threads) {
+  }
+  auto t1 = steady_clock::now();
+  start.store(true, std::memory_order_release);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  auto t2 = steady_clock::now();
+  return duration_cast<nanoseconds>(t2 - t1).count() / 1e9;
+}
+
+uint64_t NextRandom(uint64_t* state) {
+  *state ^= *state << 13;
+  *state ^= *state >> 7;
+  *state ^= *state << 17;
+  return *state;
+}
+
+std::atomic<uint64_t> sink(0);
+
+// Every thread reads or writes its share of the mapping once. Returns GB/s.
+double Sequential(const Mapping& mapping, int num_threads, bool write) {
+  const size_t words = mapping.size / sizeof(uint64_t) / num_threads;
+  double seconds = RunThreads(num_threads, [&](int t) {
+    uint64_t* begin = reinterpret_cast<uint64_t*>(mapping.data) + t * words;
+    if (write) {
+      for (size_t i = 0; i < words; i++) {
+        begin[i] = i;
+      }
+    } else {
+      uint64_t sum = 0;
+      for (size_t i = 0; i < words; i++) {
+        sum += begin[i];
+      }
+      sink += sum;
+    }
+  });
+  return words * num_threads * sizeof(uint64_t) / seconds / 1e9;
+}
+
+// Every thread reads or writes a word of random cache lines, without waiting
+// for one access before starting the next. Returns millions of accesses per
+// second.
+double Random(const Mapping& mapping, int num_threads, bool write) {
+  const size_t lines = mapping.size / kCacheLine;
+  double seconds = RunThreads(num_threads, [&](int t) {
+    uint64_t state = 88172645463325252ull + t;
+    uint64_t sum = 0;
+    for (size_t i = 0; i < kRandomOpsPerThread; i++) {
+      auto word = reinterpret_cast<uint64_t*>(
+          mapping.data + (NextRandom(&state) % lines) * kCacheLine);
+      if (write) {
+        *word = i;
+      } else {
+        sum += *word;
+      }
+    }
+    sink += sum;
+  });
+  return kRandomOpsPerThread * num_threads / seconds / 1e6;
+}
+
+// Follows a chain through the cache lines of the first working_set bytes in
+// random order, so that every load depends on the one before. Returns the
+// nanoseconds per load.
+double PointerChase(const Mapping& mapping, size_t working_set) {
+  const size_t lines = working_set / kCacheLine;
+  std::vector<size_t> order(lines);
+  std::iota(order.begin(), order.end(), 0);
+  std::shuffle(order.begin(), order.end(), std::mt19937_64(1));
+  for (size_t i = 0; i < lines; i++) {
+    auto next = reinterpret_cast<uint64_t*>(mapping.data + order[i] * kCacheLine);
+    *next = order[(i + 1) % lines] * kCacheLine;
+  }
+  const size_t steps = std::max<size_t>(4 * lines, 1 << 22);
+  uint64_t offset = order[0] * kCacheLine;
+  auto t1 = steady_clock::now();
+  for (size_t i = 0; i < steps; i++) {
+    offset = *reinterpret_cast<volatile uint64_t*>(mapping.data + offset);
+  }
+  auto t2 = steady_clock::now();
+  sink += offset;
+  return static_cast<double>(duration_cast<nanoseconds>(t2 - t1).count()) / steps;
+}
+
+void Run(const Mapping& mapping, bool huge, int max_threads) {
+  bool applied = SetHugePages(mapping, huge);
+  printf("== %s, %s pages%s\n", mapping.name.c_str(), huge ? "huge" : "small",
+         applied ? "" : " (not supported, kernel default)");
+  // Fault everything in first, so that page faults do not count.
+  memset(mapping.data, 1, mapping.size);
+
+  printf("threads, seq read GB/s, seq write GB/s, random read Mops/s, "
+         "random write Mops/s\n");
+  for (int threads = 1; threads <= max_threads; threads *= 2) {
+    printf("%d, %.2f, %.2f, %.2f, %.2f\n", threads,
+           Sequential(mapping, threads, false), Sequential(mapping, threads, true),
+           Random(mapping, threads, false), Random(mapping, threads, true));
+  }
+
+  printf("working set bytes, pointer chase ns\n");
+  for (size_t working_set = 16 * 1024; working_set <= mapping.size;
+       working_set *= 4) {
+    printf("%zu, %.1f\n", working_set, PointerChase(mapping, working_set));
+  }
+}
+
+int main(int argc, char** argv) {
+  if (argc < 3 || argc > 4) {
+    fprintf(stderr, "usage: %s <file> <bytes> [max threads]\n", argv[0]);
+    return 1;
+  }
+  std::string path = argv[1];
+  size_t size = strtoul(argv[2], nullptr, 0);
+  int max_threads = argc > 3 ? atoi(argv[3]) : std::thread::hardware_concurrency();
+  ARROW_CHECK(size >= 16 * 1024 && max_threads > 0);
+
+  std::vector<Mapping> mappings = {MapFile(path, size), MapAnonymous(size)};
+  for (const auto& mapping : mappings) {
+    Run(mapping, false, max_threads);
+    Run(mapping, true, max_threads);
+  }
+  for (const auto& mapping : mappings) {
+    munmap(mapping.data, mapping.size);
+  }
+}
@@ -0,0 +1,92 @@
+#include <plasma/client.h>
+
+#include <arrow/util/logging.h>
+
+#include <bitset>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace plasma;
+
+using namespace std::chrono;
+
+// Measures how fast subscribers learn about sealed objects, with notifications
+// on sockets (ring capacity 0) or in rings in shared memory. Each subscriber
+// reads every notification, while the writer seals small objects as fast as it
+// can.
+
+int main(int argc, char** argv) {
+  if (argc != 6) {
+    printf("usage: %s <socket> <remote memory file> <objects> <subscribers> "
+           "<ring capacity>\n", argv[0]);
+    return 1;
+  }
+  std::string plasma_socket = argv[1];
+  std::string remote_memory_file = argv[2];
+  size_t n = strtol(argv[3], nullptr, 0);
+  int num_subscribers = atoi(argv[4]);
+  int64_t ring_capacity = strtol(argv[5], nullptr, 0);
+
+  std::vector<std::unique_ptr<PlasmaClient>> subscribers;
+  std::vector<int> fds;
+  for (int i = 0; i < num_subscribers; i++) {
+    subscribers.emplace_back(new PlasmaClient());
+    ARROW_CHECK_OK(subscribers.back()->Connect(plasma_socket));
+    int fd;
+    ARROW_CHECK_OK(subscribers.back()->Subscribe(&fd, ring_capacity));
+    fds.push_back(fd);
+  }
+  PlasmaClient writer;
+  ARROW_CHECK_OK(writer.MmapRemoteMemory(remote_memory_file));
+  ARROW_CHECK_OK(writer.Connect(plasma_socket));
+
+  std::vector<ObjectID> object_ids(n);
+  for (size_t i = 0; i < n; i++) {
+    object_ids[i] = ObjectID::from_binary(std::bitset<20>(i).to_string());
+  }
+
+  auto start = steady_clock::now();
+  std::vector<std::thread> threads;
+  for (int i = 0; i < num_subscribers; i++) {
+    threads.emplace_back([&, i]() {
+      ObjectID object_id;
+      int64_t data_size;
+      int64_t metadata_size;
+      for (size_t j = 0; j < n; j++) {
+        ARROW_CHECK_OK(
+            subscribers[i]->GetNotification(fds[i], &object_id, &data_size, &metadata_size));
+      }
+    });
+  }
+  std::shared_ptr<Buffer> data;
+  for (size_t i = 0; i < n; i++) {
+    ARROW_CHECK_OK(writer.Create(object_ids[i], 64, nullptr, 0, &data));
+    ARROW_CHECK_OK(writer.Seal(object_ids[i]));
+    ARROW_CHECK_OK(writer.Release(object_ids[i]));
+  }
+  double seal_seconds = duration_cast<duration<double>>(steady_clock::now() - start).count();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  double seconds = duration_cast<duration<double>>(steady_clock::now() - start).count();
+
+  printf("seals per second, notifications per second per subscriber\n");
+  printf("%.0f, %.0f\n", n / seal_seconds, n / seconds);
+
+  std::istringstream lines(writer.DebugString());
+  std::string line;
+  while (std::getline(lines, line)) {
+    if (line.compare(0, 15, "(notifications)") == 0) {
+      printf("%s\n", line.c_str());
+    }
+  }
+
+  ARROW_CHECK_OK(writer.Delete(object_ids));
+  ARROW_CHECK_OK(writer.Disconnect());
+  for (auto& subscriber : subscribers) {
+    ARROW_CHECK_OK(subscriber->Disconnect());
+  }
+}
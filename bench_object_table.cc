@@ -0,0 +1,85 @@
+#include <plasma/common.h>
+#include <plasma/flat_object_table.h>
+
+#include <arrow/util/logging.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+using namespace plasma;
+
+using namespace std::chrono;
+
+std::vector<ObjectID> RandomIds(size_t n, uint64_t seed) {
+  std::mt19937_64 gen(seed);
+  std::vector<ObjectID> ids(n);
+  for (size_t i = 0; i < n; i++) {
+    uint8_t* data = ids[i].mutable_data();
+    for (int j = 0; j < kUniqueIDSize; j += sizeof(uint32_t)) {
+      uint32_t r = static_cast<uint32_t>(gen());
+      memcpy(data + j, &r, sizeof(r));
+    }
+  }
+  return ids;
+}
+
+// Insert all ids, then look up every id in a shuffled order (hits) and as many
+// ids that are not in the table (misses). Prints insert, hit and miss times and
+// the lookup throughput in millions of lookups per second.
+template <typename Table, typename InsertFn, typename LookupFn>
+void Run(const char* name, const std::vector<ObjectID>& ids,
+         const std::vector<ObjectID>& shuffled, const std::vector<ObjectID>& missing,
+         InsertFn insert, LookupFn lookup) {
+  Table table;
+  auto t1 = steady_clock::now();
+  for (const auto& id : ids) {
+    insert(&table, id);
+  }
+  auto t2 = steady_clock::now();
+  int64_t found = 0;
+  for (const auto& id : shuffled) {
+    found += lookup(&table, id);
+  }
+  auto t3 = steady_clock::now();
+  for (const auto& id : missing) {
+    found += lookup(&table, id);
+  }
+  auto t4 = steady_clock::now();
+  ARROW_CHECK(found == static_cast<int64_t>(ids.size()));
+  double hit_us = duration_cast<microseconds>(t3 - t2).count();
+  double miss_us = duration_cast<microseconds>(t4 - t3).count();
+  printf("%s: %ld, %ld, %ld us (%.2f, %.2f Mlookups/s)\n", name,
+         duration_cast<microseconds>(t2 - t1).count(),
+         duration_cast<microseconds>(t3 - t2).count(),
+         duration_cast<microseconds>(t4 - t3).count(), shuffled.size() / hit_us,
+         missing.size() / miss_us);
+}
+
+int main(int argc, char** argv) {
+  size_t n = argc > 1 ? strtol(argv[1], nullptr, 0) : 10000000;
+
+  std::vector<ObjectID> ids = RandomIds(n, 1);
+  std::vector<ObjectID> missing = RandomIds(n, 2);
+  std::vector<ObjectID> shuffled = ids;
+  std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937_64(3));
+
+  Run<ObjectTable>(
+      "unordered_map", ids, shuffled, missing,
+      [](ObjectTable* table, const ObjectID& id) {
+        table->emplace(id, std::unique_ptr<ObjectTableEntry>(new ObjectTableEntry()));
+      },
+      [](ObjectTable* table, const ObjectID& id) {
+        auto it = table->find(id);
+        return it != table->end() && it->second->ref_count == 0 ? 1 : 0;
+      });
+
+  Run<FlatObjectTable>(
+      "flat", ids, shuffled, missing,
+      [](FlatObjectTable* table, const ObjectID& id) { table->emplace(id); },
+      [](FlatObjectTable* table, const ObjectID& id) {
+        auto it = table->find(id);
+        return it != table->end() && it->second.ref_count == 0 ? 1 : 0;
+      });
+}
@@ -0,0 +1,68 @@
+#include <plasma/client.h>
+
+#include <arrow/util/logging.h>
+
+#include <bitset>
+#include <chrono>
+#include <string>
+#include <vector>
+
+using namespace plasma;
+
+using namespace std::chrono;
+
+// Reads objects in the remote region (e.g. created with setup_remote_benchmark.sh)
+// one after the other, prefetching the next few while reading one. Compare the
+// times of the runs with depth 0 against the others. Objects stay resident
+// after the first read, so each depth reads its own range of objects.
+
+ObjectID* object_ids;
+
+int64_t ReadObjects(PlasmaClient& client, size_t first, size_t n, size_t depth) {
+  uint64_t sum = 0;
+  auto t1 = steady_clock::now();
+  for (size_t i = first; i < first + n; i++) {
+    if (depth > 0 && i + depth < first + n) {
+      ARROW_CHECK_OK(client.Prefetch({object_ids[i + depth]}));
+    }
+    ObjectBuffer buffer;
+    ARROW_CHECK_OK(client.Get(&object_ids[i], 1, 0, &buffer));
+    ARROW_CHECK(buffer.data != nullptr);
+    const uint8_t* data = buffer.data->data();
+    for (int64_t j = 0; j < buffer.data->size(); j += 64) {
+      sum += data[j];
+    }
+  }
+  auto t2 = steady_clock::now();
+  ARROW_CHECK(sum != 1);
+  return duration_cast<microseconds>(t2 - t1).count();
+}
+
+int main(int argc, char** argv) {
+  if (argc != 4) {
+    printf("usage: %s <socket> <remote memory file> <objects>\n", argv[0]);
+    return 1;
+  }
+  std::string plasma_socket = argv[1];
+  std::string remote_memory_file = argv[2];
+  size_t n = strtol(argv[3], nullptr, 0);
+
+  PlasmaClient client;
+  ARROW_CHECK_OK(client.MmapRemoteMemory(remote_memory_file));
+  ARROW_CHECK_OK(client.Connect(plasma_socket));
+
+  object_ids = new ObjectID[n];
+  for (size_t i = 0; i < n; i++) {
+    object_ids[i] = ObjectID::from_binary(std::bitset<20>(i).to_string());
+  }
+
+  const std::vector<size_t> depths = {0, 1, 4, 16};
+  const size_t per_depth = n / depths.size();
+  printf("depth, us\n");
+  for (size_t d = 0; d < depths.size(); d++) {
+    printf("%zu, %ld\n", depths[d],
+           ReadObjects(client, d * per_depth, per_depth, depths[d]));
+  }
+
+  ARROW_CHECK_OK(client.Disconnect());
+}
@@ -0,0 +1,106 @@
+#include <plasma/client.h>
+
+#include <arrow/util/logging.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bitset>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace plasma;
+
+using namespace std::chrono;
+
+// Measures the latency of gets of small objects while another client creates
+// large ones. Run it against a store started with -q (and -a -b to limit the
+// creates in the remote region) and against one without, to compare
+// scheduling by weight with processing requests as they arrive.
+
+int main(int argc, char** argv) {
+  if (argc != 7) {
+    printf("usage: %s <socket> <remote memory file> <gets> <large object size> "
+           "<writer weight> <reader weight>\n", argv[0]);
+    return 1;
+  }
+  std::string plasma_socket = argv[1];
+  std::string remote_memory_file = argv[2];
+  size_t n = strtol(argv[3], nullptr, 0);
+  int64_t large_size = strtol(argv[4], nullptr, 0);
+  int writer_weight = atoi(argv[5]);
+  int reader_weight = atoi(argv[6]);
+
+  PlasmaClient reader;
+  ARROW_CHECK_OK(reader.MmapRemoteMemory(remote_memory_file));
+  ARROW_CHECK_OK(reader.Connect(plasma_socket));
+  ARROW_CHECK_OK(reader.SetClientOptions("reader", 0, reader_weight));
+  PlasmaClient writer;
+  ARROW_CHECK_OK(writer.MmapRemoteMemory(remote_memory_file));
+  ARROW_CHECK_OK(writer.Connect(plasma_socket));
+  ARROW_CHECK_OK(writer.SetClientOptions("writer", 0, writer_weight));
+
+  ObjectID small_id = ObjectID::from_binary(std::bitset<20>(1).to_string());
+  std::shared_ptr<Buffer> small;
+  ARROW_CHECK_OK(reader.Create(small_id, 64, nullptr, 0, &small));
+  ARROW_CHECK_OK(reader.Seal(small_id));
+  ARROW_CHECK_OK(reader.Release(small_id));
+
+  // The writer creates, fills and deletes large objects until the reader is
+  // done, so that the store keeps having to make room for them.
+  std::atomic<bool> done(false);
+  int64_t num_writes = 0;
+  std::thread writer_thread([&]() {
+    std::vector<uint8_t> data(large_size, 0xab);
+    for (size_t i = 0; !done.load(); i++) {
+      ObjectID object_id =
+          ObjectID::from_binary(std::bitset<20>((1 << 19) + i % 1024).to_string());
+      std::shared_ptr<Buffer> buffer;
+      if (!writer.Create(object_id, large_size, nullptr, 0, &buffer).ok()) {
+        continue;
+      }
+      std::memcpy(buffer->mutable_data(), data.data(), large_size);
+      ARROW_CHECK_OK(writer.Seal(object_id));
+      ARROW_CHECK_OK(writer.Release(object_id));
+      ARROW_CHECK_OK(writer.Delete(object_id));
+      num_writes += 1;
+    }
+  });
+
+  std::vector<double> latencies(n);
+  auto start = steady_clock::now();
+  for (size_t i = 0; i < n; i++) {
+    auto t1 = steady_clock::now();
+    ObjectBuffer buffer;
+    ARROW_CHECK_OK(reader.Get(&small_id, 1, -1, &buffer));
+    ARROW_CHECK_OK(reader.Release(small_id));
+    auto t2 = steady_clock::now();
+    latencies[i] = duration_cast<duration<double, std::micro>>(t2 - t1).count();
+  }
+  double seconds = duration_cast<duration<double>>(steady_clock::now() - start).count();
+  done.store(true);
+  writer_thread.join();
+
+  std::sort(latencies.begin(), latencies.end());
+  auto percentile = [&latencies](double p) {
+    return latencies[std::min(latencies.size() - 1,
+                              static_cast<size_t>(p * latencies.size()))];
+  };
+  printf("get p50 us, get p99 us, get p99.9 us, get max us, writer MB/s\n");
+  printf("%.1f, %.1f, %.1f, %.1f, %.1f\n", percentile(0.5), percentile(0.99),
+         percentile(0.999), latencies.back(), num_writes * large_size / seconds / 1e6);
+
+  std::istringstream lines(reader.DebugString());
+  std::string line;
+  while (std::getline(lines, line)) {
+    if (line.compare(0, 12, "(scheduling)") == 0) {
+      printf("%s\n", line.c_str());
+    }
+  }
+
+  ARROW_CHECK_OK(writer.Disconnect());
+  ARROW_CHECK_OK(reader.Disconnect());
+}
@@ -0,0 +1,90 @@
+#include <plasma/client.h>
+
+#include <arrow/util/logging.h>
+
+#include <bitset>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace plasma;
+
+using namespace std::chrono;
+
+// Measures growing the region of a store started with -g while a client keeps
+// creating objects in it. The objects stay in use, so the store can not evict
+// them, and each time the region is full it grows by a step. For each step the
+// benchmark reports how long the grow took and the create latency right after
+// it, against the one before it.
+
+int main(int argc, char** argv) {
+  if (argc != 6) {
+    printf("usage: %s <socket> <remote memory file> <object size> <steps> "
+           "<step bytes>\n", argv[0]);
+    return 1;
+  }
+  std::string plasma_socket = argv[1];
+  std::string remote_memory_file = argv[2];
+  int64_t object_size = strtol(argv[3], nullptr, 0);
+  int num_steps = atoi(argv[4]);
+  int64_t step_bytes = strtol(argv[5], nullptr, 0);
+
+  PlasmaClient client;
+  ARROW_CHECK_OK(client.MmapRemoteMemory(remote_memory_file));
+  ARROW_CHECK_OK(client.Connect(plasma_socket));
+
+  std::vector<ObjectID> object_ids;
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  auto create = [&](double* micros) {
+    ObjectID object_id = ObjectID::from_binary(std::bitset<20>(object_ids.size()).to_string());
+    std::shared_ptr<Buffer> data;
+    auto start = steady_clock::now();
+    Status s = client.Create(object_id, object_size, nullptr, 0, &data, 0, false);
+    *micros = duration_cast<duration<double, std::micro>>(steady_clock::now() - start).count();
+    if (!s.ok()) {
+      ARROW_CHECK(IsPlasmaStoreFull(s)) << s.ToString();
+      return false;
+    }
+    ARROW_CHECK_OK(client.Seal(object_id));
+    object_ids.push_back(object_id);
+    buffers.push_back(data);
+    return true;
+  };
+
+  printf("step, region bytes, objects, grow us, create us before, create us after\n");
+  for (int step = 0; step < num_steps; step++) {
+    double before = 0;
+    double micros;
+    while (create(&micros)) {
+      before = micros;
+    }
+    int64_t capacity = client.store_capacity() + step_bytes;
+    auto start = steady_clock::now();
+    Status s = client.GrowRegion(capacity);
+    double grow = duration_cast<duration<double, std::micro>>(steady_clock::now() - start).count();
+    if (!s.ok()) {
+      printf("could not grow to %ld bytes: %s\n", capacity, s.ToString().c_str());
+      break;
+    }
+    double after;
+    ARROW_CHECK(create(&after));
+    printf("%d, %ld, %zu, %.1f, %.1f, %.1f\n", step, client.store_capacity(),
+           object_ids.size(), grow, before, after);
+  }
+
+  std::istringstream lines(client.DebugString());
+  std::string line;
+  while (std::getline(lines, line)) {
+    if (line.compare(0, 8, "(region)") == 0) {
+      printf("%s\n", line.c_str());
+    }
+  }
+
+  buffers.clear();
+  for (const auto& object_id : object_ids) {
+    ARROW_CHECK_OK(client.Release(object_id));
+  }
+  ARROW_CHECK_OK(client.Delete(object_ids));
+  ARROW_CHECK_OK(client.Disconnect());
+}
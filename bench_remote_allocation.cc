@@ -0,0 +1,81 @@
+#include <plasma/client.h>
+
+#include <arrow/util/logging.h>
+
+#include <bitset>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace plasma;
+
+using namespace std::chrono;
+
+// Creates, writes and seals more objects than fit in the memory of the local
+// store. Run it against a store started with -a, which places the objects that
+// do not fit in the region of the remote store, and against one without it,
+// which evicts to make room for them.
+
+int main(int argc, char** argv) {
+  if (argc != 5) {
+    printf("usage: %s <socket> <remote memory file> <objects> <object size>\n",
+           argv[0]);
+    return 1;
+  }
+  std::string plasma_socket = argv[1];
+  std::string remote_memory_file = argv[2];
+  size_t n = strtol(argv[3], nullptr, 0);
+  int64_t object_size = strtol(argv[4], nullptr, 0);
+
+  PlasmaClient client;
+  ARROW_CHECK_OK(client.MmapRemoteMemory(remote_memory_file));
+  ARROW_CHECK_OK(client.Connect(plasma_socket));
+
+  std::vector<ObjectID> object_ids(n);
+  for (size_t i = 0; i < n; i++) {
+    // Start past the objects setup_remote_benchmark.sh creates.
+    object_ids[i] = ObjectID::from_binary(std::bitset<20>((1 << 19) + i).to_string());
+  }
+
+  std::vector<uint8_t> data(object_size, 0xab);
+  size_t num_created = 0;
+  auto t1 = steady_clock::now();
+  for (size_t i = 0; i < n; i++) {
+    std::shared_ptr<Buffer> buffer;
+    Status s = client.Create(object_ids[i], object_size, nullptr, 0, &buffer);
+    if (IsPlasmaStoreFull(s)) {
+      continue;
+    }
+    ARROW_CHECK_OK(s);
+    std::memcpy(buffer->mutable_data(), data.data(), object_size);
+    ARROW_CHECK_OK(client.Seal(object_ids[i]));
+    ARROW_CHECK_OK(client.Release(object_ids[i]));
+    num_created += 1;
+  }
+  auto t2 = steady_clock::now();
+  double seconds = duration_cast<duration<double>>(t2 - t1).count();
+
+  // How many objects are still around, wherever they are.
+  size_t num_present = 0;
+  for (size_t i = 0; i < n; i++) {
+    bool has_object;
+    ARROW_CHECK_OK(client.Contains(object_ids[i], &has_object));
+    num_present += has_object;
+  }
+
+  printf("objects, created, present, creates/s, MB/s\n");
+  printf("%zu, %zu, %zu, %.0f, %.1f\n", n, num_created, num_present,
+         num_created / seconds, num_created * object_size / seconds / 1e6);
+
+  std::istringstream lines(client.DebugString());
+  std::string line;
+  while (std::getline(lines, line)) {
+    if (line.compare(0, 8, "(remote)") == 0) {
+      printf("%s\n", line.c_str());
+    }
+  }
+
+  ARROW_CHECK_OK(client.Disconnect());
+}
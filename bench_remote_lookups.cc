@@ -0,0 +1,87 @@
+#include <plasma/client.h>
+
+#include <arrow/util/logging.h>
+
+#include <bitset>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace plasma;
+
+using namespace std::chrono;
+
+// Measures the requests that the store answers by looking the objects up in the
+// remote store: Contains of objects that were created in the remote store
+// (e.g. with setup_remote_benchmark.sh) and Gets of objects that are in neither
+// store. Run it against stores started with different -w switches to compare
+// sending each lookup on its own with gathering them into one RPC.
+
+ObjectID* object_ids;
+ObjectID* missing_ids;
+
+// Every thread does ops lookups of each kind. Returns the total number of
+// lookups per second.
+double RunThreads(PlasmaClient& client, int num_threads, size_t n, size_t ops) {
+  std::vector<std::thread> threads;
+  auto t1 = steady_clock::now();
+  for (int t = 0; t < num_threads; t++) {
+    threads.emplace_back([&client, t, n, ops]() {
+      for (size_t i = 0; i < ops; i++) {
+        bool has_object;
+        ARROW_CHECK_OK(client.Contains(object_ids[(t * 7919 + i) % n], &has_object));
+        ARROW_CHECK(has_object);
+        ObjectBuffer buffer;
+        ARROW_CHECK_OK(client.Get(&missing_ids[(t * 7919 + i) % n], 1, 0, &buffer));
+        ARROW_CHECK(buffer.data == nullptr);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  auto t2 = steady_clock::now();
+  return 2 * num_threads * ops / duration_cast<duration<double>>(t2 - t1).count();
+}
+
+int main(int argc, char** argv) {
+  if (argc != 6) {
+    printf("usage: %s <socket> <remote memory file> <objects> <ops per thread> "
+           "<connections>\n", argv[0]);
+    return 1;
+  }
+  std::string plasma_socket = argv[1];
+  std::string remote_memory_file = argv[2];
+  size_t n = strtol(argv[3], nullptr, 0);
+  size_t ops = strtol(argv[4], nullptr, 0);
+  int num_connections = strtol(argv[5], nullptr, 0);
+
+  PlasmaClient client;
+  ARROW_CHECK_OK(client.MmapRemoteMemory(remote_memory_file));
+  ARROW_CHECK_OK(client.Connect(plasma_socket, "", 0, -1, num_connections));
+
+  object_ids = new ObjectID[n];
+  missing_ids = new ObjectID[n];
+  for (size_t i = 0; i < n; i++) {
+    object_ids[i] = ObjectID::from_binary(std::bitset<20>(i).to_string());
+    missing_ids[i] = ObjectID::from_binary(std::bitset<20>(n + i).to_string());
+  }
+
+  printf("threads, lookups/s\n");
+  for (int num_threads = 1; num_threads <= num_connections; num_threads *= 2) {
+    printf("%d, %.0f\n", num_threads, RunThreads(client, num_threads, n, ops));
+  }
+
+  // How many RPCs the lookups took.
+  std::istringstream lines(client.DebugString());
+  std::string line;
+  while (std::getline(lines, line)) {
+    if (line.compare(0, 8, "(remote)") == 0) {
+      printf("%s\n", line.c_str());
+    }
+  }
+
+  ARROW_CHECK_OK(client.Disconnect());
+}
@@ -0,0 +1,198 @@
+#include <plasma/client.h>
+#include <plasma/trace.h>
+
+#include <arrow/util/logging.h>
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace plasma;
+
+using namespace std::chrono;
+
+// Replays a trace recorded by a store started with -t against one or more
+// stores, and prints the latency of each kind of request. The clients of the
+// trace are spread over the stores round-robin. Gets do not wait for objects
+// that are missing, and requests the replay cannot repeat (e.g. sealing an
+// object whose create failed) are skipped.
+
+const char* kOpNames[] = {"create", "seal", "get", "release", "delete", "abort"};
+
+struct ReplayClient {
+  PlasmaClient client;
+  // How many times the client holds each object, and the objects it created
+  // but did not seal yet.
+  std::unordered_map<ObjectID, int64_t> references;
+  std::unordered_set<ObjectID> unsealed;
+};
+
+struct OpStats {
+  std::vector<double> latencies;
+  int64_t failed = 0;
+  int64_t skipped = 0;
+};
+
+int main(int argc, char** argv) {
+  if (argc != 5) {
+    printf("usage: %s <trace> <comma-separated sockets> <remote memory file> "
+           "<speed, 0 for as fast as possible>\n", argv[0]);
+    return 1;
+  }
+  std::string trace_file = argv[1];
+  std::vector<std::string> sockets;
+  std::stringstream socket_list(argv[2]);
+  std::string socket;
+  while (std::getline(socket_list, socket, ',')) {
+    sockets.push_back(socket);
+  }
+  std::string remote_memory_file = argv[3];
+  double speed = strtod(argv[4], nullptr);
+
+  std::vector<TraceRecord> records;
+  ARROW_CHECK_OK(ReadTrace(trace_file, &records));
+
+  std::map<int32_t, std::unique_ptr<ReplayClient>> clients;
+  for (const auto& record : records) {
+    auto& replay_client = clients[record.client];
+    if (replay_client == nullptr) {
+      replay_client.reset(new ReplayClient);
+      ARROW_CHECK_OK(replay_client->client.MmapRemoteMemory(remote_memory_file));
+      ARROW_CHECK_OK(replay_client->client.Connect(
+          sockets[(clients.size() - 1) % sockets.size()]));
+    }
+  }
+
+  std::vector<OpStats> stats(sizeof(kOpNames) / sizeof(kOpNames[0]));
+  int64_t get_misses = 0;
+  auto start = steady_clock::now();
+  size_t i = 0;
+  while (i < records.size()) {
+    const TraceRecord& record = records[i];
+    if (speed > 0) {
+      std::this_thread::sleep_until(
+          start + microseconds(static_cast<int64_t>(record.time_us / speed)));
+    }
+    ReplayClient& replay_client = *clients[record.client];
+    PlasmaClient& client = replay_client.client;
+    OpStats& op_stats = stats[static_cast<int>(record.op)];
+    // The objects of a get or delete follow each other and go in one request.
+    const size_t batch_size = std::max(record.batch_size, 1);
+    std::vector<ObjectID> object_ids;
+    for (size_t j = i; j < std::min(i + batch_size, records.size()); j++) {
+      object_ids.push_back(records[j].object_id);
+    }
+    i += object_ids.size();
+
+    const ObjectID& object_id = record.object_id;
+    bool skip = false;
+    switch (record.op) {
+      case TraceOp::Seal:
+      case TraceOp::Abort:
+        skip = replay_client.unsealed.count(object_id) == 0;
+        break;
+      case TraceOp::Release:
+        skip = replay_client.references[object_id] == 0;
+        break;
+      default:
+        break;
+    }
+    if (skip) {
+      op_stats.skipped += 1;
+      continue;
+    }
+
+    auto t1 = steady_clock::now();
+    arrow::Status status;
+    std::vector<ObjectBuffer> buffers;
+    switch (record.op) {
+      case TraceOp::Create: {
+        std::shared_ptr<Buffer> data;
+        status = client.Create(object_id, record.data_size, nullptr,
+                               record.metadata_size, &data);
+      } break;
+      case TraceOp::Seal:
+        status = client.Seal(object_id);
+        break;
+      case TraceOp::Get:
+        status = client.Get(object_ids, 0, &buffers);
+        break;
+      case TraceOp::Release:
+        status = client.Release(object_id);
+        break;
+      case TraceOp::Delete:
+        status = client.Delete(object_ids);
+        break;
+      case TraceOp::Abort:
+        status = client.Abort(object_id);
+        break;
+    }
+    auto t2 = steady_clock::now();
+    op_stats.latencies.push_back(
+        duration_cast<duration<double, std::micro>>(t2 - t1).count());
+    if (!status.ok()) {
+      op_stats.failed += 1;
+      continue;
+    }
+
+    switch (record.op) {
+      case TraceOp::Create:
+        replay_client.references[object_id] += 1;
+        replay_client.unsealed.insert(object_id);
+        break;
+      case TraceOp::Seal:
+        replay_client.unsealed.erase(object_id);
+        break;
+      case TraceOp::Get:
+        for (size_t j = 0; j < buffers.size(); j++) {
+          if (buffers[j].data == nullptr) {
+            get_misses += 1;
+          } else {
+            replay_client.references[object_ids[j]] += 1;
+          }
+        }
+        break;
+      case TraceOp::Release:
+        replay_client.references[object_id] -= 1;
+        break;
+      case TraceOp::Abort:
+        replay_client.unsealed.erase(object_id);
+        replay_client.references.erase(object_id);
+        break;
+      default:
+        break;
+    }
+  }
+  double seconds = duration_cast<duration<double>>(steady_clock::now() - start).count();
+
+  printf("operation, count, failed, skipped, p50 us, p99 us, p99.9 us, max us\n");
+  for (size_t op = 0; op < stats.size(); op++) {
+    std::vector<double>& latencies = stats[op].latencies;
+    if (latencies.empty()) {
+      printf("%s, 0, %ld, %ld, -, -, -, -\n", kOpNames[op], stats[op].failed,
+             stats[op].skipped);
+      continue;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&latencies](double p) {
+      return latencies[std::min(latencies.size() - 1,
+                                static_cast<size_t>(p * latencies.size()))];
+    };
+    printf("%s, %zu, %ld, %ld, %.1f, %.1f, %.1f, %.1f\n", kOpNames[op],
+           latencies.size(), stats[op].failed, stats[op].skipped, percentile(0.5),
+           percentile(0.99), percentile(0.999), latencies.back());
+  }
+  printf("records: %zu, clients: %zu, get misses: %ld, seconds: %.3f\n", records.size(),
+         clients.size(), get_misses, seconds);
+
+  for (auto& replay_client : clients) {
+    ARROW_CHECK_OK(replay_client.second->client.Disconnect());
+  }
+}
@@ -0,0 +1,22 @@
+#!/bin/bash
+set -e
+
+shmem=$1
+n=${2:-100000}
+
+export LD_LIBRARY_PATH=$PWD/arrow_build/release
+
+echo "Compiling benchmark"
+g++ -I.local/include -Larrow_build/release bench_allocations.cc -lplasma -larrow -O3 -o bench_allocations
+
+RESULTS_DIR=results/allocations_results
+
+mkdir -p $RESULTS_DIR
+
+echo "Running benchmark with $n operations of every kind"
+./bench_allocations /tmp/plasma $shmem $n > $RESULTS_DIR/benchmark.$n.result
+
+rm bench_allocations
+
+echo "Done"
+echo "Results written to $RESULTS_DIR/benchmark.$n.result"
@@ -0,0 +1,28 @@
+#!/bin/bash
+set -e
+
+shmem=$1
+
+export LD_LIBRARY_PATH=$PWD/arrow_build/release
+
+echo "Compiling benchmark"
+g++ -I.local/include -Larrow_build/release bench_client_scaling.cc -lplasma -larrow -lpthread -O3 -o bench_client_scaling
+
+objects=1000
+size=4096
+ops=20000
+
+RESULTS_DIR=results/client_scaling_results
+
+mkdir -p $RESULTS_DIR
+
+for connections in 1 4 16 64
+do
+  echo "Running with $connections connections"
+  ./bench_client_scaling /tmp/plasma $shmem $objects $size $ops $connections > $RESULTS_DIR/benchmark.$connections.result
+done
+
+rm bench_client_scaling
+
+echo "Done"
+echo "Results written to files ($RESULTS_DIR/benchmark.<connections>.result)"
@@ -0,0 +1,30 @@
+#!/bin/bash
+set -e
+
+# Run it once against a store started with -H (e.g. -H 0.9 -L 0.8) and once
+# without, to compare evicting in the background with evicting in the creates.
+# The store should have less memory than objects * size.
+
+shmem=$1
+label=${2:-default}
+
+export LD_LIBRARY_PATH=$PWD/arrow_build/release
+
+echo "Compiling benchmark"
+g++ -I.local/include -Larrow_build/release bench_create_latency.cc -lplasma -larrow -O3 -o bench_create_latency
+
+objects=20000
+size=1048576
+pause=100
+
+RESULTS_DIR=results/create_latency_results
+
+mkdir -p $RESULTS_DIR
+
+echo "Running benchmark"
+./bench_create_latency /tmp/plasma $shmem $objects $size $pause > $RESULTS_DIR/benchmark.$label.result
+
+rm bench_create_latency
+
+echo "Done"
+echo "Results written to $RESULTS_DIR/benchmark.$label.result"
@@ -0,0 +1,28 @@
+#!/bin/bash
+set -e
+
+shmem=$1
+label=${2:-default}
+
+export LD_LIBRARY_PATH=$PWD/arrow_build/release
+
+echo "Compiling benchmark"
+g++ -I.local/include -Larrow_build/release bench_list.cc -lplasma -larrow -lpthread -O3 -o bench_list
+
+objects=1000000
+
+RESULTS_DIR=results/list_results
+
+mkdir -p $RESULTS_DIR
+
+echo "Running benchmark"
+# A page size of 0 sends the whole table in one reply.
+for page_size in 0 1000 10000 100000; do
+  echo "page size: $page_size"
+  ./bench_list /tmp/plasma $shmem $objects $page_size
+done > $RESULTS_DIR/benchmark.$label.result
+
+rm bench_list
+
+echo "Done"
+echo "Results written to $RESULTS_DIR/benchmark.$label.result"
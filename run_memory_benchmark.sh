@@ -0,0 +1,25 @@
+#!/bin/bash
+set -e
+
+# The file to measure, e.g. the ivshmem device or /dev/shm/bench. It is
+# overwritten, so it must not be in use by a store.
+file=$1
+size=${2:-1073741824}
+threads=${3:-$(nproc)}
+
+export LD_LIBRARY_PATH=$PWD/arrow_build/release
+
+echo "Compiling benchmark"
+g++ -I.local/include -Larrow_build/release bench_memory.cc -larrow -lpthread -O3 -o bench_memory
+
+RESULTS_DIR=results/memory_results
+
+mkdir -p $RESULTS_DIR
+
+echo "Running benchmark on $file with $size bytes and up to $threads threads"
+./bench_memory $file $size $threads > $RESULTS_DIR/benchmark.$size.result
+
+rm bench_memory
+
+echo "Done"
+echo "Results written to $RESULTS_DIR/benchmark.$size.result"
@@ -0,0 +1,29 @@
+#!/bin/bash
+set -e
+
+shmem=$1
+label=${2:-default}
+
+export LD_LIBRARY_PATH=$PWD/arrow_build/release
+
+echo "Compiling benchmark"
+g++ -I.local/include -Larrow_build/release bench_notifications.cc -lplasma -larrow -lpthread -O3 -o bench_notifications
+
+objects=100000
+subscribers=4
+
+RESULTS_DIR=results/notifications_results
+
+mkdir -p $RESULTS_DIR
+
+echo "Running benchmark"
+# A ring capacity of 0 sends the notifications on sockets.
+for ring_capacity in 0 1024 65536; do
+  echo "ring capacity: $ring_capacity"
+  ./bench_notifications /tmp/plasma $shmem $objects $subscribers $ring_capacity
+done > $RESULTS_DIR/benchmark.$label.result
+
+rm bench_notifications
+
+echo "Done"
+echo "Results written to $RESULTS_DIR/benchmark.$label.result"
@@ -0,0 +1,16 @@
+#!/bin/bash
+set -e
+
+n=${1:-10000000}
+
+export LD_LIBRARY_PATH=$PWD/arrow_build/release
+
+echo "Compiling benchmark"
+g++ -I.local/include -Larrow_build/release bench_object_table.cc -lplasma -larrow -O3 -o bench_object_table
+
+echo "Running benchmark with $n objects (insert, hit lookup, miss lookup)"
+./bench_object_table $n
+
+rm bench_object_table
+
+echo "Done"
@@ -0,0 +1,25 @@
+#!/bin/bash
+set -e
+
+# Run setup_remote_benchmark.sh <shmem> 3 first, so that the remote store has
+# the objects.
+
+shmem=$1
+objects=${2:-200}
+
+export LD_LIBRARY_PATH=$PWD/arrow_build/release
+
+echo "Compiling benchmark"
+g++ -I.local/include -Larrow_build/release bench_prefetch.cc -lplasma -larrow -O3 -o bench_prefetch
+
+RESULTS_DIR=results/prefetch_results
+
+mkdir -p $RESULTS_DIR
+
+echo "Running benchmark with $objects objects"
+./bench_prefetch /tmp/plasma2 $shmem $objects > $RESULTS_DIR/benchmark.$objects.result
+
+rm bench_prefetch
+
+echo "Done"
+echo "Results written to $RESULTS_DIR/benchmark.$objects.result"
@@ -0,0 +1,31 @@
+#!/bin/bash
+set -e
+
+# Run it against a store started with -q (e.g. -q -a -b 1000000000) and
+# against one without, to compare scheduling by weight with processing the
+# requests as they arrive.
+
+shmem=$1
+label=${2:-default}
+
+export LD_LIBRARY_PATH=$PWD/arrow_build/release
+
+echo "Compiling benchmark"
+g++ -I.local/include -Larrow_build/release bench_qos.cc -lplasma -larrow -lpthread -O3 -o bench_qos
+
+gets=100000
+size=104857600
+writer_weight=1
+reader_weight=8
+
+RESULTS_DIR=results/qos_results
+
+mkdir -p $RESULTS_DIR
+
+echo "Running benchmark"
+./bench_qos /tmp/plasma $shmem $gets $size $writer_weight $reader_weight > $RESULTS_DIR/benchmark.$label.result
+
+rm bench_qos
+
+echo "Done"
+echo "Results written to $RESULTS_DIR/benchmark.$label.result"
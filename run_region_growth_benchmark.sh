@@ -0,0 +1,29 @@
+#!/bin/bash
+set -e
+
+shmem=$1
+label=${2:-default}
+
+export LD_LIBRARY_PATH=$PWD/arrow_build/release
+
+echo "Compiling benchmark"
+g++ -I.local/include -Larrow_build/release bench_region_growth.cc -lplasma -larrow -lpthread -O3 -o bench_region_growth
+
+# The store at /tmp/plasma must be started with -g at least
+# -m + steps * step_bytes, on a -v file that can be extended.
+object_size=1048576
+steps=16
+step_bytes=$((64 * 1024 * 1024))
+
+RESULTS_DIR=results/region_growth_results
+
+mkdir -p $RESULTS_DIR
+
+echo "Running benchmark"
+./bench_region_growth /tmp/plasma $shmem $object_size $steps $step_bytes \
+  > $RESULTS_DIR/benchmark.$label.result
+
+rm bench_region_growth
+
+echo "Done"
+echo "Results written to $RESULTS_DIR/benchmark.$label.result"
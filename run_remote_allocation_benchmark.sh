@@ -0,0 +1,28 @@
+#!/bin/bash
+set -e
+
+# Run it once against stores started with -a and once without, to compare
+# placing the objects that do not fit in the remote region with evicting.
+
+shmem=$1
+label=${2:-default}
+
+export LD_LIBRARY_PATH=$PWD/arrow_build/release
+
+echo "Compiling benchmark"
+g++ -I.local/include -Larrow_build/release bench_remote_allocation.cc -lplasma -larrow -O3 -o bench_remote_allocation
+
+objects=4096
+size=1048576
+
+RESULTS_DIR=results/remote_allocation_results
+
+mkdir -p $RESULTS_DIR
+
+echo "Running benchmark"
+./bench_remote_allocation /tmp/plasma $shmem $objects $size > $RESULTS_DIR/benchmark.$label.result
+
+rm bench_remote_allocation
+
+echo "Done"
+echo "Results written to $RESULTS_DIR/benchmark.$label.result"
@@ -0,0 +1,30 @@
+#!/bin/bash
+set -e
+
+# Run setup_remote_benchmark.sh <shmem> 1 first, so that the remote store has
+# the objects. Run it once against a store started with -w -1 and once with
+# the default, to compare.
+
+shmem=$1
+label=${2:-default}
+
+export LD_LIBRARY_PATH=$PWD/arrow_build/release
+
+echo "Compiling benchmark"
+g++ -I.local/include -Larrow_build/release bench_remote_lookups.cc -lplasma -larrow -lpthread -O3 -o bench_remote_lookups
+
+objects=1000
+ops=10000
+connections=16
+
+RESULTS_DIR=results/remote_lookups_results
+
+mkdir -p $RESULTS_DIR
+
+echo "Running benchmark"
+./bench_remote_lookups /tmp/plasma2 $shmem $objects $ops $connections > $RESULTS_DIR/benchmark.$label.result
+
+rm bench_remote_lookups
+
+echo "Done"
+echo "Results written to $RESULTS_DIR/benchmark.$label.result"
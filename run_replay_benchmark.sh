@@ -0,0 +1,28 @@
+#!/bin/bash
+set -e
+
+# Replays a trace recorded by a store started with -t <trace>. Start the
+# stores to replay against first, with the memory to compare, e.g. with and
+# without -H. A speed of 0 replays as fast as possible, 1 at the recorded pace.
+
+shmem=$1
+label=${2:-default}
+trace=${3:-/tmp/plasma.trace}
+speed=${4:-0}
+
+export LD_LIBRARY_PATH=$PWD/arrow_build/release
+
+echo "Compiling benchmark"
+g++ -I.local/include -Larrow_build/release bench_replay.cc -lplasma -larrow -O3 -o bench_replay
+
+RESULTS_DIR=results/replay_results
+
+mkdir -p $RESULTS_DIR
+
+echo "Running benchmark"
+./bench_replay $trace /tmp/plasma $shmem $speed > $RESULTS_DIR/benchmark.$label.result
+
+rm bench_replay
+
+echo "Done"
+echo "Results written to $RESULTS_DIR/benchmark.$label.result"